@@ -231,6 +231,29 @@ Item {
             Cpp_IO_Network.udpMulticast = checked
         }
       }
+
+      //
+      // UDP datagram framing checkbox
+      //
+      Label {
+        text: qsTr("Frame per Datagram") + ":"
+        opacity: _udpDatagramFrames.enabled ? 1 : 0.5
+        visible: Cpp_IO_Network.socketTypeIndex === 1
+      } CheckBox {
+        id: _udpDatagramFrames
+
+        Layout.leftMargin: -8
+        opacity: enabled ? 1 : 0.5
+        Layout.alignment: Qt.AlignLeft
+        checked: Cpp_IO_Network.udpDatagramFrames
+        visible: Cpp_IO_Network.socketTypeIndex === 1
+        enabled: Cpp_IO_Network.socketTypeIndex === 1 && app.ioEnabled
+
+        onCheckedChanged: {
+          if (Cpp_IO_Network.udpDatagramFrames !== checked)
+            Cpp_IO_Network.udpDatagramFrames = checked
+        }
+      }
     }
 
     //
@@ -104,6 +104,65 @@ Item {
       }
     }
 
+    //
+    // Bulk transfer pool (pre-connect, applied when the device is opened)
+    //
+    Label {
+      opacity: enabled ? 1 : 0.5
+      text: qsTr("Bulk Transfers") + ":"
+      enabled: app.ioEnabled
+      visible: !Cpp_IO_USB.isoModeEnabled
+    } SpinBox {
+      id: bulkCountSpin
+
+      from: 1
+      to: 64
+      Layout.fillWidth: true
+      opacity: enabled ? 1 : 0.5
+      enabled: app.ioEnabled
+      visible: !Cpp_IO_USB.isoModeEnabled
+      value: Cpp_IO_USB.bulkTransferCount
+
+      onValueModified: Cpp_IO_USB.bulkTransferCount = value
+
+      Connections {
+        target: Cpp_IO_USB
+        function onBulkTransferCountChanged() {
+          if (bulkCountSpin.value !== Cpp_IO_USB.bulkTransferCount)
+            bulkCountSpin.value = Cpp_IO_USB.bulkTransferCount
+        }
+      }
+    }
+
+    Label {
+      opacity: enabled ? 1 : 0.5
+      text: qsTr("Transfer Size") + ":"
+      enabled: app.ioEnabled
+      visible: !Cpp_IO_USB.isoModeEnabled
+    } SpinBox {
+      id: bulkSizeSpin
+
+      from: 1
+      to: 1048576
+      stepSize: 4096
+      editable: true
+      Layout.fillWidth: true
+      opacity: enabled ? 1 : 0.5
+      enabled: app.ioEnabled
+      visible: !Cpp_IO_USB.isoModeEnabled
+      value: Cpp_IO_USB.bulkTransferSize
+
+      onValueModified: Cpp_IO_USB.bulkTransferSize = value
+
+      Connections {
+        target: Cpp_IO_USB
+        function onBulkTransferSizeChanged() {
+          if (bulkSizeSpin.value !== Cpp_IO_USB.bulkTransferSize)
+            bulkSizeSpin.value = Cpp_IO_USB.bulkTransferSize
+        }
+      }
+    }
+
     //
     // Info block — pre-connect, spans both columns
     //
@@ -103,21 +103,31 @@ Item {
   }
 
   //
-  // Update curve at 24 Hz
+  // Redraw the spectrum when the dashboard reports new samples
   //
+  function redraw() {
+    if (root.visible && root.model) {
+      root.model.draw(upperSeries)
+      lowerSeries.clear()
+      lowerSeries.append(root.model.minX, root.model.minY)
+      lowerSeries.append(root.model.maxX, root.model.minY)
+    }
+  }
+
   Connections {
-    target: Cpp_Misc_TimerEvents
-
-    function onUiTimeout() {
-      if (root.visible && root.model) {
-        root.model.draw(upperSeries)
-        lowerSeries.clear()
-        lowerSeries.append(root.model.minX, root.model.minY)
-        lowerSeries.append(root.model.maxX, root.model.minY)
-      }
+    target: root.model
+
+    function onUpdated() {
+      root.redraw()
+    }
+
+    function onDataSizeChanged() {
+      root.redraw()
     }
   }
 
+  onVisibleChanged: redraw()
+
   //
   // Add toolbar
   //
@@ -117,34 +117,42 @@ Item {
   }
 
   //
-  // Update widget at 24 Hz
+  // Redraw the curves when the dashboard reports new samples
   //
-  Connections {
-    target: Cpp_Misc_TimerEvents
-
-    function onUiTimeout() {
-      if (root.visible) {
-        root.model.updateData()
-
-        const count = plot.graph.seriesList.length
-        for (let i = 0; i < count; ++i) {
-          let ptr = plot.graph.seriesList[i]
-          if (ptr.curveVisible)
-            root.model.draw(ptr, ptr.curveIndex)
-          else
-            ptr.clear()
-        }
+  function redraw() {
+    if (root.visible && root.model) {
+      root.model.updateData()
+
+      const count = plot.graph.seriesList.length
+      for (let i = 0; i < count; ++i) {
+        let ptr = plot.graph.seriesList[i]
+        if (ptr.curveVisible)
+          root.model.draw(ptr, ptr.curveIndex)
+        else
+          ptr.clear()
       }
     }
   }
 
+  onVisibleChanged: redraw()
+  onInterpolateChanged: redraw()
+
   //
-  // Re-draw whole plot when curves changes
+  // Re-draw whole plot when the samples, size or curves change
   //
   Connections {
     target: root.model
 
+    function onUpdated() {
+      root.redraw()
+    }
+
     function onCurvesChanged() {
+      root.redraw()
+    }
+
+    function onDataSizeChanged() {
+      root.redraw()
     }
   }
 
@@ -108,29 +108,41 @@ Item {
   }
 
   //
-  // Update curve at 24 Hz
+  // Redraw the curve when the dashboard reports new samples
   //
-  Connections {
-    target: Cpp_Misc_TimerEvents
-
-    function onUiTimeout() {
-      if (root.visible && root.model) {
-        if (root.interpolate) {
-          root.model.draw(upperSeries)
-
-          if (root.showAreaUnderPlot) {
-            lowerSeries.clear()
-            lowerSeries.append(root.model.minX, root.model.minY)
-            lowerSeries.append(root.model.maxX, root.model.minY)
-          }
+  function redraw() {
+    if (root.visible && root.model) {
+      if (root.interpolate) {
+        root.model.draw(upperSeries)
+
+        if (root.showAreaUnderPlot) {
+          lowerSeries.clear()
+          lowerSeries.append(root.model.minX, root.model.minY)
+          lowerSeries.append(root.model.maxX, root.model.minY)
         }
-
-        else
-          root.model.draw(scatterSeries)
       }
+
+      else
+        root.model.draw(scatterSeries)
     }
   }
 
+  Connections {
+    target: root.model
+
+    function onUpdated() {
+      root.redraw()
+    }
+
+    function onDataSizeChanged() {
+      root.redraw()
+    }
+  }
+
+  onVisibleChanged: redraw()
+  onInterpolateChanged: redraw()
+  onShowAreaUnderPlotChanged: redraw()
+
   //
   // Add toolbar
   //
@@ -127,6 +127,10 @@ Item {
     onActivated: root.copy()
     sequences: [StandardKey.Copy]
     enabled: terminal.activeFocus && !root.vt100Interactive
+  } Shortcut {
+    sequences: [StandardKey.Find]
+    onActivated: searchField.forceActiveFocus()
+    enabled: terminal.activeFocus && !root.vt100Interactive
   }
 
   //
@@ -468,6 +472,41 @@ Item {
         Layout.fillWidth: true
       }
 
+      Label {
+        Layout.alignment: Qt.AlignVCenter
+        visible: searchField.text.length > 0
+        color: Cpp_ThemeManager.colors["placeholder_text"]
+        text: {
+          if (terminal.searchMatches > 0)
+            return qsTr("%1 of %2").arg(terminal.currentMatch + 1).arg(terminal.searchMatches)
+
+          return terminal.searching ? qsTr("Searching...") : qsTr("No matches")
+        }
+      }
+
+      //
+      // Search the scrollback, <enter> and <shift+enter> step through matches
+      //
+      TextField {
+        id: searchField
+
+        implicitHeight: 24
+        implicitWidth: 160
+        Layout.alignment: Qt.AlignVCenter
+        placeholderText: qsTr("Search") + "..."
+        onTextChanged: terminal.search(text)
+        Keys.onEscapePressed: {
+          searchField.clear()
+          terminal.forceActiveFocus()
+        }
+        Keys.onReturnPressed: (event) => {
+          if (event.modifiers & Qt.ShiftModifier)
+            terminal.findPrevious()
+          else
+            terminal.findNext()
+        }
+      }
+
       ComboBox {
         id: displayModeCombo
 
@@ -31,6 +31,7 @@
 #include "API/Handlers/IOManagerHandler.h"
 #include "API/Handlers/NetworkHandler.h"
 #include "API/Handlers/ProjectHandler.h"
+#include "API/Handlers/ReprocessHandler.h"
 #include "API/Handlers/SourceHandler.h"
 #include "API/Handlers/UARTHandler.h"
 #include "API/Handlers/WindowHandler.h"
@@ -245,6 +246,7 @@ void API::CommandHandler::initializeHandlers()
   Handlers::WindowHandler::registerCommands();
   Handlers::SourceHandler::registerCommands();
   Handlers::ExtensionHandler::registerCommands();
+  Handlers::ReprocessHandler::registerCommands();
 
 #ifdef BUILD_COMMERCIAL
   Handlers::ModbusHandler::registerCommands();
@@ -207,7 +207,7 @@ google::protobuf::Struct API::GRPC::ConversionUtils::frameToProtoStruct(
     for (const auto& ds : group.datasets) {
       auto* ds_val = ds_list->add_values()->mutable_struct_value();
       setString(*ds_val, "title", ds.title);
-      setString(*ds_val, "value", ds.value);
+      setString(*ds_val, "value", DataModel::dataset_text(ds));
       setString(*ds_val, "units", ds.units);
       setNumber(*ds_val, "index", ds.index);
       setNumber(*ds_val, "widgetMin", qMin(ds.wgtMin, ds.wgtMax));
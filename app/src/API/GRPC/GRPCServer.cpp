@@ -474,7 +474,8 @@ void API::GRPC::GRPCServer::writerLoop()
       while (m_frameQueue.try_dequeue(frame)) {
         did_work             = true;
         auto* fd             = batch.add_frames();
-        *fd->mutable_frame() = ConversionUtils::frameToProtoStruct(frame->data);
+        *fd->mutable_frame() =
+          ConversionUtils::frameToProtoStruct(DataModel::materialize_frame(*frame));
         fd->set_timestamp_ms(
           std::chrono::duration_cast<std::chrono::milliseconds>(frame->timestamp.time_since_epoch())
             .count());
@@ -55,6 +55,25 @@ void API::Handlers::MDF4ExportHandler::registerCommands()
                            setEnabledSchema,
                            &setEnabled);
 
+  QJsonObject setCompressionSchema;
+  {
+    QJsonObject props;
+    QJsonObject prop;
+    prop.insert("type", "boolean");
+    prop.insert("description", "Whether to store data in compressed DZ blocks");
+    props.insert("enabled", prop);
+    setCompressionSchema.insert("type", "object");
+    setCompressionSchema.insert("properties", props);
+    QJsonArray req;
+    req.append("enabled");
+    setCompressionSchema.insert("required", req);
+  }
+  registry.registerCommand(
+    QStringLiteral("mdf4.export.setCompression"),
+    QStringLiteral("Enable or disable DZ block compression (applies to the next file)"),
+    setCompressionSchema,
+    &setCompression);
+
   QJsonObject closeSchema;
   closeSchema.insert("type", "object");
   closeSchema.insert("properties", QJsonObject());
@@ -97,6 +116,26 @@ API::CommandResponse API::Handlers::MDF4ExportHandler::setEnabled(const QString&
   return CommandResponse::makeSuccess(id, result);
 }
 
+/**
+ * @brief Enable or disable DZ block compression
+ * @param params Requires "enabled" (bool)
+ */
+API::CommandResponse API::Handlers::MDF4ExportHandler::setCompression(const QString& id,
+                                                                      const QJsonObject& params)
+{
+  if (!params.contains(QStringLiteral("enabled"))) {
+    return CommandResponse::makeError(
+      id, ErrorCode::MissingParam, QStringLiteral("Missing required parameter: enabled"));
+  }
+
+  const bool enabled = params.value(QStringLiteral("enabled")).toBool();
+  MDF4::Export::instance().setCompressionEnabled(enabled);
+
+  QJsonObject result;
+  result[QStringLiteral("compression")] = enabled;
+  return CommandResponse::makeSuccess(id, result);
+}
+
 /**
  * @brief Close the current MDF4 file
  */
@@ -127,8 +166,10 @@ API::CommandResponse API::Handlers::MDF4ExportHandler::getStatus(const QString&
   auto& mdf4Export = MDF4::Export::instance();
 
   QJsonObject result;
-  result[QStringLiteral("enabled")] = mdf4Export.exportEnabled();
-  result[QStringLiteral("isOpen")]  = mdf4Export.isOpen();
+  result[QStringLiteral("enabled")]     = mdf4Export.exportEnabled();
+  result[QStringLiteral("isOpen")]      = mdf4Export.isOpen();
+  result[QStringLiteral("compression")] = mdf4Export.compressionEnabled();
+  result[QStringLiteral("writeStats")]  = mdf4Export.writeStats();
 
   return CommandResponse::makeSuccess(id, result);
 }
@@ -32,6 +32,7 @@ namespace Handlers {
  *
  * Provides commands for:
  * - mdf4.export.setEnabled - Enable/disable MDF4 export
+ * - mdf4.export.setCompression - Enable/disable DZ block compression
  * - mdf4.export.close - Close current MDF4 file
  * - mdf4.export.getStatus - Query export status
  */
@@ -45,6 +46,7 @@ public:
 private:
   // Mutation commands
   static CommandResponse setEnabled(const QString& id, const QJsonObject& params);
+  static CommandResponse setCompression(const QString& id, const QJsonObject& params);
   static CommandResponse close(const QString& id, const QJsonObject& params);
 
   // Query commands
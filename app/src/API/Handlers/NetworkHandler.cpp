@@ -138,6 +138,23 @@ void API::Handlers::NetworkHandler::registerCommands()
                              &setUdpMulticast);
   }
 
+  {
+    QJsonObject props;
+    props[QStringLiteral("enabled")] = QJsonObject{
+      {       QStringLiteral("type"),                                 QStringLiteral("boolean")},
+      {QStringLiteral("description"), QStringLiteral("Treat each UDP datagram as one frame")}
+    };
+    QJsonObject schema;
+    schema[QStringLiteral("type")]       = QStringLiteral("object");
+    schema[QStringLiteral("properties")] = props;
+    schema[QStringLiteral("required")]   = QJsonArray{QStringLiteral("enabled")};
+    registry.registerCommand(
+      QStringLiteral("io.driver.network.setUdpDatagramFrames"),
+      QStringLiteral("Enable/disable one frame per UDP datagram (params: enabled)"),
+      schema,
+      &setUdpDatagramFrames);
+  }
+
   {
     QJsonObject props;
     props[QStringLiteral("host")] = QJsonObject{
@@ -333,6 +350,26 @@ API::CommandResponse API::Handlers::NetworkHandler::setUdpMulticast(const QStrin
   return CommandResponse::makeSuccess(id, result);
 }
 
+/**
+ * @brief Enable or disable using UDP datagram boundaries as frame boundaries
+ * @param params Requires "enabled" (bool)
+ */
+API::CommandResponse API::Handlers::NetworkHandler::setUdpDatagramFrames(const QString& id,
+                                                                         const QJsonObject& params)
+{
+  if (!params.contains(QStringLiteral("enabled"))) {
+    return CommandResponse::makeError(
+      id, ErrorCode::MissingParam, QStringLiteral("Missing required parameter: enabled"));
+  }
+
+  const bool enabled = params.value(QStringLiteral("enabled")).toBool();
+  IO::ConnectionManager::instance().network()->setUdpDatagramFrames(enabled);
+
+  QJsonObject result;
+  result[QStringLiteral("udpDatagramFrames")] = enabled;
+  return CommandResponse::makeSuccess(id, result);
+}
+
 /**
  * @brief Perform DNS lookup for a hostname
  * @param params Requires "host" (string)
@@ -393,10 +430,11 @@ API::CommandResponse API::Handlers::NetworkHandler::getConfiguration(const QStri
     result[QStringLiteral("socketTypeName")] = socketTypes.at(network->socketTypeIndex());
 
   // Other settings
-  result[QStringLiteral("udpMulticast")]    = network->udpMulticast();
-  result[QStringLiteral("lookupActive")]    = network->lookupActive();
-  result[QStringLiteral("isOpen")]          = network->isOpen();
-  result[QStringLiteral("configurationOk")] = network->configurationOk();
+  result[QStringLiteral("udpMulticast")]      = network->udpMulticast();
+  result[QStringLiteral("udpDatagramFrames")] = network->udpDatagramFrames();
+  result[QStringLiteral("lookupActive")]      = network->lookupActive();
+  result[QStringLiteral("isOpen")]            = network->isOpen();
+  result[QStringLiteral("configurationOk")]   = network->configurationOk();
 
   // Default values for reference
   result[QStringLiteral("defaultAddress")]       = network->defaultAddress();
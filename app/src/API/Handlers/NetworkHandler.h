@@ -36,6 +36,7 @@ namespace Handlers {
  * - io.driver.network.setUdpRemotePort - Set UDP remote port
  * - io.driver.network.setSocketType - Set socket type (TCP/UDP)
  * - io.driver.network.setUdpMulticast - Enable/disable UDP multicast
+ * - io.driver.network.setUdpDatagramFrames - Treat each UDP datagram as one frame
  * - io.driver.network.lookup - Perform DNS lookup
  * - io.driver.network.getConfiguration - Query current configuration
  * - io.driver.network.getSocketTypes - Query available socket types
@@ -55,6 +56,7 @@ private:
   static CommandResponse setUdpRemotePort(const QString& id, const QJsonObject& params);
   static CommandResponse setSocketType(const QString& id, const QJsonObject& params);
   static CommandResponse setUdpMulticast(const QString& id, const QJsonObject& params);
+  static CommandResponse setUdpDatagramFrames(const QString& id, const QJsonObject& params);
   static CommandResponse lookup(const QString& id, const QJsonObject& params);
 
   // Query commands
@@ -0,0 +1,157 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "API/Handlers/ReprocessHandler.h"
+
+#include <QJsonArray>
+
+#include "API/CommandRegistry.h"
+#include "API/PathPolicy.h"
+#include "DataModel/Reprocessor.h"
+
+//--------------------------------------------------------------------------------------------------
+// Command registration
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Register all reprocessing commands with the registry
+ */
+void API::Handlers::ReprocessHandler::registerCommands()
+{
+  auto& registry = CommandRegistry::instance();
+
+  // Empty schema for parameterless commands
+  QJsonObject emptySchema;
+  emptySchema.insert(QStringLiteral("type"), QStringLiteral("object"));
+  emptySchema.insert(QStringLiteral("properties"), QJsonObject());
+
+  // Schema for reprocess.start
+  QJsonObject filePathProp;
+  filePathProp.insert(QStringLiteral("type"), QStringLiteral("string"));
+  filePathProp.insert(QStringLiteral("description"), QStringLiteral("Raw capture to reprocess"));
+
+  QJsonObject csvProp;
+  csvProp.insert(QStringLiteral("type"), QStringLiteral("boolean"));
+  csvProp.insert(QStringLiteral("description"),
+                 QStringLiteral("Write the frames to a new CSV file (default: true)"));
+
+  QJsonObject mdf4Prop;
+  mdf4Prop.insert(QStringLiteral("type"), QStringLiteral("boolean"));
+  mdf4Prop.insert(QStringLiteral("description"),
+                  QStringLiteral("Write the frames to a new MDF4 file (default: false)"));
+
+  QJsonObject startProps;
+  startProps.insert(QStringLiteral("filePath"), filePathProp);
+  startProps.insert(QStringLiteral("csvExport"), csvProp);
+  startProps.insert(QStringLiteral("mdf4Export"), mdf4Prop);
+
+  QJsonArray startRequired;
+  startRequired.append(QStringLiteral("filePath"));
+
+  QJsonObject startSchema;
+  startSchema.insert(QStringLiteral("type"), QStringLiteral("object"));
+  startSchema.insert(QStringLiteral("properties"), startProps);
+  startSchema.insert(QStringLiteral("required"), startRequired);
+
+  // Register commands
+  registry.registerCommand(
+    QStringLiteral("reprocess.start"),
+    QStringLiteral("Reprocess a recorded file at maximum speed (params: filePath, csvExport, "
+                   "mdf4Export)"),
+    startSchema,
+    &start);
+
+  registry.registerCommand(QStringLiteral("reprocess.cancel"),
+                           QStringLiteral("Abort the current reprocessing run"),
+                           emptySchema,
+                           &cancel);
+
+  registry.registerCommand(QStringLiteral("reprocess.getStatus"),
+                           QStringLiteral("Get reprocessing progress and summary"),
+                           emptySchema,
+                           &getStatus);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Setters
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Start reprocessing a file
+ * @param params Requires "filePath" (string), optional "csvExport" and
+ *               "mdf4Export" (bool)
+ */
+API::CommandResponse API::Handlers::ReprocessHandler::start(const QString& id,
+                                                            const QJsonObject& params)
+{
+  if (!params.contains(QStringLiteral("filePath"))) {
+    return CommandResponse::makeError(
+      id, ErrorCode::MissingParam, QStringLiteral("Missing required parameter: filePath"));
+  }
+
+  const QString file_path = params.value(QStringLiteral("filePath")).toString();
+  if (file_path.isEmpty()) {
+    return CommandResponse::makeError(
+      id, ErrorCode::InvalidParam, QStringLiteral("filePath cannot be empty"));
+  }
+
+  if (!API::isPathAllowed(file_path)) {
+    return CommandResponse::makeError(
+      id, ErrorCode::InvalidParam, QStringLiteral("filePath is not allowed"));
+  }
+
+  const bool csv  = params.value(QStringLiteral("csvExport")).toBool(true);
+  const bool mdf4 = params.value(QStringLiteral("mdf4Export")).toBool(false);
+
+  auto& reprocessor = DataModel::Reprocessor::instance();
+  if (!reprocessor.start(file_path, csv, mdf4)) {
+    return CommandResponse::makeError(id, ErrorCode::OperationFailed, reprocessor.errorString());
+  }
+
+  return CommandResponse::makeSuccess(id, reprocessor.status());
+}
+
+/**
+ * @brief Abort the current run
+ */
+API::CommandResponse API::Handlers::ReprocessHandler::cancel(const QString& id,
+                                                             const QJsonObject& params)
+{
+  Q_UNUSED(params)
+
+  DataModel::Reprocessor::instance().cancel();
+  return CommandResponse::makeSuccess(id, DataModel::Reprocessor::instance().status());
+}
+
+//--------------------------------------------------------------------------------------------------
+// Getters
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Get progress of the current run, or the summary of the last one
+ */
+API::CommandResponse API::Handlers::ReprocessHandler::getStatus(const QString& id,
+                                                                const QJsonObject& params)
+{
+  Q_UNUSED(params)
+
+  return CommandResponse::makeSuccess(id, DataModel::Reprocessor::instance().status());
+}
@@ -102,6 +102,31 @@ bool exceedsJsonDepthLimit(const QByteArray& data, int maxDepth)
   return false;
 }
 
+/**
+ * @brief Lists the unique IDs of the datasets refreshed by a sparse update.
+ *
+ * @param frame Materialized frame, in the same order as its schema.
+ * @param dirty Schema-order ordinals of the refreshed datasets.
+ * @return JSON array of dataset unique IDs.
+ */
+static QJsonArray updatedDatasets(const DataModel::Frame& frame,
+                                  const DataModel::DirtyDatasets& dirty)
+{
+  std::vector<bool> marked(DataModel::dataset_count(frame), false);
+  for (const auto ordinal : dirty)
+    if (ordinal < marked.size())
+      marked[ordinal] = true;
+
+  QJsonArray ids;
+  size_t ordinal = 0;
+  for (const auto& group : frame.groups)
+    for (const auto& dataset : group.datasets)
+      if (marked[ordinal++])
+        ids.append(dataset.uniqueId);
+
+  return ids;
+}
+
 //--------------------------------------------------------------------------------------------------
 // ServerWorker implementation
 //--------------------------------------------------------------------------------------------------
@@ -298,7 +323,13 @@ void API::ServerWorker::processItems(const std::vector<DataModel::TimestampedFra
   QJsonArray array;
   for (const auto& timestampedFrame : items) {
     QJsonObject object;
-    object.insert(QStringLiteral("data"), serialize(timestampedFrame->data));
+    const auto frame = DataModel::materialize_frame(*timestampedFrame);
+    object.insert(QStringLiteral("data"), serialize(frame));
+
+    // Sparse updates carry last known values; list what actually changed
+    if (!timestampedFrame->dirty.empty())
+      object.insert(QStringLiteral("updated"), updatedDatasets(frame, timestampedFrame->dirty));
+
     array.append(object);
   }
 
@@ -32,8 +32,10 @@
 #  include "MQTT/Client.h"
 #endif
 
+#include <charconv>
 #include <QDateTime>
 #include <QDir>
+#include <QSet>
 
 //--------------------------------------------------------------------------------------------------
 // ExportWorker implementation
@@ -60,18 +62,21 @@ void CSV::ExportWorker::closeResources()
   if (!m_csvFile.isOpen())
     return;
 
+  writeBuffer();
   m_csvFile.close();
-  m_knownUniqueIds.clear();
-  m_indexHeaderPairs.clear();
-  m_textStream.setDevice(nullptr);
+  m_columnCount = 0;
+  m_rowCells.clear();
+  m_columnMaps.clear();
+  m_columnIndex.clear();
+  m_writeBuffer.clear();
   DataModel::clear_frame(m_templateFrame);
 }
 
 /**
  * @brief Processes a batch of CSV frames.
  *
- * Writes frames to disk using the output stream.
- * If no file is open, a new file is created before writing.
+ * Formats every row into a reusable byte buffer and writes it to disk in
+ * large blocks. If no file is open, a new file is created before writing.
  *
  * @param items Vector of timestamped frames to process.
  */
@@ -86,48 +91,35 @@ void CSV::ExportWorker::processItems(const std::vector<DataModel::TimestampedFra
     // Use cached template frame (all sources) if available so that all
     // columns are registered upfront. Falls back to first data frame for
     // QuickPlot/JSON modes.
-    if (!m_templateFrame.groups.empty())
-      m_indexHeaderPairs = createCsvFile(m_templateFrame);
-    else
-      m_indexHeaderPairs = createCsvFile((*items.begin())->data);
-
-    if (m_indexHeaderPairs.isEmpty())
+    const bool created = !m_templateFrame.groups.empty()
+                         ? createCsvFile(m_templateFrame)
+                         : createCsvFile(*(*items.begin())->schema);
+    if (!created)
       return;
 
     m_referenceTimestamp = (*items.begin())->timestamp;
   }
 
   for (const auto& i : items) {
-    const auto elapsed     = i->timestamp - m_referenceTimestamp;
-    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
-    const double seconds   = static_cast<double>(nanoseconds) / 1'000'000'000.0;
-
-    m_textStream << QString::number(seconds, 'f', 9) << QStringLiteral(",");
-
-    QMap<int, QString> fieldValues;
-    for (const auto& g : i->data.groups)
-      for (const auto& d : g.datasets)
-        fieldValues[d.uniqueId] = d.value.simplified();
-
-    for (int j = 0; j < m_indexHeaderPairs.count(); ++j) {
-      m_textStream << fieldValues.value(m_indexHeaderPairs[j].first, "");
-      m_textStream << (j < m_indexHeaderPairs.count() - 1 ? "," : "\n");
-    }
+    appendRow(*i);
+    if (m_writeBuffer.size() >= kWriteBlockSize)
+      writeBuffer();
   }
 
-  m_textStream.flush();
+  writeBuffer();
+  m_csvFile.flush();
 }
 
 /**
  * @brief Creates a new CSV file and writes the header.
  *
- * Builds a sorted header based on dataset indices and opens the file
- * in the appropriate location.
+ * Builds a header sorted by dataset unique ID, opens the file in the
+ * appropriate location and records the column slot of every dataset.
  *
  * @param frame The frame used to extract header information.
- * @return List of index-title pairs for each dataset.
+ * @return @c true if the file was created and has at least one column.
  */
-QVector<QPair<int, QString>> CSV::ExportWorker::createCsvFile(const DataModel::Frame& frame)
+bool CSV::ExportWorker::createCsvFile(const DataModel::Frame& frame)
 {
   // Build the output file path from the current timestamp
   const auto dt       = QDateTime::currentDateTime();
@@ -147,23 +139,9 @@ QVector<QPair<int, QString>> CSV::ExportWorker::createCsvFile(const DataModel::F
   QDir dir(path);
   if (!dir.exists() && !dir.mkpath(".")) {
     qWarning() << "Failed to create directory:" << path;
-    return {};
+    return false;
   }
 
-  m_csvFile.setFileName(dir.filePath(fileName));
-  if (!m_csvFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
-    qWarning() << "Cannot open CSV file for writing:" << dir.filePath(fileName);
-    return {};
-  }
-
-  m_textStream.setDevice(&m_csvFile);
-  m_textStream.setGenerateByteOrderMark(true);
-#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-  m_textStream.setCodec("UTF-8");
-#else
-  m_textStream.setEncoding(QStringConverter::Utf8);
-#endif
-
   QSet<int> seenUniqueIds;
   QVector<QPair<int, QString>> pairs;
   for (const auto& g : frame.groups) {
@@ -178,19 +156,133 @@ QVector<QPair<int, QString>> CSV::ExportWorker::createCsvFile(const DataModel::F
     }
   }
 
+  if (pairs.isEmpty())
+    return false;
+
+  m_csvFile.setFileName(dir.filePath(fileName));
+  if (!m_csvFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    qWarning() << "Cannot open CSV file for writing:" << dir.filePath(fileName);
+    return false;
+  }
+
   std::sort(
     pairs.begin(), pairs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
 
-  m_knownUniqueIds = seenUniqueIds;
-
-  m_textStream << "RX Date/Time";
-  for (const auto& pair : pairs)
-    m_textStream << ',' << pair.second;
+  // Resolve each dataset's column once, rows only look up slots by position
+  m_columnMaps.clear();
+  m_columnIndex.clear();
+  m_columnCount = static_cast<int>(pairs.count());
+  for (int i = 0; i < m_columnCount; ++i)
+    m_columnIndex.insert(pairs[i].first, i);
+
+  m_writeBuffer.clear();
+  m_writeBuffer.reserve(kWriteBlockSize + 64 * 1024);
+  m_writeBuffer.append("\xEF\xBB\xBF" "RX Date/Time");
+  for (const auto& pair : std::as_const(pairs)) {
+    m_writeBuffer.append(',');
+    m_writeBuffer.append(pair.second.toUtf8());
+  }
 
-  m_textStream << '\n';
+  m_writeBuffer.append('\n');
+  writeBuffer();
 
   Q_EMIT resourceOpenChanged();
-  return pairs;
+  return true;
+}
+
+/**
+ * @brief Returns the column slot of every value in a schema's value record.
+ *
+ * The map is built on first use and kept while its schema is alive.
+ * Multi-source projects alternate between a few per-source schemas, so a
+ * short linear search over the cached entries is enough. Schemas that only
+ * the cache still references (e.g. after the project changed) are evicted
+ * whenever a new map is built, so the cache never outgrows the live schemas.
+ *
+ * @param schema Schema of the frame being written.
+ * @return Column index per dataset (in schema order), or -1 if not exported.
+ */
+const std::vector<int>& CSV::ExportWorker::columnMap(const DataModel::FrameSchemaPtr& schema)
+{
+  for (const auto& entry : m_columnMaps)
+    if (entry.first == schema) [[likely]]
+      return entry.second;
+
+  // Drop the maps of schemas that no frame uses anymore
+  std::erase_if(m_columnMaps, [](const auto& entry) { return entry.first.use_count() == 1; });
+
+  std::vector<int> columns;
+  columns.reserve(DataModel::dataset_count(*schema));
+  for (const auto& g : schema->groups)
+    for (const auto& d : g.datasets)
+      columns.push_back(m_columnIndex.value(d.uniqueId, -1));
+
+  m_columnMaps.emplace_back(schema, std::move(columns));
+  return m_columnMaps.back().second;
+}
+
+/**
+ * @brief Formats a single frame as a CSV row at the end of the write buffer.
+ *
+ * Cells that arrived as text are written as received (simplified), so "1.50"
+ * stays "1.50". Values with no text form (native binary decoding, numbers
+ * returned by the frame parser, transform results) are printed with
+ * std::to_chars using 15 significant digits, straight into the buffer.
+ *
+ * @param frame Timestamped frame to write.
+ */
+void CSV::ExportWorker::appendRow(const DataModel::TimestampedFrame& frame)
+{
+  // Worst case for a double printed with 15 significant digits
+  constexpr qsizetype kMaxNumberLength = 32;
+
+  auto appendNumber = [this](double value, std::chars_format format, int precision) {
+    const auto size = m_writeBuffer.size();
+    m_writeBuffer.resize(size + kMaxNumberLength);
+    char* begin = m_writeBuffer.data() + size;
+    auto result = std::to_chars(begin, begin + kMaxNumberLength, value, format, precision);
+    m_writeBuffer.resize(size + (result.ec == std::errc() ? result.ptr - begin : 0));
+  };
+
+  const auto elapsed     = frame.timestamp - m_referenceTimestamp;
+  const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  const double seconds   = static_cast<double>(nanoseconds) / 1'000'000'000.0;
+  appendNumber(seconds, std::chars_format::fixed, 9);
+
+  // Place the frame's values in their columns (last write wins on duplicates)
+  m_rowCells.assign(m_columnCount, nullptr);
+  const auto& columns = columnMap(frame.schema);
+  const auto count    = std::min(columns.size(), frame.values.size());
+  for (size_t k = 0; k < count; ++k)
+    if (columns[k] >= 0)
+      m_rowCells[columns[k]] = &frame.values[k];
+
+  for (const auto* cell : m_rowCells) {
+    m_writeBuffer.append(',');
+    if (!cell)
+      continue;
+
+    if (cell->value.isEmpty() && cell->isNumeric) [[likely]]
+      appendNumber(cell->numericValue, std::chars_format::general, 15);
+    else
+      m_writeBuffer.append(cell->value.simplified().toUtf8());
+  }
+
+  m_writeBuffer.append('\n');
+}
+
+/**
+ * @brief Writes the pending contents of the write buffer to the CSV file.
+ */
+void CSV::ExportWorker::writeBuffer()
+{
+  if (m_writeBuffer.isEmpty())
+    return;
+
+  if (m_csvFile.write(m_writeBuffer) != m_writeBuffer.size()) [[unlikely]]
+    qWarning() << "[CSV] Failed to write to" << m_csvFile.fileName() << m_csvFile.errorString();
+
+  m_writeBuffer.resize(0);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -298,6 +390,23 @@ void CSV::Export::onWorkerOpenChanged()
   Q_EMIT openChanged();
 }
 
+/**
+ * @brief Caches the project frame used to register every CSV column upfront.
+ *
+ * Called when a device connects and when batch reprocessing starts. Only the
+ * template of ProjectFile mode is kept — QuickPlot/JSON builds the frame on
+ * the fly, so FrameBuilder::frame() may contain stale data from a previously
+ * loaded project.
+ */
+void CSV::Export::cacheTemplateFrame()
+{
+  auto* worker = static_cast<ExportWorker*>(m_worker);
+  if (AppState::instance().operationMode() == SerialStudio::ProjectFile)
+    worker->m_templateFrame = DataModel::FrameBuilder::instance().frame();
+  else
+    DataModel::clear_frame(worker->m_templateFrame);
+}
+
 /**
  * @brief Sets up connections with other modules.
  *
@@ -307,16 +416,8 @@ void CSV::Export::setupExternalConnections()
 {
   connect(
     &IO::ConnectionManager::instance(), &IO::ConnectionManager::connectedChanged, this, [this] {
-      if (IO::ConnectionManager::instance().isConnected()) {
-        // Only cache the template in ProjectFile mode — QuickPlot/JSON
-        // builds the frame on the fly, so FrameBuilder::frame() may
-        // contain stale data from a previously loaded project.
-        auto* worker = static_cast<ExportWorker*>(m_worker);
-        if (AppState::instance().operationMode() == SerialStudio::ProjectFile)
-          worker->m_templateFrame = DataModel::FrameBuilder::instance().frame();
-        else
-          DataModel::clear_frame(worker->m_templateFrame);
-      }
+      if (IO::ConnectionManager::instance().isConnected())
+        cacheTemplateFrame();
 
       else {
         closeFile();
@@ -22,10 +22,9 @@
 #pragma once
 
 #include <QFile>
+#include <QHash>
 #include <QObject>
-#include <QSet>
-#include <QTextStream>
-#include <QVector>
+#include <vector>
 
 #include "DataModel/Frame.h"
 #include "DataModel/FrameConsumer.h"
@@ -52,16 +51,23 @@ protected:
   void processItems(const std::vector<DataModel::TimestampedFramePtr>& items) override;
 
 private:
-  QVector<QPair<int, QString>> createCsvFile(const DataModel::Frame& frame);
+  [[nodiscard]] bool createCsvFile(const DataModel::Frame& frame);
+  [[nodiscard]] const std::vector<int>& columnMap(const DataModel::FrameSchemaPtr& schema);
+  void appendRow(const DataModel::TimestampedFrame& frame);
+  void writeBuffer();
 
 public:
   DataModel::Frame m_templateFrame;
 
 private:
+  static constexpr qsizetype kWriteBlockSize = 1 << 20;
+
   QFile m_csvFile;
-  QTextStream m_textStream;
-  QSet<int> m_knownUniqueIds;
-  QVector<QPair<int, QString>> m_indexHeaderPairs;
+  int m_columnCount = 0;
+  QByteArray m_writeBuffer;
+  QHash<int, int> m_columnIndex;
+  std::vector<const DataModel::DatasetValue*> m_rowCells;
+  std::vector<std::pair<DataModel::FrameSchemaPtr, std::vector<int>>> m_columnMaps;
   DataModel::TimestampedFrame::SteadyTimePoint m_referenceTimestamp;
 };
 
@@ -109,6 +115,7 @@ public:
 
 public slots:
   void closeFile();
+  void cacheTemplateFrame();
   void setupExternalConnections();
   void setExportEnabled(const bool enabled);
 
@@ -21,6 +21,8 @@
 
 #include "Player.h"
 
+#include <cstring>
+#include <limits>
 #include <QApplication>
 #include <QFileDialog>
 #include <QInputDialog>
@@ -47,6 +49,12 @@ CSV::Player::Player()
   , m_playing(false)
   , m_multiSource(false)
   , m_timestamp("")
+  , m_data(nullptr)
+  , m_dataSize(0)
+  , m_cachedRow(-1)
+  , m_timeSource(TimeSource::File)
+  , m_timeColumn(0)
+  , m_timeIntervalMs(0)
   , m_startTimestampSeconds(0.0)
   , m_useHighPrecisionTimestamps(false)
 {
@@ -103,13 +111,12 @@ bool CSV::Player::isPlaying() const
 //--------------------------------------------------------------------------------------------------
 
 /**
- * Returns the total number of frames in the CSV file. This can be calculated
- * by getting the number of rows of the CSV and substracting 1 (because the
- * title cells do not count as a valid frame).
+ * Returns the total number of frames in the CSV file, which is the number of
+ * indexed data rows (the header row is stored separately).
  */
 int CSV::Player::frameCount() const
 {
-  return m_csvData.count();
+  return static_cast<int>(m_rowOffsets.size());
 }
 
 /**
@@ -154,7 +161,7 @@ const QString& CSV::Player::timestamp() const
 void CSV::Player::play()
 {
   Q_ASSERT(isOpen());
-  Q_ASSERT(!m_csvData.isEmpty());
+  Q_ASSERT(!m_rowOffsets.empty());
 
   if (frameCount() <= 0)
     return;
@@ -166,8 +173,8 @@ void CSV::Player::play()
   m_startTimestamp = getDateTime(m_framePos);
   m_elapsedTimer.start();
 
-  if (m_useHighPrecisionTimestamps && m_framePos < m_timestampCache.size())
-    m_startTimestampSeconds = m_timestampCache[m_framePos];
+  if (m_useHighPrecisionTimestamps)
+    m_startTimestampSeconds = getTimestampSeconds(m_framePos);
 
   m_playing = true;
   Q_EMIT playerStateChanged();
@@ -180,7 +187,7 @@ void CSV::Player::play()
 void CSV::Player::pause()
 {
   Q_ASSERT(isOpen());
-  Q_ASSERT(!m_csvData.isEmpty());
+  Q_ASSERT(!m_rowOffsets.empty());
 
   m_playing = false;
   Q_EMIT playerStateChanged();
@@ -239,11 +246,25 @@ void CSV::Player::closeFile()
 
   m_playing  = false;
   m_framePos = 0;
+  if (m_data)
+    m_csvFile.unmap(const_cast<uchar*>(m_data));
+
   m_csvFile.close();
-  m_csvData.clear();
-  m_csvData.squeeze();
-  m_timestamp = "--.--";
+  m_data     = nullptr;
+  m_dataSize = 0;
+  m_headerRow.clear();
+  m_rowOffsets.clear();
+  m_rowOffsets.shrink_to_fit();
+  m_cachedRow = -1;
+  m_cachedCells.clear();
+  m_frameCells.clear();
+  m_sourceCells.clear();
+  m_timeSource     = TimeSource::File;
+  m_timeColumn     = 0;
+  m_timeIntervalMs = 0;
+  m_timestamp      = "--.--";
   m_timestampCache.clear();
+  m_timestampCache.squeeze();
   m_useHighPrecisionTimestamps = false;
   m_startTimestampSeconds      = 0.0;
   m_multiSource                = false;
@@ -304,39 +325,77 @@ void CSV::Player::previousFrame()
 }
 
 /**
- * @brief Reads all rows from a CSV text stream into m_csvData.
+ * @brief Maps the CSV file into memory and indexes the offset of every row.
  *
- * Splits each line on commas, strips whitespace and quotes, and discards
- * rows that contain only empty cells. Stops after kMaxCsvRows to prevent
- * unbounded memory growth.
+ * Only the header row is parsed here. Data rows are located with memchr() and
+ * recorded as byte offsets; their cells are split on demand by rowCells().
+ * Rows that contain nothing but separators, quotes and whitespace are skipped,
+ * matching what the player used to discard after parsing every cell.
  *
- * @param stream The QTextStream positioned at the start of the CSV content.
+ * @return @c true if the file could be mapped and has a header row.
  */
-void CSV::Player::parseCsvRows(QTextStream& stream)
+bool CSV::Player::indexRows()
 {
-  Q_ASSERT(stream.device() != nullptr);
-  Q_ASSERT(stream.device()->isOpen());
+  Q_ASSERT(m_csvFile.isOpen());
 
-  constexpr int kMaxCsvRows = 10'000'000;
+  m_dataSize = m_csvFile.size();
+  if (m_dataSize <= 0)
+    return false;
 
-  while (!stream.atEnd() && m_csvData.size() < kMaxCsvRows) {
-    QStringList row = stream.readLine().split(',');
+  m_data = m_csvFile.map(0, m_dataSize);
+  if (!m_data)
+    return false;
 
-    for (auto& item : row) {
-      item = item.simplified();
-      item.remove(QStringLiteral("\""));
+  // Skip the UTF-8 byte order mark written by CSV::Export
+  qint64 pos = 0;
+  if (m_dataSize >= 3 && std::memcmp(m_data, "\xEF\xBB\xBF", 3) == 0)
+    pos = 3;
+
+  auto lineEnd = [this](qint64 from) {
+    const auto* nl = static_cast<const uchar*>(std::memchr(m_data + from, '\n', m_dataSize - from));
+    return nl ? static_cast<qint64>(nl - m_data) : m_dataSize;
+  };
+
+  auto hasContent = [this](qint64 from, qint64 to) {
+    for (qint64 i = from; i < to; ++i) {
+      const auto c = m_data[i];
+      if (c != ',' && c != '"' && c != ' ' && (c < '\t' || c > '\r'))
+        return true;
     }
 
-    bool isRowValid =
-      !row.isEmpty()
-      && std::any_of(row.cbegin(), row.cend(), [](const QString& item) { return !item.isEmpty(); });
+    return false;
+  };
+
+  // Rough reservation from the header length avoids most reallocations
+  constexpr auto kMaxRows = static_cast<size_t>(std::numeric_limits<int>::max() - 1);
+  const qint64 headerEnd  = lineEnd(pos);
+  const qint64 lineLength = std::max<qint64>(16, headerEnd - pos);
+  m_rowOffsets.clear();
+  m_rowOffsets.reserve(static_cast<size_t>(std::min<qint64>(m_dataSize / lineLength, kMaxRows)));
+
+  bool haveHeader = false;
+  while (pos < m_dataSize) {
+    const qint64 end = lineEnd(pos);
+    if (hasContent(pos, end)) {
+      if (!haveHeader) {
+        m_headerRow = splitLine(pos);
+        haveHeader  = true;
+      }
+
+      else if (m_rowOffsets.size() < kMaxRows) [[likely]]
+        m_rowOffsets.push_back(pos);
+
+      else {
+        qWarning() << "[CSV::Player] Row limit reached:" << kMaxRows << "— file may be truncated";
+        break;
+      }
+    }
 
-    if (isRowValid)
-      m_csvData.append(row);
+    pos = end + 1;
   }
 
-  if (m_csvData.size() >= kMaxCsvRows) [[unlikely]]
-    qWarning() << "[CSV::Player] Row limit reached:" << kMaxCsvRows << "— file may be truncated";
+  m_rowOffsets.shrink_to_fit();
+  return haveHeader;
 }
 
 /**
@@ -353,32 +412,24 @@ void CSV::Player::parseCsvRows(QTextStream& stream)
  */
 void CSV::Player::initializeTimestamps()
 {
-  Q_ASSERT(!m_csvData.isEmpty());
+  Q_ASSERT(!m_rowOffsets.empty());
   Q_ASSERT(m_csvFile.isOpen());
 
   // Check for high-precision numeric timestamps
   bool error            = false;
-  QString firstCell     = getCellValue(1, 0, error);
+  QString firstCell     = getCellValue(0, 0, error);
   double firstTimestamp = error ? -1.0 : getTimestampSeconds(firstCell);
 
+  // The cache is filled incrementally by getTimestampSeconds(int)
   if (firstTimestamp >= 0.0) {
     m_timestampCache.clear();
-    m_timestampCache.reserve(m_csvData.count());
-
-    for (int i = 0; i < m_csvData.count(); ++i) {
-      bool err     = false;
-      QString cell = getCellValue(i, 0, err);
-      double ts    = err ? 0.0 : getTimestampSeconds(cell);
-      m_timestampCache.append(ts);
-    }
-
     m_useHighPrecisionTimestamps = true;
-    m_startTimestampSeconds      = (m_timestampCache.size() > 1) ? m_timestampCache[1] : 0.0;
+    m_startTimestampSeconds      = getTimestampSeconds(0);
     return;
   }
 
   // Check for standard date/time format
-  if (getDateTime(1).isValid()) {
+  if (getDateTime(0).isValid()) {
     m_useHighPrecisionTimestamps = false;
     m_timestampCache.clear();
     return;
@@ -433,12 +484,19 @@ void CSV::Player::openFile(const QString& filePath)
     return;
   }
 
-  QTextStream in(&m_csvFile);
-  parseCsvRows(in);
+  // Map the file and index its rows
+  if (!indexRows() || m_rowOffsets.empty()) {
+    Misc::Utilities::showMessageBox(tr("Insufficient Data in CSV File"),
+                                    tr("The CSV file must contain at least one data row to "
+                                       "proceed. Please check the file and try again."),
+                                    QMessageBox::Critical);
+    closeFile();
+    return;
+  }
 
-  // Detect timestamp format and build the cache
+  // Detect timestamp format
   initializeTimestamps();
-  if (!m_useHighPrecisionTimestamps && m_timestampCache.isEmpty() && !getDateTime(1).isValid()) {
+  if (!m_useHighPrecisionTimestamps && !getDateTime(0).isValid()) {
     if (!promptUserForDateTimeOrInterval()) {
       closeFile();
       return;
@@ -448,16 +506,9 @@ void CSV::Player::openFile(const QString& filePath)
   // Prepare playback state
   sendHeaderFrame();
   m_framePos = 0;
-  m_csvData.removeFirst();
-
-  if (m_useHighPrecisionTimestamps && !m_timestampCache.isEmpty()) {
-    m_timestampCache.removeFirst();
-    if (!m_timestampCache.isEmpty())
-      m_startTimestampSeconds = m_timestampCache[0];
-  }
 
   // Verify that at least one data row remains
-  if (m_csvData.count() >= 1) {
+  if (frameCount() >= 1) {
     updateData();
     Q_EMIT openChanged();
   } else {
@@ -577,7 +628,7 @@ void CSV::Player::updateTimestampDisplay()
  */
 void CSV::Player::updateData()
 {
-  Q_ASSERT(!m_csvData.isEmpty() || !isOpen());
+  Q_ASSERT(!m_rowOffsets.empty() || !isOpen());
   Q_ASSERT(m_framePos >= 0);
 
   // Nothing to do if no file is loaded
@@ -588,7 +639,7 @@ void CSV::Player::updateData()
   if (!isPlaying())
     return;
 
-  injectFrame(getFrame(framePosition()));
+  injectFrame(framePosition());
 
   if (framePosition() >= frameCount() - 1) {
     pause();
@@ -599,13 +650,13 @@ void CSV::Player::updateData()
   qint64 msUntilNext     = 0;
 
   if (m_useHighPrecisionTimestamps) {
-    if (framePosition() + 1 >= m_timestampCache.size()) {
+    if (framePosition() + 1 >= frameCount()) {
       pause();
       return;
     }
 
     const double targetTime = m_startTimestampSeconds + (elapsedMs / 1000.0);
-    const double nextTime   = m_timestampCache[framePosition() + 1];
+    const double nextTime   = getTimestampSeconds(framePosition() + 1);
     msUntilNext             = qMax(0LL, static_cast<qint64>((nextTime - targetTime) * 1000.0));
   }
 
@@ -625,13 +676,13 @@ void CSV::Player::updateData()
     int processed               = 0;
     while (m_framePos < frameCount() - 1 && processed < kMaxBatchSize && msUntilNext <= 0) {
       ++m_framePos;
-      injectFrame(getFrame(m_framePos));
+      injectFrame(m_framePos);
       ++processed;
 
       if (m_useHighPrecisionTimestamps) {
-        if (m_framePos + 1 < m_timestampCache.size()) {
+        if (m_framePos + 1 < frameCount()) {
           const double target = m_startTimestampSeconds + (m_elapsedTimer.elapsed() / 1000.0);
-          const double next   = m_timestampCache[m_framePos + 1];
+          const double next   = getTimestampSeconds(m_framePos + 1);
           msUntilNext         = qMax(0LL, static_cast<qint64>((next - target) * 1000.0));
         }
 
@@ -694,7 +745,7 @@ void CSV::Player::processFrameBatch(int startFrame, int endFrame)
     return;
 
   for (int i = startFrame; i <= endFrame; ++i)
-    injectFrame(getFrame(i));
+    injectFrame(i);
 }
 
 /**
@@ -702,16 +753,15 @@ void CSV::Player::processFrameBatch(int startFrame, int endFrame)
  *
  * Extracts column names from the CSV header row and explicitly registers
  * them with the FrameBuilder. Skips the first column (timestamp) as it
- * is not used for plotting. This should be called before the header row
- * is removed from m_csvData.
+ * is not used for plotting.
  */
 void CSV::Player::sendHeaderFrame()
 {
-  // Need at least one row for headers
-  if (m_csvData.isEmpty())
+  // Need a header row
+  if (m_headerRow.isEmpty())
     return;
 
-  const auto& headerRow = m_csvData.first();
+  const auto& headerRow = m_headerRow;
   if (headerRow.size() <= 1)
     return;
 
@@ -747,14 +797,14 @@ void CSV::Player::sendHeaderFrame()
 bool CSV::Player::promptUserForDateTimeOrInterval()
 {
   // Validate that CSV contains headers before prompting
-  if (m_csvData.isEmpty() || m_csvData.first().isEmpty()) {
+  if (m_rowOffsets.empty() || m_headerRow.isEmpty()) {
     Misc::Utilities::showMessageBox(tr("Invalid CSV"),
                                     tr("The CSV file does not contain any data or headers."),
                                     QMessageBox::Critical);
     return false;
   }
 
-  const auto headerLabels = m_csvData.first().toList();
+  const auto headerLabels = m_headerRow;
 
   bool ok;
   QStringList options;
@@ -816,37 +866,31 @@ bool CSV::Player::promptUserForDateTimeOrInterval()
 /**
  * @brief Generates date/time values for each row based on a fixed interval.
  *
- * This function generates date/time strings starting from the current time
- * and increments them by a user-specified interval in milliseconds. It then
- * prepends the generated date/time string to each row of the CSV data.
+ * Timestamps start at the current time and advance by a user-specified
+ * interval in milliseconds. They are not stored: rowCells() synthesizes the
+ * date/time string and prepends it to each row when the row is read.
  *
  * @param interval The interval in milliseconds between each row.
  */
 void CSV::Player::generateDateTimeForRows(int interval)
 {
   // Synthesize evenly-spaced timestamps for rows lacking date/time
-  const auto startTime = QDateTime::currentDateTime();
-  const auto format    = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-
-  for (int i = 0; i < m_csvData.size(); ++i) {
-    QString dateTimeString = startTime.addMSecs(static_cast<qint64>(i) * interval).toString(format);
-    m_csvData[i].prepend(dateTimeString);
-  }
+  m_timeSource        = TimeSource::Interval;
+  m_timeIntervalMs    = interval;
+  m_timeIntervalStart = QDateTime::currentDateTime();
+  m_cachedRow         = -1;
+  m_headerRow.prepend(QStringLiteral("RX Date/Time"));
 }
 
 /**
- * @brief Converts the specified column in the CSV data to a date/time format
- *        and moves it to the start of each row.
+ * @brief Uses the specified column as the date/time source of every row.
  *
- * This function processes the specified column (excluding the header row) in
- * the CSV data and converts each value to a `QDateTime` object using the
- * formats defined in the `getDateTime` function. If a valid `QDateTime` is not
- * found, the current date/time is used. The converted date/time string is then
- * moved to the start of each row.
+ * When a row is read, rowCells() converts the value in the selected column
+ * to a `QDateTime` using the formats defined in the `getDateTime` function
+ * (falling back to the current date/time) and moves it, as a formatted
+ * string, to the start of the row.
  *
- * The header row (row 0) is excluded from this operation to ensure it remains
- * intact. The selected column is removed from its original position and moved
- * to the start of the row as a formatted date/time string.
+ * The header row is left intact.
  *
  * @param columnIndex The index of the column to convert and move to the start
  * of each row.
@@ -854,23 +898,12 @@ void CSV::Player::generateDateTimeForRows(int interval)
 void CSV::Player::convertColumnToDateTime(int columnIndex)
 {
   // Validate column index against header row
-  if (m_csvData.isEmpty() || columnIndex < 0
-      || columnIndex >= m_csvData.first().size())
+  if (m_headerRow.isEmpty() || columnIndex < 0 || columnIndex >= m_headerRow.size())
     return;
 
-  // Rewrite each row so the chosen column becomes the leading timestamp
-  const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
-  for (int i = 1; i < m_csvData.size(); ++i) {
-    // Read the timestamp from the user-selected column, not column 0
-    bool error    = false;
-    auto cellText = getCellValue(i, columnIndex, error);
-    auto dateTime = error ? QDateTime() : getDateTime(cellText);
-    if (!dateTime.isValid())
-      dateTime = QDateTime::currentDateTime();
-
-    m_csvData[i].remove(columnIndex);
-    m_csvData[i].prepend(dateTime.toString(format));
-  }
+  m_timeSource = TimeSource::Column;
+  m_timeColumn = columnIndex;
+  m_cachedRow  = -1;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -951,9 +984,27 @@ QDateTime CSV::Player::getDateTime(const QString& cell)
  */
 double CSV::Player::getTimestampSeconds(int row)
 {
-  // Use cached timestamp if available, otherwise parse from cell
-  if (m_useHighPrecisionTimestamps && row >= 0 && row < m_timestampCache.size())
+  // Extend the timestamp cache up to the requested row, parsing only column 0
+  if (m_useHighPrecisionTimestamps && row >= 0 && row < frameCount()) {
+    if (row >= m_timestampCache.size()) {
+      while (m_timestampCache.size() <= row) {
+        const auto offset = m_rowOffsets[m_timestampCache.size()];
+        const auto* comma = static_cast<const uchar*>(
+          std::memchr(m_data + offset, ',', m_dataSize - offset));
+        const auto* nl = static_cast<const uchar*>(
+          std::memchr(m_data + offset, '\n', m_dataSize - offset));
+        const auto* end = comma && (!nl || comma < nl) ? comma : (nl ? nl : m_data + m_dataSize);
+
+        auto cell = QString::fromUtf8(reinterpret_cast<const char*>(m_data + offset),
+                                      static_cast<qsizetype>(end - (m_data + offset)))
+                      .simplified();
+        cell.remove(QStringLiteral("\""));
+        m_timestampCache.append(getTimestampSeconds(cell));
+      }
+    }
+
     return m_timestampCache[row];
+  }
 
   bool error   = false;
   QString cell = getCellValue(row, 0, error);
@@ -1016,13 +1067,13 @@ QString CSV::Player::formatTimestamp(double seconds) const
 QByteArray CSV::Player::getFrame(const int row)
 {
   Q_ASSERT(row >= 0);
-  Q_ASSERT(row < m_csvData.count());
+  Q_ASSERT(row < frameCount());
 
   // Timestamp column (index 0) is excluded from the data frame
   QByteArray frame;
 
-  if (m_csvData.count() > row) {
-    const auto& list = m_csvData[row];
+  if (row >= 0 && row < frameCount()) {
+    const auto& list = rowCells(row);
     for (int i = 1; i < list.count(); ++i) {
       frame.append(list[i].toUtf8());
       if (i < list.count() - 1)
@@ -1035,6 +1086,66 @@ QByteArray CSV::Player::getFrame(const int row)
   return frame;
 }
 
+/**
+ * @brief Splits the line that starts at byte offset @a begin into cells.
+ *
+ * Strips whitespace and quotes from every cell, as the player has always done.
+ */
+QStringList CSV::Player::splitLine(qint64 begin) const
+{
+  Q_ASSERT(m_data);
+  Q_ASSERT(begin >= 0 && begin < m_dataSize);
+
+  const auto* nl = static_cast<const uchar*>(std::memchr(m_data + begin, '\n', m_dataSize - begin));
+  const qint64 end = nl ? static_cast<qint64>(nl - m_data) : m_dataSize;
+
+  auto cells = QString::fromUtf8(reinterpret_cast<const char*>(m_data + begin),
+                                 static_cast<qsizetype>(end - begin))
+                 .split(',');
+
+  for (auto& item : cells) {
+    item = item.simplified();
+    item.remove(QStringLiteral("\""));
+  }
+
+  return cells;
+}
+
+/**
+ * @brief Returns the cells of data row @a row, parsing it on first access.
+ *
+ * The most recently parsed row is cached, since the timestamp display and the
+ * frame injection usually read the same row back to back. The configured
+ * TimeSource is applied here, so column 0 always holds the row's timestamp.
+ */
+const QStringList& CSV::Player::rowCells(const int row)
+{
+  Q_ASSERT(row >= 0 && row < frameCount());
+
+  if (row == m_cachedRow)
+    return m_cachedCells;
+
+  m_cachedRow   = row;
+  m_cachedCells = splitLine(m_rowOffsets[row]);
+
+  if (m_timeSource == TimeSource::Interval) {
+    const auto format = QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz");
+    const auto offset = static_cast<qint64>(row + 1) * m_timeIntervalMs;
+    m_cachedCells.prepend(m_timeIntervalStart.addMSecs(offset).toString(format));
+  }
+
+  else if (m_timeSource == TimeSource::Column && m_timeColumn < m_cachedCells.size()) {
+    auto dateTime = getDateTime(m_cachedCells[m_timeColumn]);
+    if (!dateTime.isValid())
+      dateTime = QDateTime::currentDateTime();
+
+    m_cachedCells.remove(m_timeColumn);
+    m_cachedCells.prepend(dateTime.toString(QStringLiteral("yyyy/MM/dd HH:mm:ss::zzz")));
+  }
+
+  return m_cachedCells;
+}
+
 /**
  * Safely returns the value in the cell at the given @a row & @a column. If an
  * error occurs or the cell does not exist, the value of @a error shall be set
@@ -1048,8 +1159,8 @@ const QString CSV::Player::getCellValue(const int row, const int column, bool& e
   // Return empty string on out-of-bounds access
   static auto defaultValue = QLatin1String("");
 
-  if (m_csvData.count() > row) {
-    const auto& list = m_csvData[row];
+  if (row >= 0 && row < frameCount()) {
+    const auto& list = rowCells(row);
     if (list.count() > column) {
       error = false;
       return list[column];
@@ -1100,44 +1211,50 @@ void CSV::Player::buildMultiSourceMapping()
 }
 
 /**
- * @brief Injects a CSV frame through the appropriate pipeline path.
+ * @brief Injects data row @a row into the frame pipeline.
  *
- * For single-source or non-project mode, delegates to processPayload().
- * For multi-source project mode, splits the CSV row by source and calls
- * processMultiSourcePayload().
+ * The row's cells are handed straight to FrameBuilder, split by source in
+ * multi-source project mode, so they are never joined into a CSV line and
+ * parsed again. The joined line is only built for the console and the other
+ * raw-data consumers.
  *
- * @param frame CSV-formatted byte array (without timestamp column).
+ * @param row Index of the data row to inject.
  */
-void CSV::Player::injectFrame(const QByteArray& frame)
+void CSV::Player::injectFrame(const int row)
 {
-  // Skip empty frames
+  // Skip rows without data columns
+  const auto frame = getFrame(row);
   if (frame.isEmpty())
     return;
 
-  // Single-source: use standard path
+  static auto& frameBuilder = DataModel::FrameBuilder::instance();
+  IO::ConnectionManager::instance().echoPayload(frame);
+
+  // Timestamp column (index 0) is excluded from the data frame
+  const auto& cells = rowCells(row);
+  m_frameCells      = cells.mid(1);
+
+  // Single-source: the whole row feeds the frame
   if (!m_multiSource) {
-    IO::ConnectionManager::instance().processPayload(frame);
+    frameBuilder.hotpathRxPlaybackFrame(m_frameCells);
     return;
   }
 
   // Multi-source: split CSV columns by source
-  const auto fields = QString::fromUtf8(frame).trimmed().split(',');
+  for (auto& list : m_sourceCells)
+    list.clear();
 
-  QMap<int, QStringList> sourceFields;
-  for (int col = 0; col < fields.size(); ++col) {
+  for (int col = 0; col < m_frameCells.size(); ++col) {
     auto it = m_columnToSource.find(col);
     if (it == m_columnToSource.end())
       continue;
 
-    sourceFields[it.value()].append(fields[col]);
+    m_sourceCells[it.value()].append(m_frameCells[col]);
   }
 
-  // Build per-source payloads
-  QMap<int, QByteArray> sourcePayloads;
-  for (auto it = sourceFields.constBegin(); it != sourceFields.constEnd(); ++it)
-    sourcePayloads[it.key()] = it.value().join(',').toUtf8() + '\n';
-
-  IO::ConnectionManager::instance().processMultiSourcePayload(frame, sourcePayloads);
+  for (auto it = m_sourceCells.constBegin(); it != m_sourceCells.constEnd(); ++it)
+    if (!it.value().isEmpty())
+      frameBuilder.hotpathRxPlaybackFrame(it.key(), it.value());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #include <QMap>
 #include <QObject>
 #include <QVector>
+#include <vector>
 
 namespace CSV {
 /**
@@ -101,7 +102,7 @@ private:
   void sendHeaderFrame();
   void updateTimestampDisplay();
   void processFrameBatch(int startFrame, int endFrame);
-  void parseCsvRows(QTextStream& stream);
+  [[nodiscard]] bool indexRows();
   void initializeTimestamps();
 
 private:
@@ -117,6 +118,8 @@ private:
 
   QByteArray getFrame(const int row);
 
+  [[nodiscard]] QStringList splitLine(qint64 begin) const;
+  [[nodiscard]] const QStringList& rowCells(const int row);
   const QString getCellValue(const int row, const int column, bool& error);
 
 protected:
@@ -125,15 +128,39 @@ protected:
 
 private:
   void buildMultiSourceMapping();
-  void injectFrame(const QByteArray& frame);
+  void injectFrame(const int row);
 
 private:
+  /**
+   * @brief Where the timestamp (column 0) of each row comes from.
+   */
+  enum class TimeSource {
+    File,      ///< First column of the file
+    Interval,  ///< Synthesized at a fixed interval, prepended to each row
+    Column,    ///< User-selected column, converted and moved to the front
+  };
+
   int m_framePos;
   bool m_playing;
   bool m_multiSource;
   QFile m_csvFile;
   QString m_timestamp;
-  QList<QStringList> m_csvData;
+
+  const uchar* m_data;
+  qint64 m_dataSize;
+  QStringList m_headerRow;
+  std::vector<qint64> m_rowOffsets;
+
+  int m_cachedRow;
+  QStringList m_cachedCells;
+
+  QStringList m_frameCells;
+  QMap<int, QStringList> m_sourceCells;
+
+  TimeSource m_timeSource;
+  int m_timeColumn;
+  int m_timeIntervalMs;
+  QDateTime m_timeIntervalStart;
 
   QElapsedTimer m_elapsedTimer;
   QDateTime m_startTimestamp;
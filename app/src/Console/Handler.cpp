@@ -21,6 +21,7 @@
 
 #include "Console/Handler.h"
 
+#include <algorithm>
 #include <QApplication>
 #include <QDateTime>
 #include <QFile>
@@ -29,6 +30,7 @@
 #include <QFontMetrics>
 
 #include "AppState.h"
+#include "Console/Export.h"
 #include "DataModel/ProjectModel.h"
 #include "IO/Checksum.h"
 #include "IO/ConnectionManager.h"
@@ -37,6 +39,36 @@
 #include "Misc/Translator.h"
 #include "SerialStudio.h"
 
+//--------------------------------------------------------------------------------------------------
+// Helper functions
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the number of trailing bytes that form an incomplete UTF-8
+ *        sequence, so they can be decoded once the rest of it arrives.
+ */
+static qsizetype incompleteUtf8Tail(QByteArrayView data)
+{
+  const qsizetype size = data.size();
+  for (qsizetype i = 1; i <= std::min<qsizetype>(3, size); ++i) {
+    const auto c = static_cast<quint8>(data[size - i]);
+    if ((c & 0xC0) == 0x80)
+      continue;
+
+    qsizetype length = 1;
+    if ((c & 0xE0) == 0xC0)
+      length = 2;
+    else if ((c & 0xF0) == 0xE0)
+      length = 3;
+    else if ((c & 0xF8) == 0xF0)
+      length = 4;
+
+    return length > i ? i : 0;
+  }
+
+  return 0;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Constructor & singleton access
 //--------------------------------------------------------------------------------------------------
@@ -56,11 +88,10 @@ Console::Handler::Handler()
   , m_ansiColorsEnabled(false)
   , m_vt100Emulation(true)
   , m_ansiColors(true)
-  , m_isStartingLine(true)
-  , m_lastCharWasCR(false)
+  , m_clearPending(false)
   , m_currentDeviceId(-1)
   , m_fontFamilyIndex(0)
-  , m_textBuffer(10 * 1024)
+  , m_timestampMs(-1)
 {
   // Restore persisted settings
   clear();
@@ -93,12 +124,10 @@ Console::Handler::Handler()
   m_ansiColorsEnabled = m_vt100Emulation && m_ansiColors;
   m_fontFamilyIndex   = availableFonts().indexOf(m_fontFamily);
 
-  connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::uiTimeout, this, [this]() {
-    if (!m_pendingDisplay.isEmpty()) {
-      Q_EMIT displayString(m_pendingDisplay);
-      m_pendingDisplay.clear();
-    }
-  });
+  connect(&Misc::TimerEvents::instance(),
+          &Misc::TimerEvents::uiTimeout,
+          this,
+          &Console::Handler::flushDisplay);
 
   updateFont();
 }
@@ -405,11 +434,12 @@ int Console::Handler::defaultCharHeight() const
 //--------------------------------------------------------------------------------------------------
 
 /**
- * Returns the number of bytes stored in the console buffer.
+ * Returns the number of raw bytes stored for the device shown by the console.
  */
 qsizetype Console::Handler::bufferLength() const
 {
-  return m_textBuffer.size();
+  const auto it = m_logs.find(m_currentDeviceId);
+  return it != m_logs.end() ? it->second.bytes.size() : 0;
 }
 
 /**
@@ -460,22 +490,38 @@ QString Console::Handler::formatUserHex(const QString& text)
  */
 void Console::Handler::clear()
 {
-  // Reset the text buffer and line state
-  m_textBuffer.clear();
-  m_isStartingLine = true;
-  m_lastCharWasCR  = false;
-
-  // Clear the current device's per-device state
-  auto it = m_deviceState.find(m_currentDeviceId);
-  if (it != m_deviceState.end()) {
-    it->second.buffer.clear();
-    it->second.isStartingLine = true;
-    it->second.lastCharWasCR  = false;
-  }
+  // Drop the stored bytes of the current device and any text not yet shown
+  auto& log = currentLog();
+  log.bytes.clear();
+  log.marks.clear();
+  log.lineStarts.clear();
+  log.displayed      = log.written;
+  log.isStartingLine = true;
+  log.lastCharWasCR  = false;
+
+  m_pendingDisplay.clear();
+  m_clearPending = false;
 
   Q_EMIT cleared();
 }
 
+/**
+ * @brief Registers whether a terminal @a view is currently visible.
+ *
+ * Received data is only formatted while at least one view is visible; hidden
+ * views catch up on the tail of the log once they are shown again.
+ */
+void Console::Handler::setViewVisible(QObject* view, const bool visible)
+{
+  if (!view)
+    return;
+
+  if (!m_views.contains(view))
+    connect(view, &QObject::destroyed, this, [this, view] { m_views.remove(view); });
+
+  m_views.insert(view, visible);
+}
+
 /**
  * Comamnds sent by the user are stored in a @c QStringList, in which the first
  * items are the oldest commands.
@@ -634,6 +680,7 @@ void Console::Handler::setAnsiColorsEnabled(const bool enabled)
 {
   if (ansiColorsEnabled() != enabled) {
     m_ansiColorsEnabled = enabled;
+    m_timestampMs       = -1;
     Q_EMIT ansiColorsEnabledChanged();
   }
 }
@@ -800,6 +847,9 @@ void Console::Handler::setEncoding(const int encoding)
 /**
  * Inserts the given @a string into the list of lines of the console, if @a
  * addTimestamp is set to @c true, an timestamp is added for each line.
+ *
+ * Raw data received before the string is formatted first, so the console
+ * keeps the order in which both arrived.
  */
 void Console::Handler::append(const QString& string, const bool addTimestamp)
 {
@@ -807,69 +857,20 @@ void Console::Handler::append(const QString& string, const bool addTimestamp)
   if (string.isEmpty())
     return;
 
-  // Normalize line endings
-  auto data = string;
-  if (m_lastCharWasCR && data.startsWith('\n'))
-    data.removeFirst();
-
-  m_lastCharWasCR = data.endsWith('\r');
-
-  data = data.replace(QStringLiteral("\r\n"), QStringLiteral("\n"));
-  data = data.replace(QStringLiteral("\r"), QStringLiteral("\n"));
+  auto& log = currentLog();
+  catchUpDisplay(log);
 
   QString timestamp;
-  if (addTimestamp) {
-    QDateTime dateTime    = QDateTime::currentDateTime();
-    const QString timeStr = dateTime.toString(QStringLiteral("HH:mm:ss.zzz -> "));
-
-    if (ansiColorsEnabled()) {
-      const QString ansiCyan  = QStringLiteral("\033[36m");
-      const QString ansiReset = QStringLiteral("\033[0m");
-      timestamp               = QStringLiteral("%1%2%3").arg(ansiCyan, timeStr, ansiReset);
-    }
-
-    else {
-      timestamp = timeStr;
-    }
-  }
-
-  QString processedString;
-  processedString.reserve(data.length() + timestamp.length() * 4);
+  if (addTimestamp)
+    timestamp = timestampString(QDateTime::currentMSecsSinceEpoch());
 
-  // Single-pass newline scan to avoid O(n^2) QStringList removal
-  int pos = 0;
-  while (pos < data.length()) {
-    const int nlPos = data.indexOf('\n', pos);
-    const int end   = (nlPos < 0) ? data.length() : nlPos;
-
-    // Process the segment before the newline (or remaining text)
-    if (end > pos) {
-      const auto segment = QStringView(data).mid(pos, end - pos);
-      if (m_isStartingLine && !segment.trimmed().isEmpty())
-        processedString.append(timestamp);
+  formatLines(log, string, timestamp, m_pendingDisplay);
 
-      processedString.append(segment);
-      m_isStartingLine = false;
-    }
-
-    // Append the newline itself
-    if (nlPos >= 0) {
-      if (m_isStartingLine)
-        processedString.append(timestamp);
-
-      processedString.append('\n');
-      m_isStartingLine = true;
-      pos              = nlPos + 1;
-    }
-
-    else
-      pos = end;
+  // Bound the text kept for a hidden console
+  if (m_pendingDisplay.size() > kMaxDisplay) {
+    m_pendingDisplay.remove(0, m_pendingDisplay.size() - kMaxDisplay);
+    m_clearPending = true;
   }
-
-  m_textBuffer.append(processedString.toUtf8());
-
-  // Buffer for throttled display (flushed by m_displayFlushTimer)
-  m_pendingDisplay.append(processedString);
 }
 
 /**
@@ -885,35 +886,33 @@ void Console::Handler::displayDebugData(const QString& data)
  */
 void Console::Handler::hotpathRxData(const IO::ByteArrayPtr& data)
 {
-  if (!data)
+  if (!data || data->isEmpty())
     return;
 
-  append(dataToString(*data), showTimestamp());
+  appendRaw(currentLog(), *data);
 }
 
 /**
- * @brief Routes incoming raw data to the per-device console buffer.
+ * @brief Routes incoming raw data to the per-device console log.
  *
- * Converts raw bytes to a display string, appends to the device's buffer,
- * and if this device is currently selected, displays it live.
+ * The bytes are stored unformatted; they are converted to text when a
+ * terminal shows this device, or right away when console export is enabled.
  *
  * @param deviceId Source device identifier.
  * @param data     Raw incoming bytes.
  */
 void Console::Handler::hotpathRxDeviceData(int deviceId, const IO::ByteArrayPtr& data)
 {
-  if (!data)
+  if (!data || data->isEmpty())
     return;
 
-  const auto str = dataToString(*data);
-  if (str.isEmpty())
-    return;
+  appendRaw(deviceLog(deviceId), *data);
 
-  // Store in per-device buffer
-  appendToDevice(deviceId, str, showTimestamp());
-
-  // Always emit for export
-  Q_EMIT deviceDataReady(deviceId, str);
+  if (Console::Export::instance().exportEnabled()) {
+    const auto str = dataToString(*data);
+    if (!str.isEmpty())
+      Q_EMIT deviceDataReady(deviceId, str);
+  }
 }
 
 /**
@@ -932,12 +931,13 @@ void Console::Handler::displaySentData(QByteArrayView data)
  */
 void Console::Handler::displaySentData(int deviceId, QByteArrayView data)
 {
-  if (!echo())
+  if (!echo() || data.isEmpty())
     return;
 
-  const auto str = dataToString(data);
-  appendToDevice(deviceId, str, showTimestamp());
-  Q_EMIT deviceDataReady(deviceId, str);
+  appendRaw(deviceLog(deviceId), data);
+
+  if (Console::Export::instance().exportEnabled())
+    Q_EMIT deviceDataReady(deviceId, dataToString(data));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -971,8 +971,9 @@ const QStringList& Console::Handler::deviceNames() const noexcept
 /**
  * @brief Switches the console view to the given @p deviceId.
  *
- * Guard-returns if unchanged. Clears the display, replays the selected
- * device's buffer, and emits currentDeviceIdChanged().
+ * Guard-returns if unchanged. Clears the display, rewinds the selected
+ * device's log to the last lines a terminal can show (they are formatted on
+ * the next display flush), and emits currentDeviceIdChanged().
  */
 void Console::Handler::setCurrentDeviceId(int deviceId)
 {
@@ -982,17 +983,15 @@ void Console::Handler::setCurrentDeviceId(int deviceId)
 
   m_currentDeviceId = deviceId;
 
-  // Replay the selected device's buffer
-  m_textBuffer.clear();
-  m_isStartingLine = true;
-  m_lastCharWasCR  = false;
+  // Replay the tail of the selected device's log
+  m_pendingDisplay.clear();
+  m_clearPending = false;
   Q_EMIT cleared();
 
-  auto it = m_deviceState.find(m_currentDeviceId);
-  if (it != m_deviceState.end() && !it->second.buffer.isEmpty()) {
-    m_textBuffer.append(it->second.buffer.toUtf8());
-    Q_EMIT displayString(it->second.buffer);
-  }
+  auto& log          = currentLog();
+  log.displayed      = displayStart(log);
+  log.isStartingLine = true;
+  log.lastCharWasCR  = false;
 
   Q_EMIT currentDeviceIdChanged();
 }
@@ -1041,7 +1040,7 @@ void Console::Handler::onDevicesChanged()
 
   // If not connected, clear all device state
   if (!mgr.isConnected()) {
-    m_deviceState.clear();
+    m_logs.clear();
     m_currentDeviceId = -1;
     Q_EMIT deviceNamesChanged();
     Q_EMIT currentDeviceIdChanged();
@@ -1062,94 +1061,299 @@ void Console::Handler::onDevicesChanged()
 //--------------------------------------------------------------------------------------------------
 
 /**
- * @brief Appends a string to the per-device buffer and optionally displays it.
+ * @brief Returns true if at least one terminal showing the console is visible.
+ */
+bool Console::Handler::hasVisibleView() const
+{
+  for (auto it = m_views.cbegin(); it != m_views.cend(); ++it)
+    if (it.value())
+      return true;
+
+  return false;
+}
+
+/**
+ * @brief Formats the data received since the last flush and sends it to the
+ *        terminals.
+ *
+ * Called at the UI refresh rate. Does nothing while no terminal is visible:
+ * the raw bytes wait in the log and only the part that fits on a terminal is
+ * formatted once one is shown.
+ */
+void Console::Handler::flushDisplay()
+{
+  if (!hasVisibleView())
+    return;
+
+  catchUpDisplay(currentLog());
+
+  if (m_clearPending) {
+    m_clearPending = false;
+    Q_EMIT cleared();
+  }
+
+  if (!m_pendingDisplay.isEmpty()) {
+    Q_EMIT displayString(m_pendingDisplay);
+    m_pendingDisplay.clear();
+  }
+}
+
+/**
+ * @brief Formats the undisplayed part of @p log into the pending display text.
+ *
+ * If more data arrived than a terminal can hold, the older part is skipped and
+ * the terminal is cleared before the tail is shown.
+ */
+void Console::Handler::catchUpDisplay(ConsoleLog& log)
+{
+  if (log.displayed >= log.written)
+    return;
+
+  const auto start = displayStart(log);
+  if (start > log.displayed) {
+    m_pendingDisplay.clear();
+    m_clearPending     = true;
+    log.isStartingLine = true;
+    log.lastCharWasCR  = false;
+  }
+
+  formatLog(log, std::max(start, log.displayed), m_pendingDisplay);
+}
+
+/**
+ * @brief Stores raw @p data in @p log and updates its index.
  *
- * The display string is processed through the same timestamp/newline logic as
- * append(), but state is tracked per-device. If the device is the currently
- * selected one, the processed string is also shown live in the console.
+ * Records the arrival time (one mark per millisecond) and the offset of every
+ * line start. A line ends with LF, CR LF or a lone CR, including a CR at the
+ * end of the previous chunk. No text conversion happens here.
+ */
+void Console::Handler::appendRaw(ConsoleLog& log, QByteArrayView data)
+{
+  const qsizetype size = data.size();
+  if (size <= 0)
+    return;
+
+  // Record the arrival time of the chunk
+  const qint64 now = QDateTime::currentMSecsSinceEpoch();
+  if (log.marks.empty() || log.marks.back().timeMs != now)
+    log.marks.push_back({log.written, now});
+
+  // Index the line starts
+  const char* bytes = data.data();
+  if (log.rawEndsWithCR && bytes[0] != '\n')
+    log.lineStarts.push_back(log.written);
+
+  for (qsizetype i = 0; i < size; ++i) {
+    const char c = bytes[i];
+    if (c == '\n' || (c == '\r' && i + 1 < size && bytes[i + 1] != '\n'))
+      log.lineStarts.push_back(log.written + i + 1);
+  }
+
+  log.rawEndsWithCR = bytes[size - 1] == '\r';
+
+  // Keep one byte free, since a completely full ring reads as empty
+  constexpr qsizetype kUsable = kLogCapacity - 1;
+  const auto stored           = size > kUsable ? data.last(kUsable) : data;
+  const qsizetype overflow    = log.bytes.size() + stored.size() - kUsable;
+  if (overflow > 0)
+    log.bytes.skip(overflow);
+
+  log.bytes.append(QByteArray::fromRawData(stored.data(), stored.size()));
+  log.written += static_cast<quint64>(size);
+
+  // Forget index entries that refer to overwritten data
+  const quint64 ringStart = log.written - static_cast<quint64>(log.bytes.size());
+  while (log.marks.size() > 1 && log.marks[1].offset <= ringStart)
+    log.marks.pop_front();
+
+  while (!log.lineStarts.empty()
+         && (log.lineStarts.front() < ringStart || log.lineStarts.size() > kMaxDisplayLines))
+    log.lineStarts.pop_front();
+}
+
+/**
+ * @brief Converts the bytes of @p log from offset @p from to the end of the
+ *        log into display text, and appends it to @p out.
  *
- * @param deviceId    Target device ID.
- * @param str         The string to append.
- * @param addTimestamp Whether to prepend timestamps.
+ * Without timestamps, plain text is decoded in one pass. Otherwise the data is
+ * split at the arrival marks, so every line gets the time its first byte was
+ * received and HEX dumps keep one block per arrival. An incomplete UTF-8
+ * sequence at the end is left in the log until the rest of it arrives.
  */
-void Console::Handler::appendToDevice(int deviceId, const QString& str, bool addTimestamp)
+void Console::Handler::formatLog(ConsoleLog& log, quint64 from, QString& out)
 {
-  if (str.isEmpty())
+  const quint64 ringStart = log.written - static_cast<quint64>(log.bytes.size());
+  from                    = std::max(from, ringStart);
+  if (from >= log.written)
     return;
 
-  // Get or create per-device state
-  auto& state = m_deviceState[deviceId];
+  quint64 to = log.written;
+  auto bytes = log.bytes.peekRange(static_cast<qsizetype>(from - ringStart),
+                                   static_cast<qsizetype>(to - from));
 
-  // Process the string through timestamp/newline logic
-  auto data = str;
-  if (state.lastCharWasCR && data.startsWith('\n'))
-    data.removeFirst();
+  const bool plainText = displayMode() == DisplayMode::DisplayPlainText;
+  if (plainText && m_encoding == SerialStudio::EncUtf8) {
+    const auto held = incompleteUtf8Tail(bytes);
+    bytes.chop(held);
+    to -= static_cast<quint64>(held);
+  }
 
-  state.lastCharWasCR = data.endsWith('\r');
+  // Fast path, a single decode and line ending pass
+  const bool timestamps = showTimestamp();
+  if (plainText && !timestamps) {
+    formatLines(log, dataToString(bytes), QStringView(), out);
+    log.displayed = to;
+    return;
+  }
 
-  data = data.replace(QStringLiteral("\r\n"), QStringLiteral("\n"));
-  data = data.replace(QStringLiteral("\r"), QStringLiteral("\n"));
+  // Format each arrival segment on its own
+  auto it = std::upper_bound(
+    log.marks.cbegin(), log.marks.cend(), from, [](quint64 offset, const ArrivalMark& mark) {
+      return offset < mark.offset;
+    });
 
-  QString timestamp;
-  if (addTimestamp) {
-    QDateTime dateTime    = QDateTime::currentDateTime();
-    const QString timeStr = dateTime.toString(QStringLiteral("HH:mm:ss.zzz -> "));
-
-    if (ansiColorsEnabled()) {
-      const QString ansiCyan  = QStringLiteral("\033[36m");
-      const QString ansiReset = QStringLiteral("\033[0m");
-      timestamp               = QStringLiteral("%1%2%3").arg(ansiCyan, timeStr, ansiReset);
+  qint64 timeMs = QDateTime::currentMSecsSinceEpoch();
+  if (it != log.marks.cbegin())
+    timeMs = std::prev(it)->timeMs;
+
+  quint64 pos = from;
+  while (pos < to) {
+    const bool markInRange = it != log.marks.cend() && it->offset < to;
+    const quint64 end      = markInRange ? it->offset : to;
+    if (end > pos) {
+      const auto offset    = static_cast<qsizetype>(pos - from);
+      const auto length    = static_cast<qsizetype>(end - pos);
+      const auto timestamp = timestamps ? timestampString(timeMs) : QString();
+      formatLines(log, dataToString(QByteArrayView(bytes).sliced(offset, length)), timestamp, out);
     }
 
-    else {
-      timestamp = timeStr;
+    if (markInRange) {
+      timeMs = it->timeMs;
+      ++it;
     }
+
+    pos = end;
   }
 
-  QString processedString;
-  processedString.reserve(data.length() + timestamp.length() * 4);
+  log.displayed = to;
+}
 
-  // Single-pass newline scan
-  int pos = 0;
-  while (pos < data.length()) {
-    const int nlPos = data.indexOf('\n', pos);
-    const int end   = (nlPos < 0) ? data.length() : nlPos;
+/**
+ * @brief Appends @p data to @p out with line endings normalized to LF and
+ *        @p timestamp inserted at the start of each line.
+ *
+ * Single pass over the text; the line state of @p log carries CR LF pairs and
+ * line starts across calls.
+ */
+void Console::Handler::formatLines(ConsoleLog& log,
+                                   QStringView data,
+                                   QStringView timestamp,
+                                   QString& out)
+{
+  qsizetype pos = 0;
+  if (log.lastCharWasCR && data.startsWith(u'\n'))
+    pos = 1;
+
+  log.lastCharWasCR = data.endsWith(u'\r');
+
+  const qsizetype size = data.size();
+  out.reserve(out.size() + size + timestamp.size() * 4);
+  while (pos < size) {
+    // Find the end of the current line
+    qsizetype end = pos;
+    while (end < size && data[end] != u'\n' && data[end] != u'\r')
+      ++end;
 
+    // Append the text before the line break (or the remaining text)
     if (end > pos) {
-      const auto segment = QStringView(data).mid(pos, end - pos);
-      if (state.isStartingLine && !segment.trimmed().isEmpty())
-        processedString.append(timestamp);
+      const auto segment = data.mid(pos, end - pos);
+      if (log.isStartingLine && !timestamp.isEmpty() && !segment.trimmed().isEmpty())
+        out.append(timestamp);
 
-      processedString.append(segment);
-      state.isStartingLine = false;
+      out.append(segment);
+      log.isStartingLine = false;
     }
 
-    if (nlPos >= 0) {
-      if (state.isStartingLine)
-        processedString.append(timestamp);
+    if (end >= size)
+      break;
 
-      processedString.append('\n');
-      state.isStartingLine = true;
-      pos                  = nlPos + 1;
-    }
+    // Append the line break, CR LF counts as one
+    if (log.isStartingLine)
+      out.append(timestamp);
 
-    else
-      pos = end;
+    out.append(u'\n');
+    log.isStartingLine = true;
+
+    pos = end + 1;
+    if (data[end] == u'\r' && pos < size && data[pos] == u'\n')
+      ++pos;
   }
+}
 
-  // Cap per-device buffer at 10 KB
-  static constexpr int kMaxDeviceBuffer = 10 * 1024;
-  state.buffer.append(processedString);
-  if (state.buffer.size() > kMaxDeviceBuffer) {
-    const int excess = state.buffer.size() - kMaxDeviceBuffer;
-    state.buffer.remove(0, excess);
+/**
+ * @brief Returns the offset from which @p log fills a terminal.
+ *
+ * For plain text this is the start of the last kMaxDisplayLines lines, capped
+ * to kMaxDisplay bytes; for HEX dumps it is the last kMaxDisplayLines rows.
+ */
+quint64 Console::Handler::displayStart(const ConsoleLog& log) const
+{
+  const quint64 ringStart = log.written - static_cast<quint64>(log.bytes.size());
+  if (displayMode() == DisplayMode::DisplayHexadecimal) {
+    constexpr quint64 kHexBytes = kMaxDisplayLines * 16;
+    return log.written - ringStart > kHexBytes ? log.written - kHexBytes : ringStart;
+  }
+
+  quint64 start = ringStart;
+  if (log.lineStarts.size() >= kMaxDisplayLines)
+    start = std::max(start, log.lineStarts.front());
+
+  if (log.written - start > static_cast<quint64>(kMaxDisplay)) {
+    const quint64 limit = log.written - static_cast<quint64>(kMaxDisplay);
+    const auto it = std::lower_bound(log.lineStarts.cbegin(), log.lineStarts.cend(), limit);
+    start         = it != log.lineStarts.cend() ? *it : limit;
   }
 
-  // Buffer for throttled display if this is the active device
-  if (deviceId == m_currentDeviceId || m_currentDeviceId < 0) {
-    m_textBuffer.append(processedString.toUtf8());
-    m_pendingDisplay.append(processedString);
+  return start;
+}
+
+/**
+ * @brief Returns the timestamp prefix for the given time, in ANSI cyan when
+ *        colors are enabled. The last result is cached, since consecutive
+ *        lines usually share the same millisecond.
+ */
+QString Console::Handler::timestampString(qint64 timeMs)
+{
+  if (timeMs != m_timestampMs) {
+    m_timestampMs       = timeMs;
+    const auto dateTime = QDateTime::fromMSecsSinceEpoch(timeMs);
+    const auto timeStr  = dateTime.toString(QStringLiteral("HH:mm:ss.zzz -> "));
+
+    if (ansiColorsEnabled())
+      m_timestampStr = QStringLiteral("\033[36m%1\033[0m").arg(timeStr);
+    else
+      m_timestampStr = timeStr;
   }
+
+  return m_timestampStr;
+}
+
+/**
+ * @brief Returns the log of the device shown by the console.
+ */
+Console::Handler::ConsoleLog& Console::Handler::currentLog()
+{
+  return m_logs[m_currentDeviceId];
+}
+
+/**
+ * @brief Returns the log that stores the data of @p deviceId.
+ *
+ * With a single device (no device selector), all data shares one log.
+ */
+Console::Handler::ConsoleLog& Console::Handler::deviceLog(int deviceId)
+{
+  return m_logs[m_currentDeviceId < 0 ? -1 : deviceId];
 }
 
 bool Console::Handler::hasImageWidget() const
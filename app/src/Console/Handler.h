@@ -21,7 +21,9 @@
 
 #pragma once
 
+#include <deque>
 #include <QFont>
+#include <QHash>
 #include <QList>
 #include <QObject>
 #include <QSettings>
@@ -39,6 +41,12 @@ namespace Console {
  * The handler class receives data from the @c IO::ConnectionManager class and
  * processes it so that it can be easily appended to a text edit widget.
  *
+ * Received bytes are stored as-is in a per-device ring, together with an index
+ * of line starts and arrival times. Text decoding, HEX formatting, line ending
+ * normalization and timestamps are only applied when a terminal is visible,
+ * and only to the data it can actually show (the last lines of the ring). The
+ * raw path stays cheap while the console is hidden or behind the dashboard.
+ *
  * The class also controls various UI-related factors, such as the display
  * format of the data (e.g. ASCII or HEX), history of sent commands and
  * exporting of the RX data.
@@ -233,6 +241,8 @@ public:
   [[nodiscard]] Q_INVOKABLE bool validateUserHex(const QString& text);
   [[nodiscard]] Q_INVOKABLE QString formatUserHex(const QString& text);
 
+  void setViewVisible(QObject* view, const bool visible);
+
 public slots:
   void clear();
   void historyUp();
@@ -268,17 +278,42 @@ private slots:
   void addToHistory(const QString& command);
 
 private:
-  struct DeviceConsoleState {
-    QString buffer;
+  static constexpr size_t kMaxDisplayLines = 1000;
+  static constexpr qsizetype kLogCapacity  = 1024 * 1024;
+  static constexpr qsizetype kMaxDisplay   = 256 * 1024;
+
+  struct ArrivalMark {
+    quint64 offset;
+    qint64 timeMs;
+  };
+
+  struct ConsoleLog {
+    ConsoleLog() : bytes(kLogCapacity) {}
+
+    IO::CircularBuffer<QByteArray, char> bytes;
+    std::deque<ArrivalMark> marks;
+    std::deque<quint64> lineStarts;
+    quint64 written     = 0;
+    quint64 displayed   = 0;
+    bool rawEndsWithCR  = false;
     bool isStartingLine = true;
     bool lastCharWasCR  = false;
   };
 
   bool hasImageWidget() const;
+  bool hasVisibleView() const;
+  void flushDisplay();
+  void catchUpDisplay(ConsoleLog& log);
+  void appendRaw(ConsoleLog& log, QByteArrayView data);
+  void formatLog(ConsoleLog& log, quint64 from, QString& out);
+  void formatLines(ConsoleLog& log, QStringView data, QStringView timestamp, QString& out);
+  quint64 displayStart(const ConsoleLog& log) const;
+  QString timestampString(qint64 timeMs);
+  ConsoleLog& currentLog();
+  ConsoleLog& deviceLog(int deviceId);
   QString dataToString(QByteArrayView data);
   QString plainTextStr(QByteArrayView data);
   QString hexadecimalStr(QByteArrayView data);
-  void appendToDevice(int deviceId, const QString& str, bool addTimestamp);
 
 private:
   DataMode m_dataMode;
@@ -294,13 +329,13 @@ private:
   bool m_ansiColorsEnabled;
   bool m_vt100Emulation;
   bool m_ansiColors;
-  bool m_isStartingLine;
-  bool m_lastCharWasCR;
+  bool m_clearPending;
 
   int m_currentDeviceId;
   QList<int> m_deviceSourceIds;
   QStringList m_deviceNames;
-  std::unordered_map<int, DeviceConsoleState> m_deviceState;
+  std::unordered_map<int, ConsoleLog> m_logs;
+  QHash<QObject*, bool> m_views;
 
   QFont m_font;
   int m_fontSize;
@@ -309,8 +344,9 @@ private:
   QSettings m_settings;
 
   QStringList m_historyItems;
-  IO::CircularBuffer<QByteArray, char> m_textBuffer;
 
   QString m_pendingDisplay;
+  qint64 m_timestampMs;
+  QString m_timestampStr;
 };
 }  // namespace Console
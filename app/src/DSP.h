@@ -21,11 +21,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <QDebug>
@@ -58,6 +61,10 @@ namespace DSP {
  *
  * **Performance:** O(1) push/pop, O(1) random access
  *
+ * Every push is counted, so an element can be identified by its serial number
+ * pushCount() - size() + index. Consumers such as DownsampleCache use it to
+ * find the elements added since they last looked at the queue.
+ *
  * @tparam T Type of elements stored in the queue (must be copyable)
  */
 template<typename T>
@@ -73,6 +80,7 @@ public:
     , m_data(std::shared_ptr<T[]>(new T[capacity < 1 ? 1 : capacity]))
     , m_start(0)
     , m_size(0)
+    , m_pushCount(0)
   {}
 
   /**
@@ -172,6 +180,27 @@ public:
    */
   [[nodiscard]] std::size_t frontIndex() const { return m_start; }
 
+  /**
+   * @brief Returns the number of elements pushed since the queue was created.
+   *
+   * The counter is not reset by clear() or resize(), so the serial number of
+   * the element at logical index i is pushCount() - size() + i.
+   *
+   * @return Total number of push operations.
+   */
+  [[nodiscard]] std::uint64_t pushCount() const { return m_pushCount; }
+
+  /**
+   * @brief Returns a non-owning handle to the internal buffer.
+   *
+   * Copies of a queue share their buffer, and resize() allocates a new one, so
+   * comparing handles tells whether cached serial numbers still refer to the
+   * same data.
+   *
+   * @return Weak reference to the internal array.
+   */
+  [[nodiscard]] std::weak_ptr<const T[]> storage() const { return m_data; }
+
   /**
    * @brief Provides read-only access to an element at a given index.
    *
@@ -336,6 +365,7 @@ private:
    */
   void advance()
   {
+    ++m_pushCount;
     if (m_size < m_capacity)
       ++m_size;
     else
@@ -347,6 +377,7 @@ private:
   std::shared_ptr<T[]> m_data;  ///< Shared pointer to the internal buffer.
   std::size_t m_start;          ///< Index of the oldest element.
   std::size_t m_size;           ///< Current number of elements.
+  std::uint64_t m_pushCount;    ///< Number of elements pushed so far.
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -518,6 +549,105 @@ struct DownsampleWorkspace {
   }
 };
 
+/**
+ * @brief Incremental block summaries of one plot series.
+ *
+ * The samples of a series are grouped into blocks of a fixed number of
+ * samples, aligned to the serial numbers given by FixedQueue::pushCount().
+ * Each block keeps its first, last, minimum and maximum sample, which is all
+ * the downsampler emits for a screen column.
+ *
+ * Since the blocks are aligned to serial numbers rather than to the front of
+ * the queue, a completed block never changes: a refresh only folds the samples
+ * pushed since the previous call into the newest block and drops the blocks
+ * that scrolled out of the queue. Only the oldest block may have lost samples
+ * to the ring buffer, and it is re-summarized from the queue on each call.
+ *
+ * The block size is chosen so that a full queue spans about one block per
+ * pixel column. The summaries are rebuilt from scratch when the plot width,
+ * the queue capacity or the queue buffer changes.
+ *
+ * @note One instance tracks one Y series; keep it as a widget member next to
+ *       the output polyline.
+ */
+struct DownsampleCache {
+  /**
+   * @brief Extrema and endpoints of one block, stored as serial numbers.
+   */
+  struct Block {
+    std::uint64_t index;
+    std::uint64_t firstS;
+    std::uint64_t lastS;
+    std::uint64_t minS;
+    std::uint64_t maxS;
+    ssfp_t minY;
+    ssfp_t maxY;
+    unsigned int cnt;
+
+    /**
+     * @brief Creates an empty summary for block number @p blockIndex.
+     */
+    explicit Block(std::uint64_t blockIndex)
+      : index(blockIndex)
+      , firstS(0)
+      , lastS(0)
+      , minS(0)
+      , maxS(0)
+      , minY(std::numeric_limits<ssfp_t>::infinity())
+      , maxY(-std::numeric_limits<ssfp_t>::infinity())
+      , cnt(0)
+    {}
+
+    /**
+     * @brief Folds the sample with serial number @p serial into the block.
+     *
+     * Non-finite samples are ignored, like in the uncached downsampler.
+     */
+    void add(std::uint64_t serial, ssfp_t y)
+    {
+      if (!std::isfinite(y))
+        return;
+
+      if (cnt == 0) {
+        firstS = serial;
+        minS   = serial;
+        maxS   = serial;
+        minY   = y;
+        maxY   = y;
+      }
+
+      else if (y < minY) {
+        minY = y;
+        minS = serial;
+      }
+
+      else if (y > maxY) {
+        maxY = y;
+        maxS = serial;
+      }
+
+      lastS = serial;
+      ++cnt;
+    }
+  };
+
+  std::deque<Block> blocks;               ///< Summaries in ascending order
+  std::uint64_t blockSize  = 0;           ///< Samples per block
+  std::uint64_t nextSerial = 0;           ///< First serial not yet summarized
+  std::weak_ptr<const ssfp_t[]> storage;  ///< Buffer the serials refer to
+
+  /**
+   * @brief Drops all summaries, forcing a rebuild on the next call.
+   */
+  void reset()
+  {
+    blocks.clear();
+    blockSize  = 0;
+    nextSerial = 0;
+    storage.reset();
+  }
+};
+
 //--------------------------------------------------------------------------------------------------
 // Ring helper
 //--------------------------------------------------------------------------------------------------
@@ -822,6 +952,164 @@ inline bool downsampleMonotonic(
   return downsampleMonotonic(*in.x, *in.y, width, height, out, ws);
 }
 
+/**
+ * @brief Downsample a 2D series into screen-space pixels using incremental
+ *        block summaries.
+ *
+ * Produces the same kind of polyline as the workspace overload (first, min,
+ * max and last point per column), but the columns are blocks of consecutive
+ * samples kept in @p cache instead of X ranges recomputed on every call.
+ *
+ * Each call only summarizes the samples pushed since the previous call, then
+ * walks the ~w block summaries to find the Y range and emit the points, so the
+ * cost is O(new samples + w + samples per block) instead of O(n). This keeps
+ * large point counts affordable for series that grow by a few samples between
+ * refreshes.
+ *
+ * Blocks hold a fixed number of samples, so this overload is intended for
+ * evenly spaced X data such as the sample index axis of plots; the shape of
+ * unevenly spaced data is still preserved, but with a varying number of
+ * points per pixel.
+ *
+ * @param X     Ring-buffer of X values (must be monotonic)
+ * @param Y     Ring-buffer of Y values (same length as X)
+ * @param w     Target plot width in pixels
+ * @param h     Target plot height in pixels
+ * @param out   Output polyline of downsampled points (cleared before use)
+ * @param cache Block summaries of @p Y, updated in place
+ *
+ * @return true always, false only if all the Y data is invalid.
+ */
+inline bool downsampleMonotonic(
+  const AxisData& X, const AxisData& Y, int w, int h, QList<QPointF>& out, DownsampleCache& cache)
+{
+  // Clear the buffer and validate input data
+  out.clear();
+  const std::size_t n = Y.size();
+  if (n == 0 || w <= 0 || h <= 0)
+    return true;
+
+  // Serial numbers can only be mapped to X if both axes share the same front
+  if (X.size() < n) {
+    static thread_local DownsampleWorkspace ws;
+    return downsampleMonotonic(X, Y, w, h, out, &ws);
+  }
+
+  // Extract ring buffer spans from data containers
+  std::size_t xn0, xn1, yn0, yn1;
+  const ssfp_t *xp0, *xp1, *yp0, *yp1;
+  spanFromFixedQueue(X, xp0, xn0, xp1, xn1);
+  spanFromFixedQueue(Y, yp0, yn0, yp1, yn1);
+
+  // Functions to map logical indexes to X and Y independently
+  auto xAt = [&](std::size_t i) -> ssfp_t {
+    return (i < xn0) ? xp0[i] : xp1[i - xn0];
+  };
+  auto yAt = [&](std::size_t i) -> ssfp_t {
+    return (i < yn0) ? yp0[i] : yp1[i - yn0];
+  };
+
+  // Serial number range held by the queue, and one block per column
+  const std::uint64_t end   = Y.pushCount();
+  const std::uint64_t begin = end - n;
+  const std::uint64_t size  = (Y.capacity() + w - 1) / static_cast<std::uint64_t>(w);
+
+  // Rebuild the summaries if they no longer describe the queue contents
+  const auto storage = Y.storage();
+  const bool moved   = storage.owner_before(cache.storage) || cache.storage.owner_before(storage);
+  const bool stale   = cache.nextSerial < begin || cache.nextSerial > end;
+  if (moved || stale || cache.blockSize != size) {
+    cache.blocks.clear();
+    cache.storage    = storage;
+    cache.blockSize  = size;
+    cache.nextSerial = begin;
+  }
+
+  // Summarize the samples pushed since the previous call
+  for (auto serial = cache.nextSerial; serial < end; ++serial) {
+    const auto index = serial / size;
+    if (cache.blocks.empty() || cache.blocks.back().index != index)
+      cache.blocks.emplace_back(index);
+
+    cache.blocks.back().add(serial, yAt(serial - begin));
+  }
+
+  // Drop the blocks that scrolled out of the queue
+  cache.nextSerial = end;
+  while (!cache.blocks.empty() && (cache.blocks.front().index + 1) * size <= begin)
+    cache.blocks.pop_front();
+
+  if (cache.blocks.empty())
+    return false;
+
+  // Re-summarize the oldest block if the ring buffer overwrote part of it
+  DownsampleCache::Block oldest = cache.blocks.front();
+  if (oldest.index * size < begin) {
+    oldest = DownsampleCache::Block(oldest.index);
+    const auto last = std::min(end, (oldest.index + 1) * size);
+    for (auto serial = begin; serial < last; ++serial)
+      oldest.add(serial, yAt(serial - begin));
+  }
+
+  // Find the Y range from the block extrema
+  ssfp_t ymin = std::numeric_limits<ssfp_t>::infinity();
+  ssfp_t ymax = -std::numeric_limits<ssfp_t>::infinity();
+  for (std::size_t b = 0; b < cache.blocks.size(); ++b) {
+    const auto& block = b == 0 ? oldest : cache.blocks[b];
+    if (block.cnt == 0)
+      continue;
+
+    ymin = std::min(ymin, block.minY);
+    ymax = std::max(ymax, block.maxY);
+  }
+
+  // Catch edge cases where all the data is invalid
+  if (!(ymin <= ymax))
+    return false;
+
+  // Register time-ordered points per block: first, min, max, last
+  const auto scaleY = static_cast<ssfp_t>(h) / std::max(1e-12, ymax - ymin);
+  out.reserve(static_cast<qsizetype>(cache.blocks.size()) * 2 + 8);
+  for (std::size_t b = 0; b < cache.blocks.size(); ++b) {
+    // Skip blocks without data
+    const auto& block = b == 0 ? oldest : cache.blocks[b];
+    if (block.cnt == 0)
+      continue;
+
+    // Utility lambda to avoid adding duplicated points
+    int k = 0;
+    std::uint64_t tmp[4];
+    auto push_unique = [&](std::uint64_t v) {
+      for (int j = 0; j < k; ++j)
+        if (tmp[j] == v)
+          return;
+
+      tmp[k++] = v;
+    };
+
+    // Add first, minimum & maximum (if needed) and last points
+    push_unique(block.firstS);
+    if ((block.maxY - block.minY) * scaleY >= 1.0) {
+      push_unique(block.minS);
+      push_unique(block.maxS);
+    }
+
+    push_unique(block.lastS);
+
+    // Sort the block points into ascending order
+    std::sort(tmp, tmp + k);
+
+    // Append the generated points
+    for (int j = 0; j < k; ++j) {
+      const auto i = static_cast<std::size_t>(tmp[j] - begin);
+      out.append(QPointF(xAt(i), yAt(i)));
+    }
+  }
+
+  // Success
+  return true;
+}
+
 /**
  * @brief Check whether a numeric value is effectively zero (close to 0.0).
  *
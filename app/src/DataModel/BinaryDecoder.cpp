@@ -0,0 +1,167 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "DataModel/BinaryDecoder.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <QDebug>
+#include <QtEndian>
+
+//--------------------------------------------------------------------------------------------------
+// Field readers
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reads an unaligned integer of type @p T with the given byte order.
+ */
+template<typename T>
+[[nodiscard]] static inline T loadInteger(const char* data, bool bigEndian) noexcept
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return bigEndian ? qFromBigEndian(value) : qFromLittleEndian(value);
+}
+
+/**
+ * @brief Reads the raw value of @p field from @p data as a double.
+ */
+[[nodiscard]] static inline double readField(const char* data,
+                                             const DataModel::BinaryField& field) noexcept
+{
+  const char* p   = data + field.offset;
+  const bool big  = field.bigEndian;
+  using FieldType = DataModel::BinaryFieldType;
+
+  switch (field.type) {
+    case FieldType::UInt8:
+      return static_cast<quint8>(*p);
+    case FieldType::Int8:
+      return static_cast<qint8>(*p);
+    case FieldType::UInt16:
+      return loadInteger<quint16>(p, big);
+    case FieldType::Int16:
+      return loadInteger<qint16>(p, big);
+    case FieldType::UInt32:
+      return loadInteger<quint32>(p, big);
+    case FieldType::Int32:
+      return loadInteger<qint32>(p, big);
+    case FieldType::UInt64:
+      return static_cast<double>(loadInteger<quint64>(p, big));
+    case FieldType::Int64:
+      return static_cast<double>(loadInteger<qint64>(p, big));
+    case FieldType::Float32:
+      return std::bit_cast<float>(loadInteger<quint32>(p, big));
+    case FieldType::Float64:
+      return std::bit_cast<double>(loadInteger<quint64>(p, big));
+  }
+
+  return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Constructor
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Builds a decoder for @p layout.
+ *
+ * Decoded values map to datasets by position, so a field with a negative
+ * offset invalidates the whole layout: the decoder is left empty and the
+ * source falls back to its frame parser script. Otherwise the minimum frame
+ * size is the end of the furthest field, so decode() can reject short frames
+ * with a single comparison.
+ *
+ * @param layout Field list from the project's source definition.
+ */
+DataModel::BinaryDecoder::BinaryDecoder(const std::vector<BinaryField>& layout) : m_frameSize(0)
+{
+  m_fields.reserve(layout.size());
+  for (const auto& field : layout) {
+    if (field.offset < 0) [[unlikely]] {
+      qWarning() << "[BinaryDecoder] Ignoring layout with a negative field offset" << field.offset;
+      m_fields.clear();
+      m_frameSize = 0;
+      return;
+    }
+
+    m_fields.push_back(field);
+    m_frameSize = std::max(m_frameSize, field.offset + fieldSize(field.type));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Decoding
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Decodes one frame into channel values.
+ *
+ * @p values is resized to the number of fields and filled in layout order;
+ * its storage is reused across calls. Frames shorter than frameSize() are
+ * rejected without touching @p values.
+ *
+ * @param frame  Raw frame bytes as delivered by the FrameReader.
+ * @param values Output channel values.
+ * @return @c true if the frame was decoded, @c false if it was too short.
+ */
+bool DataModel::BinaryDecoder::decode(const QByteArray& frame, std::vector<double>& values) const
+{
+  if (frame.size() < m_frameSize) [[unlikely]]
+    return false;
+
+  const char* data   = frame.constData();
+  const size_t count = m_fields.size();
+  values.resize(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const auto& field = m_fields[i];
+    values[i]         = readField(data, field) * field.scale + field.valueOffset;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Returns the size in bytes of a field of the given type.
+ */
+qsizetype DataModel::BinaryDecoder::fieldSize(BinaryFieldType type) noexcept
+{
+  switch (type) {
+    case BinaryFieldType::UInt8:
+    case BinaryFieldType::Int8:
+      return 1;
+    case BinaryFieldType::UInt16:
+    case BinaryFieldType::Int16:
+      return 2;
+    case BinaryFieldType::UInt32:
+    case BinaryFieldType::Int32:
+    case BinaryFieldType::Float32:
+      return 4;
+    case BinaryFieldType::UInt64:
+    case BinaryFieldType::Int64:
+    case BinaryFieldType::Float64:
+      return 8;
+  }
+
+  return 1;
+}
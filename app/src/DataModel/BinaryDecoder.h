@@ -0,0 +1,58 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <vector>
+
+#include "DataModel/Frame.h"
+
+namespace DataModel {
+
+/**
+ * @brief Native decoder for fixed binary frame layouts.
+ *
+ * Decodes packed structs described by a source's BinaryField list straight
+ * into numeric channel values, without going through a Lua table or a JS
+ * array. FrameParser keeps one decoder per source that declares a layout;
+ * sources without a layout keep using their frame parser script.
+ *
+ * The layout is validated once at construction, so decode() only has to
+ * check the frame length before reading every field.
+ */
+class BinaryDecoder {
+public:
+  explicit BinaryDecoder(const std::vector<BinaryField>& layout);
+
+  [[nodiscard]] bool isEmpty() const noexcept { return m_fields.empty(); }
+  [[nodiscard]] qsizetype frameSize() const noexcept { return m_frameSize; }
+
+  [[nodiscard]] bool decode(const QByteArray& frame, std::vector<double>& values) const;
+
+  [[nodiscard]] static qsizetype fieldSize(BinaryFieldType type) noexcept;
+
+private:
+  std::vector<BinaryField> m_fields;
+  qsizetype m_frameSize;
+};
+
+}  // namespace DataModel
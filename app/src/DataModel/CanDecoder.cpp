@@ -0,0 +1,192 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "DataModel/CanDecoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <QCryptographicHash>
+#include <QtEndian>
+
+//--------------------------------------------------------------------------------------------------
+// Bit extraction helpers
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Extracts a signal bit by bit, for signals that do not fit in the
+ *        64-bit window of a single load (unaligned signals wider than 56 bits).
+ */
+[[nodiscard]] static quint64 extractBits(const uchar* data,
+                                         int startBit,
+                                         int bitLength,
+                                         bool bigEndian) noexcept
+{
+  quint64 value = 0;
+  for (int bit = 0; bit < bitLength; ++bit) {
+    const int pos = startBit + bit;
+    if (bigEndian)
+      value = (value << 1) | ((data[pos / 8] >> (7 - pos % 8)) & 1);
+    else
+      value |= static_cast<quint64>((data[pos / 8] >> (pos % 8)) & 1) << bit;
+  }
+
+  return value;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Constructor
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Builds the message table and extraction plans for @p messages.
+ *
+ * Signals that start beyond the largest CAN FD payload are dropped, and a
+ * repeated CAN ID keeps the first definition.
+ *
+ * @param messages CAN layout from the project's source definition.
+ */
+DataModel::CanDecoder::CanDecoder(const std::vector<CanMessage>& messages)
+{
+  m_messages.reserve(messages.size());
+  for (const auto& message : messages) {
+    if (m_messages.contains(message.id)) [[unlikely]]
+      continue;
+
+    MessagePlan plan{m_plans.size(), 0};
+    for (const auto& s : message.signalList) {
+      if (s.bitLength <= 0 || s.bitLength > 64 || s.startBit < 0
+          || s.startBit >= kMaxPayload * 8) [[unlikely]]
+        continue;
+
+      SignalPlan p;
+      p.index      = s.index;
+      p.byteOffset = s.startBit / 8;
+      p.shift      = s.startBit % 8;
+      p.bitLength  = s.bitLength;
+      p.bigEndian  = s.bigEndian;
+      p.isSigned   = s.isSigned;
+      p.mask       = s.bitLength == 64 ? ~0ULL : (1ULL << s.bitLength) - 1;
+      p.factor     = s.factor;
+      p.offset     = s.offset;
+      m_plans.push_back(p);
+      ++plan.count;
+    }
+
+    if (plan.count > 0)
+      m_messages.emplace(message.id, plan);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Decoding
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Decodes the signals of one CAN frame.
+ *
+ * The payload is copied into a zero-padded buffer, so every signal can be
+ * read with an unaligned 64-bit load. Like the generated Lua parser, bits past
+ * the DLC are not part of the value: Intel signals read them as zero, and
+ * Motorola signals keep only their leading bits, right-aligned.
+ * @p samples is cleared and filled with the message's signals; its storage
+ * is reused across calls.
+ *
+ * @param frame   Raw frame bytes as delivered by the CAN bus driver.
+ * @param samples Output (channel index, value) pairs.
+ * @return @c true if the frame belongs to a known message.
+ */
+bool DataModel::CanDecoder::decode(const QByteArray& frame, std::vector<Sample>& samples) const
+{
+  if (frame.size() < 3) [[unlikely]]
+    return false;
+
+  const auto* bytes = reinterpret_cast<const uchar*>(frame.constData());
+  const auto canId  = static_cast<quint32>((bytes[0] << 8) | bytes[1]);
+  const auto it     = m_messages.find(canId);
+  if (it == m_messages.end())
+    return false;
+
+  // Zero-padded payload: 8 spare bytes keep the widest load in bounds
+  uchar payload[kMaxPayload + 8] = {};
+  const auto length = std::min<qsizetype>({bytes[2], frame.size() - 3, kMaxPayload});
+  std::memcpy(payload, bytes + 3, static_cast<size_t>(length));
+
+  const auto& message = it->second;
+  samples.resize(message.count);
+  for (size_t i = 0; i < message.count; ++i) {
+    const auto& p = m_plans[message.first + i];
+
+    quint64 raw;
+    if (p.shift + p.bitLength <= 64) [[likely]] {
+      if (p.bigEndian) {
+        const auto word = qFromBigEndian<quint64>(payload + p.byteOffset);
+        raw             = (word >> (64 - p.shift - p.bitLength)) & p.mask;
+      } else {
+        const auto word = qFromLittleEndian<quint64>(payload + p.byteOffset);
+        raw             = (word >> p.shift) & p.mask;
+      }
+    } else {
+      raw = extractBits(payload, p.byteOffset * 8 + p.shift, p.bitLength, p.bigEndian);
+    }
+
+    // Drop the trailing bits of Motorola signals cut short by the DLC
+    if (p.bigEndian) {
+      const auto available = length * 8 - (p.byteOffset * 8 + p.shift);
+      if (available <= 0) [[unlikely]]
+        raw = 0;
+      else if (available < p.bitLength) [[unlikely]]
+        raw >>= p.bitLength - available;
+    }
+
+    // Sign-extend two's complement signals
+    double value;
+    if (p.isSigned && p.bitLength < 64 && (raw >> (p.bitLength - 1)) & 1)
+      value = static_cast<double>(static_cast<qint64>(raw | ~p.mask));
+    else if (p.isSigned)
+      value = static_cast<double>(static_cast<qint64>(raw));
+    else
+      value = static_cast<double>(raw);
+
+    samples[i] = {p.index, value * p.factor + p.offset};
+  }
+
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Parser fingerprint
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the digest that ties a CAN layout to the frame parser it mirrors.
+ *
+ * The DBC importer stores the digest of its generated parser next to the
+ * layout. Once the user edits the parser the digests no longer match, and
+ * FrameParser decodes the source with the edited script instead.
+ *
+ * @param code Frame parser source code.
+ * @return Hex-encoded SHA-256 of @p code.
+ */
+QString DataModel::CanDecoder::parserDigest(const QString& code)
+{
+  const auto hash = QCryptographicHash::hash(code.toUtf8(), QCryptographicHash::Sha256);
+  return QString::fromLatin1(hash.toHex());
+}
@@ -0,0 +1,89 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <unordered_map>
+#include <vector>
+
+#include "DataModel/Frame.h"
+
+namespace DataModel {
+
+/**
+ * @brief Native decoder for CAN frames described by a source's CAN layout.
+ *
+ * Replaces the Lua parser generated by the DBC importer for sources that
+ * carry a `canMessages` list. Messages are looked up by CAN ID in a hash
+ * table, and every signal is reduced at construction to a byte offset, shift
+ * and mask, so decoding is one 64-bit load per signal.
+ *
+ * Frames use the CAN bus driver layout: two bytes of CAN ID (big-endian),
+ * one byte of DLC and the payload. decode() only reports the channels of the
+ * received message, so callers can leave every other dataset untouched.
+ *
+ * The layout is only trusted while the source's frame parser is the one it
+ * was generated with, see parserDigest().
+ */
+class CanDecoder {
+public:
+  /**
+   * @brief Decoded value of one signal and the frame channel it feeds.
+   */
+  struct Sample {
+    int index;
+    double value;
+  };
+
+  explicit CanDecoder(const std::vector<CanMessage>& messages);
+
+  [[nodiscard]] bool isEmpty() const noexcept { return m_messages.empty(); }
+
+  [[nodiscard]] bool decode(const QByteArray& frame, std::vector<Sample>& samples) const;
+
+  [[nodiscard]] static QString parserDigest(const QString& code);
+
+private:
+  static constexpr int kMaxPayload = 64;
+
+  struct SignalPlan {
+    int index;
+    int byteOffset;
+    int shift;
+    int bitLength;
+    bool bigEndian;
+    bool isSigned;
+    quint64 mask;
+    double factor;
+    double offset;
+  };
+
+  struct MessagePlan {
+    size_t first;
+    size_t count;
+  };
+
+  std::vector<SignalPlan> m_plans;
+  std::unordered_map<quint32, MessagePlan> m_messages;
+};
+
+}  // namespace DataModel
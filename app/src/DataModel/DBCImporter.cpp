@@ -30,6 +30,7 @@
 #include <QRegularExpression>
 #include <QStandardPaths>
 
+#include "DataModel/CanDecoder.h"
 #include "DataModel/Frame.h"
 #include "DataModel/ProjectModel.h"
 #include "Misc/Utilities.h"
@@ -271,7 +272,8 @@ void DataModel::DBCImporter::confirmImport()
  * - Project title: Based on DBC filename
  * - Decoder method: 3 (custom JavaScript parser)
  * - Frame detection: 2 (manual mode)
- * - Frame parser: JavaScript code for extracting CAN signals
+ * - Frame parser: Lua code for extracting CAN signals
+ * - CAN messages: Native signal layout, used while the frame parser is unedited
  * - Groups: One group per CAN message with datasets for each signal
  * - Actions: Empty array (no actions defined)
  *
@@ -288,6 +290,9 @@ QJsonObject DataModel::DBCImporter::generateProject(const QList<QCanMessageDescr
   project["title"]   = projectTitle;
   project["actions"] = QJsonArray();
 
+  // The digest ties the native CAN layout to this exact parser
+  const auto parserCode = generateFrameParser(messages);
+
   QJsonObject source;
   source["sourceId"]              = 0;
   source["title"]                 = tr("CAN Bus");
@@ -298,8 +303,10 @@ QJsonObject DataModel::DBCImporter::generateProject(const QList<QCanMessageDescr
   source["frameDetection"]        = static_cast<int>(SerialStudio::NoDelimiters);
   source["decoder"]               = static_cast<int>(SerialStudio::Binary);
   source["hexadecimalDelimiters"] = false;
-  source["frameParserCode"]       = generateFrameParser(messages);
+  source["frameParserCode"]       = parserCode;
   source["frameParserLanguage"]   = static_cast<int>(SerialStudio::Lua);
+  source["canMessages"]           = generateCanMessages(messages);
+  source["canParserDigest"]       = CanDecoder::parserDigest(parserCode);
 
   project["sources"] = QJsonArray{source};
 
@@ -313,6 +320,50 @@ QJsonObject DataModel::DBCImporter::generateProject(const QList<QCanMessageDescr
   return project;
 }
 
+/**
+ * @brief Generates the native CAN signal layout for all CAN messages.
+ *
+ * Each signal is mapped to the same dataset index used by generateGroups()
+ * and generateFrameParser(), so DataModel::CanDecoder and the generated Lua
+ * parser produce identical channels.
+ *
+ * @param messages List of CAN message descriptions from the DBC file.
+ * @return JSON array of serialized DataModel::CanMessage objects.
+ */
+QJsonArray DataModel::DBCImporter::generateCanMessages(
+  const QList<QCanMessageDescription>& messages)
+{
+  QJsonArray array;
+  int datasetIndex = 1;
+
+  for (const auto& message : messages) {
+    const auto signalList = message.signalDescriptions();
+    if (signalList.isEmpty())
+      continue;
+
+    DataModel::CanMessage canMessage;
+    canMessage.id = static_cast<quint32>(message.uniqueId());
+    canMessage.signalList.reserve(signalList.count());
+
+    for (const auto& signal : signalList) {
+      // Qt's DBC parser inverts byte order, flip it back
+      DataModel::CanSignal canSignal;
+      canSignal.index     = datasetIndex++;
+      canSignal.startBit  = static_cast<int>(signal.startBit());
+      canSignal.bitLength = static_cast<int>(signal.bitLength());
+      canSignal.bigEndian = (signal.dataEndian() == QSysInfo::LittleEndian);
+      canSignal.isSigned  = (signal.dataFormat() == QtCanBus::DataFormat::SignedInteger);
+      canSignal.factor    = signal.factor();
+      canSignal.offset    = signal.offset();
+      canMessage.signalList.push_back(canSignal);
+    }
+
+    array.append(serialize(canMessage));
+  }
+
+  return array;
+}
+
 /**
  * @brief Generates group structures for all CAN messages.
  *
@@ -454,6 +505,9 @@ QString DataModel::DBCImporter::generateFrameParser(const QList<QCanMessageDescr
   code += QString("-- Total signals: %1\n").arg(totalSignals);
   code += QString("-- Total messages: %1\n").arg(messageCount());
   code += "--\n";
+  code += "-- Serial Studio decodes these signals natively while this parser\n";
+  code += "-- is unchanged. Once you edit it, frames are decoded by this script.\n";
+  code += "--\n";
   code += "-- Frame format:\n";
   code += "--   Byte 1-2: CAN ID (big-endian, 16-bit)\n";
   code += "--   Byte 3:   Data Length Code (DLC)\n";
@@ -25,6 +25,7 @@
 #include <QCanDbcFileParser>
 #include <QCanMessageDescription>
 #include <QCanSignalDescription>
+#include <QJsonArray>
 #include <QJsonObject>
 #include <QObject>
 #include <QString>
@@ -50,6 +51,7 @@ namespace DataModel {
  * Key features:
  * - Uses Qt's QCanDbcFileParser for robust DBC parsing
  * - Automatically generates JavaScript frame parsers for CAN signal extraction
+ * - Emits a native CAN signal layout, decoded without the script engine
  * - Smart widget assignment based on signal units and value ranges
  * - Supports both Intel (little-endian) and Motorola (big-endian) byte order
  * - Handles signal scaling and offset transformations
@@ -115,6 +117,7 @@ private:
 
   std::vector<Group> generateGroups(const QList<QCanMessageDescription>& messages);
   QJsonObject generateProject(const QList<QCanMessageDescription>& messages);
+  QJsonArray generateCanMessages(const QList<QCanMessageDescription>& messages);
   QString generateFrameParser(const QList<QCanMessageDescription>& messages);
 
   QString sanitizeJavaScriptString(const QString& str);
@@ -24,6 +24,7 @@
 #include <chrono>
 #include <cmath>
 #include <memory>
+#include <QDebug>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QString>
@@ -335,7 +336,7 @@ struct alignas(8) Dataset {
   double alarmLow      = 20;     ///< Low alarm threshold
   double alarmHigh     = 80;     ///< High alarm threshold
   double numericValue  = 0;      ///< Parsed numeric value
-  QString value;                 ///< Raw string value
+  QString value;                 ///< Raw string value (see dataset_text())
   QString title;                 ///< Human-readable title
   QString units;                 ///< Measurement units (e.g., °C)
   QString widget;                ///< Widget type (bar, gauge, etc.)
@@ -344,6 +345,24 @@ struct alignas(8) Dataset {
 
 static_assert(sizeof(Dataset) % alignof(Dataset) == 0, "Unaligned Dataset struct");
 
+/**
+ * @brief Returns the text form of a dataset's current value.
+ *
+ * FrameBuilder stores typed numeric channels only in `numericValue` and
+ * leaves `value` empty, so the string is built here, on demand, for the
+ * consumers that actually display or export text.
+ *
+ * @param d The dataset to format.
+ * @return The raw string value, or the formatted numeric value.
+ */
+[[nodiscard]] inline QString dataset_text(const Dataset& d)
+{
+  if (d.value.isEmpty() && d.isNumeric)
+    return QString::number(d.numericValue, 'g', 15);
+
+  return d.value;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Group structure
 //--------------------------------------------------------------------------------------------------
@@ -379,6 +398,123 @@ struct alignas(8) Group {
 
 static_assert(sizeof(Group) % alignof(Group) == 0, "Unaligned Group struct");
 
+//--------------------------------------------------------------------------------------------------
+// Binary layout structure
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Storage type of a field within a fixed binary frame layout.
+ */
+enum class BinaryFieldType : quint8 {
+  UInt8,
+  Int8,
+  UInt16,
+  Int16,
+  UInt32,
+  Int32,
+  UInt64,
+  Int64,
+  Float32,
+  Float64
+};
+
+/**
+ * @brief Describes one field of a packed binary struct sent by a device.
+ *
+ * Fields are mapped to frame channels in declaration order (the first field
+ * feeds dataset index 1). The decoded value is `raw * scale + valueOffset`.
+ */
+struct alignas(8) BinaryField {
+  int offset           = 0;                       ///< Byte offset within the frame
+  BinaryFieldType type = BinaryFieldType::UInt8;  ///< Storage type
+  bool bigEndian       = false;                   ///< Byte order of multi-byte types
+  double scale         = 1;                       ///< Multiplier applied to the raw value
+  double valueOffset   = 0;                       ///< Added after scaling
+};
+
+static_assert(sizeof(BinaryField) % alignof(BinaryField) == 0, "Unaligned BinaryField struct");
+
+/**
+ * @brief Project file names of the binary field types, indexed by type.
+ */
+inline constexpr const char* BinaryFieldTypeNames[] = {
+  "uint8", "int8", "uint16", "int16", "uint32", "int32", "uint64", "int64", "float32", "float64"};
+
+/**
+ * @brief Serializes a BinaryField to a QJsonObject.
+ * @param f The BinaryField to serialize.
+ * @return QJsonObject representing the field.
+ */
+[[nodiscard]] inline QJsonObject serialize(const BinaryField& f)
+{
+  QJsonObject obj;
+  obj.insert("offset", f.offset);
+  obj.insert("type", QLatin1String(BinaryFieldTypeNames[static_cast<int>(f.type)]));
+  obj.insert("bigEndian", f.bigEndian);
+  obj.insert("scale", f.scale);
+  obj.insert("valueOffset", f.valueOffset);
+  return obj;
+}
+
+//--------------------------------------------------------------------------------------------------
+// CAN message layout structure
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Describes one signal of a CAN message, as imported from a DBC file.
+ *
+ * Bit numbering follows the generated DBC frame parser: Intel signals count
+ * bits LSB-first from byte 0, Motorola signals count them MSB-first. The
+ * decoded value is `raw * factor + offset` and feeds dataset @c index.
+ */
+struct alignas(8) CanSignal {
+  int index      = 0;      ///< Frame channel (dataset index) fed by this signal
+  int startBit   = 0;      ///< First bit of the signal within the payload
+  int bitLength  = 1;      ///< Signal width in bits (1-64)
+  bool bigEndian = false;  ///< Motorola (true) or Intel (false) byte order
+  bool isSigned  = false;  ///< Two's complement signal
+  double factor  = 1;      ///< Multiplier applied to the raw value
+  double offset  = 0;      ///< Added after scaling
+};
+
+static_assert(sizeof(CanSignal) % alignof(CanSignal) == 0, "Unaligned CanSignal struct");
+
+/**
+ * @brief A CAN message and the signals it carries.
+ */
+struct alignas(8) CanMessage {
+  quint32 id = 0;                     ///< CAN identifier
+  std::vector<CanSignal> signalList;  ///< Signals packed in the payload
+};
+
+static_assert(sizeof(CanMessage) % alignof(CanMessage) == 0, "Unaligned CanMessage struct");
+
+/**
+ * @brief Serializes a CanMessage (and its signals) to a QJsonObject.
+ * @param m The CanMessage to serialize.
+ * @return QJsonObject representing the message.
+ */
+[[nodiscard]] inline QJsonObject serialize(const CanMessage& m)
+{
+  QJsonArray list;
+  for (const auto& s : m.signalList) {
+    QJsonObject obj;
+    obj.insert("index", s.index);
+    obj.insert("startBit", s.startBit);
+    obj.insert("bitLength", s.bitLength);
+    obj.insert("bigEndian", s.bigEndian);
+    obj.insert("signed", s.isSigned);
+    obj.insert("factor", s.factor);
+    obj.insert("offset", s.offset);
+    list.append(obj);
+  }
+
+  QJsonObject obj;
+  obj.insert("id", static_cast<qint64>(m.id));
+  obj.insert("signals", list);
+  return obj;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Source structure
 //--------------------------------------------------------------------------------------------------
@@ -392,18 +528,21 @@ static_assert(sizeof(Group) % alignof(Group) == 0, "Unaligned Group struct");
  * (which already includes Frame.h). Cast to SerialStudio::BusType at call sites.
  */
 struct alignas(8) Source {
-  int sourceId = 0;                    ///< Unique source identifier (0 = default/backward-compat)
-  int busType  = 0;                    ///< SerialStudio::BusType cast to int
-  QString title;                       ///< Human-readable source name
-  QString frameStart;                  ///< Frame start delimiter sequence
-  QString frameEnd;                    ///< Frame end delimiter sequence
-  QString checksumAlgorithm;           ///< Checksum algorithm name
-  int frameDetection         = 0;      ///< SerialStudio::FrameDetection cast to int
-  int decoderMethod          = 0;      ///< SerialStudio::DecoderMethod cast to int
-  bool hexadecimalDelimiters = false;  ///< True if delimiters are hex-encoded
-  int frameParserLanguage    = 0;      ///< SerialStudio::ScriptLanguage cast to int
-  QJsonObject connectionSettings;      ///< Opaque bus-specific connection params
-  QString frameParserCode;             ///< Per-source frame parser code
+  int sourceId = 0;                       ///< Unique source identifier (0 = default/backward-compat)
+  int busType  = 0;                       ///< SerialStudio::BusType cast to int
+  QString title;                          ///< Human-readable source name
+  QString frameStart;                     ///< Frame start delimiter sequence
+  QString frameEnd;                       ///< Frame end delimiter sequence
+  QString checksumAlgorithm;              ///< Checksum algorithm name
+  int frameDetection         = 0;         ///< SerialStudio::FrameDetection cast to int
+  int decoderMethod          = 0;         ///< SerialStudio::DecoderMethod cast to int
+  bool hexadecimalDelimiters = false;     ///< True if delimiters are hex-encoded
+  int frameParserLanguage    = 0;         ///< SerialStudio::ScriptLanguage cast to int
+  QJsonObject connectionSettings;         ///< Opaque bus-specific connection params
+  QString frameParserCode;                ///< Per-source frame parser code
+  std::vector<BinaryField> binaryLayout;  ///< Native struct layout (Binary decoder only)
+  std::vector<CanMessage> canMessages;    ///< Native CAN signal layout (Binary decoder only)
+  QString canParserDigest;                ///< Digest of the frame parser the CAN layout mirrors
 };
 
 static_assert(sizeof(Source) % alignof(Source) == 0, "Unaligned Source struct");
@@ -436,6 +575,23 @@ static_assert(sizeof(Source) % alignof(Source) == 0, "Unaligned Source struct");
   if (s.frameParserLanguage != 0)
     obj.insert("frameParserLanguage", s.frameParserLanguage);
 
+  if (!s.binaryLayout.empty()) {
+    QJsonArray layout;
+    for (const auto& field : s.binaryLayout)
+      layout.append(serialize(field));
+
+    obj.insert("binaryLayout", layout);
+  }
+
+  if (!s.canMessages.empty()) {
+    QJsonArray messages;
+    for (const auto& message : s.canMessages)
+      messages.append(serialize(message));
+
+    obj.insert("canMessages", messages);
+    obj.insert("canParserDigest", s.canParserDigest);
+  }
+
   return obj;
 }
 
@@ -683,6 +839,43 @@ inline void copy_frame_values(Frame& dst, const Frame& src) noexcept
   return true;
 }
 
+/**
+ * @brief Compares two frames for equivalence as export schemas.
+ *
+ * Exporters take column names and units from the schema (CSV headers, MDF4
+ * channel and group names), so on top of the structural checks done by
+ * compare_frames() this also compares group titles, dataset titles and units.
+ * Values are ignored.
+ *
+ * QString comparisons are cheap here: frames built from the same project share
+ * their strings, and the sizes are compared before the contents.
+ *
+ * @param a First frame to compare
+ * @param b Second frame to compare
+ * @return true if an export schema built from @p a also describes @p b
+ */
+[[nodiscard]] inline bool compare_frame_schemas(const Frame& a, const Frame& b) noexcept
+{
+  if (!compare_frames(a, b))
+    return false;
+
+  for (size_t i = 0, gc = a.groups.size(); i < gc; ++i) {
+    const auto& g1 = a.groups[i];
+    const auto& g2 = b.groups[i];
+    if (g1.title != g2.title) [[unlikely]]
+      return false;
+
+    for (size_t j = 0, dc = g1.datasets.size(); j < dc; ++j) {
+      const auto& d1 = g1.datasets[j];
+      const auto& d2 = g2.datasets[j];
+      if (d1.title != d2.title || d1.units != d2.units) [[unlikely]]
+        return false;
+    }
+  }
+
+  return true;
+}
+
 /**
  * @brief Finalizes a Frame after deserialization.
  *
@@ -784,7 +977,7 @@ void read_io_settings(QByteArray& frameStart,
   obj.insert(Keys::FFTSamples, d.fftSamples);
   obj.insert(Keys::Overview, d.overviewDisplay);
   obj.insert(Keys::Title, d.title.simplified());
-  obj.insert(Keys::Value, d.value.simplified());
+  obj.insert(Keys::Value, dataset_text(d).simplified());
   obj.insert(Keys::Units, d.units.simplified());
   obj.insert(Keys::AlarmEnabled, d.alarmEnabled);
   obj.insert(Keys::Widget, d.widget.simplified());
@@ -887,6 +1080,80 @@ void read_io_settings(QByteArray& frameStart,
 // Data deserialization
 //--------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Deserializes a BinaryField from a QJsonObject.
+ *
+ * Unknown type names and negative offsets are rejected so that a malformed
+ * layout never makes the decoder read outside the frame. The caller drops
+ * the whole layout in that case, since fields map to datasets by position.
+ *
+ * @param f Output BinaryField to populate.
+ * @param obj JSON object to read from.
+ * @return true if successfully parsed.
+ */
+[[nodiscard]] inline bool read(BinaryField& f, const QJsonObject& obj)
+{
+  if (obj.isEmpty())
+    return false;
+
+  const auto typeName = ss_jsr(obj, "type", "").toString().trimmed().toLower();
+  int typeIdx         = -1;
+  for (int i = 0; i < static_cast<int>(std::size(BinaryFieldTypeNames)); ++i) {
+    if (typeName == QLatin1String(BinaryFieldTypeNames[i])) {
+      typeIdx = i;
+      break;
+    }
+  }
+
+  if (typeIdx < 0)
+    return false;
+
+  f.offset      = ss_jsr(obj, "offset", 0).toInt();
+  f.type        = static_cast<BinaryFieldType>(typeIdx);
+  f.bigEndian   = ss_jsr(obj, "bigEndian", false).toBool();
+  f.scale       = ss_jsr(obj, "scale", 1).toDouble();
+  f.valueOffset = ss_jsr(obj, "valueOffset", 0).toDouble();
+  return f.offset >= 0;
+}
+
+/**
+ * @brief Deserializes a CanMessage from a QJsonObject.
+ *
+ * Signals with an invalid channel index, start bit or width are dropped so
+ * that the native CAN decoder never reads outside its payload buffer.
+ *
+ * @param m Output CanMessage to populate.
+ * @param obj JSON object to read from.
+ * @return true if the message has at least one valid signal.
+ */
+[[nodiscard]] inline bool read(CanMessage& m, const QJsonObject& obj)
+{
+  if (obj.isEmpty())
+    return false;
+
+  m.id = static_cast<quint32>(ss_jsr(obj, "id", 0).toLongLong());
+  m.signalList.clear();
+
+  const auto list = obj.value("signals").toArray();
+  for (const auto& value : list) {
+    const auto so = value.toObject();
+
+    CanSignal s;
+    s.index     = ss_jsr(so, "index", 0).toInt();
+    s.startBit  = ss_jsr(so, "startBit", 0).toInt();
+    s.bitLength = ss_jsr(so, "bitLength", 1).toInt();
+    s.bigEndian = ss_jsr(so, "bigEndian", false).toBool();
+    s.isSigned  = ss_jsr(so, "signed", false).toBool();
+    s.factor    = ss_jsr(so, "factor", 1).toDouble();
+    s.offset    = ss_jsr(so, "offset", 0).toDouble();
+
+    if (s.index > 0 && s.startBit >= 0 && s.startBit < 512 && s.bitLength > 0 && s.bitLength <= 64)
+      m.signalList.push_back(s);
+  }
+
+  return !m.signalList.empty();
+}
+
 /**
  * @brief Deserializes a Source from a QJsonObject.
  * @param s Output Source to populate.
@@ -910,6 +1177,31 @@ void read_io_settings(QByteArray& frameStart,
   s.connectionSettings    = ss_jsr(obj, Keys::SourceConn, QJsonObject()).toJsonObject();
   s.frameParserCode       = ss_jsr(obj, "frameParserCode", "").toString();
   s.frameParserLanguage   = ss_jsr(obj, "frameParserLanguage", 0).toInt();
+
+  // Decoded fields map to datasets by position, so one bad field voids the layout
+  s.binaryLayout.clear();
+  const auto layout = obj.value("binaryLayout").toArray();
+  for (qsizetype i = 0; i < layout.size(); ++i) {
+    BinaryField field;
+    if (!read(field, layout.at(i).toObject())) {
+      qWarning() << "[Frame] Ignoring binary layout of source" << s.sourceId << "- field" << i
+                 << "has an unknown type or a negative offset";
+      s.binaryLayout.clear();
+      break;
+    }
+
+    s.binaryLayout.push_back(field);
+  }
+
+  s.canMessages.clear();
+  s.canParserDigest   = ss_jsr(obj, "canParserDigest", "").toString();
+  const auto messages = obj.value("canMessages").toArray();
+  for (const auto& value : messages) {
+    CanMessage message;
+    if (read(message, value.toObject()))
+      s.canMessages.push_back(message);
+  }
+
   return true;
 }
 
@@ -1211,46 +1503,149 @@ void read_io_settings(QByteArray& frameStart,
 // Timestamped data
 //--------------------------------------------------------------------------------------------------
 
+/**
+ * @typedef FrameSchemaPtr
+ * @brief Immutable snapshot of a frame's structure shared by all exported
+ *        frames that have the same layout.
+ *
+ * FrameBuilder builds one schema per source when the project or quick-plot
+ * layout changes. Every exported frame then references it instead of
+ * deep-copying its groups, datasets and their strings. The value fields
+ * stored in the schema are whatever they were at snapshot time and must
+ * not be read; per-frame values live in TimestampedFrame::values.
+ */
+typedef std::shared_ptr<const DataModel::Frame> FrameSchemaPtr;
+
+/**
+ * @brief Per-frame value of a single dataset, stored in schema order.
+ *
+ * Holds only the mutable fields of a Dataset. For numeric channels `value` is
+ * usually empty (see dataset_text()), so capturing a record does not allocate.
+ */
+struct DatasetValue {
+  QString value;                ///< Raw string value (empty for typed numbers)
+  double numericValue = 0;      ///< Parsed numeric value
+  bool isNumeric      = false;  ///< True if value was parsed as numeric
+};
+
+/**
+ * @brief Returns the text form of a captured dataset value.
+ *
+ * @param v The value record to format.
+ * @return The raw string value, or the formatted numeric value.
+ */
+[[nodiscard]] inline QString dataset_text(const DatasetValue& v)
+{
+  if (v.value.isEmpty() && v.isNumeric)
+    return QString::number(v.numericValue, 'g', 15);
+
+  return v.value;
+}
+
+/**
+ * @brief Schema-order ordinals of the datasets refreshed by a frame update.
+ *
+ * Ordinals count datasets group by group, in the order used by
+ * capture_frame_values(). An empty list means every dataset was refreshed.
+ * Datasets that are not listed keep their last known value, which is still
+ * present in the frame, so consumers that need complete rows can ignore the
+ * list while delta consumers only visit the listed datasets.
+ */
+using DirtyDatasets = std::vector<quint32>;
+
+/**
+ * @brief Returns the number of datasets in a frame, across all groups.
+ *
+ * @param frame The frame to inspect.
+ * @return Total dataset count, which is also the size of its value record.
+ */
+[[nodiscard]] inline size_t dataset_count(const Frame& frame) noexcept
+{
+  size_t count = 0;
+  for (const auto& group : frame.groups)
+    count += group.datasets.size();
+
+  return count;
+}
+
+/**
+ * @brief Captures the dataset values of a frame into a flat value record.
+ *
+ * Values are appended group by group, dataset by dataset, which is the same
+ * order used by apply_frame_values() and by the exporters that walk a schema.
+ *
+ * @param frame  Source frame.
+ * @param values Output record, resized to dataset_count(frame).
+ */
+inline void capture_frame_values(const Frame& frame, std::vector<DatasetValue>& values)
+{
+  values.clear();
+  values.reserve(dataset_count(frame));
+  for (const auto& group : frame.groups)
+    for (const auto& dataset : group.datasets)
+      values.push_back({dataset.value, dataset.numericValue, dataset.isNumeric});
+}
+
+/**
+ * @brief Writes a flat value record back into a structurally matching frame.
+ *
+ * @param frame  Destination frame, usually a copy of the record's schema.
+ * @param values Value record produced by capture_frame_values().
+ */
+inline void apply_frame_values(Frame& frame, const std::vector<DatasetValue>& values) noexcept
+{
+  size_t k = 0;
+  for (auto& group : frame.groups) {
+    for (auto& dataset : group.datasets) {
+      if (k >= values.size()) [[unlikely]]
+        return;
+
+      const auto& v        = values[k++];
+      dataset.value        = v.value;
+      dataset.numericValue = v.numericValue;
+      dataset.isNumeric    = v.isNumeric;
+    }
+  }
+}
+
 /**
  * @brief Represents a single timestamped frame for data export.
  *
- * Stores a JSON frame and the associated reception timestamp using
- * steady_clock with nanosecond precision. This is optimized for high-frequency
- * data acquisition (192kHz+) where timestamp precision and low overhead are
- * critical.
+ * Pairs a shared, immutable frame schema with a compact value record and the
+ * reception timestamp (steady_clock, nanosecond precision). This is optimized
+ * for high-frequency data acquisition (192kHz+) where a deep copy of every
+ * group, dataset and string per frame would cost more than parsing it.
  *
  * **Design Rationale:**
- * - Frame data is embedded by value for single-allocation efficiency
- * - When wrapped in TimestampedFramePtr (shared_ptr), only ONE heap allocation
- *   is needed per frame, compared to two with nested shared_ptr
+ * - The schema is shared by reference; only values are captured per frame
+ * - Numeric datasets carry no string payload, so the record is a single
+ *   allocation of sizeof(DatasetValue) × dataset count
  * - Single timestamp (steady_clock) provides nanosecond precision with minimal
  *   syscall overhead. Wall-clock time can be derived using a cached offset
  *   when needed (see MDF4::ExportWorker).
  *
- * **Memory Layout:**
- * - data: sizeof(Frame) bytes (embedded by value)
- * - timestamp: 8 bytes (nanosecond-precision monotonic time)
- * - Total: sizeof(Frame) + 8 bytes (single contiguous allocation)
+ * **Consumers:**
+ * - Walk `schema->groups` / `datasets` in order with a running index into
+ *   `values` (CSV::Export, MDF4::Export)
+ * - Or rebuild a full Frame off the hotpath with materialize_frame()
+ *   (API::Server, gRPC)
+ * - Sparse updates list the refreshed ordinals in `dirty`; `values` always
+ *   holds the complete record, with last known values for the rest
  *
  * **Thread Safety:**
  * - Safe: Reading from multiple threads after construction
  * - Unsafe: Concurrent construction or modification
  * - Move-only semantics prevent accidental copies
  *
- * **Performance:**
- * - Construction: O(n) where n = frame complexity (copy into embedded storage)
- * - Single allocation when used with make_shared<TimestampedFrame>
- * - Better cache locality than pointer indirection
- * - Copy: Disabled (move-only type)
- * - Move: O(1) - transfers ownership
- *
  * @see TimestampedFramePtr for the canonical shared wrapper type
  */
 struct TimestampedFrame {
   using SteadyClock     = std::chrono::steady_clock;
   using SteadyTimePoint = SteadyClock::time_point;
 
-  DataModel::Frame data;
+  FrameSchemaPtr schema;
+  std::vector<DatasetValue> values;
+  DirtyDatasets dirty;
   SteadyTimePoint timestamp;
 
   /**
@@ -1259,26 +1654,20 @@ struct TimestampedFrame {
   TimestampedFrame() = default;
 
   /**
-   * @brief Constructs a timestamped frame by copying frame data.
-   *
-   * Copies the frame data and captures high-resolution monotonic time
-   * (steady_clock) at construction with nanosecond precision.
-   *
-   * @param f Frame data to copy into this timestamped frame
-   */
-  explicit TimestampedFrame(const DataModel::Frame& f) : data(f), timestamp(SteadyClock::now()) {}
-
-  /**
-   * @brief Constructs a timestamped frame by moving frame data.
+   * @brief Captures the values of a frame against a shared schema.
    *
-   * Moves the frame data and captures high-resolution monotonic time
-   * (steady_clock) at construction with nanosecond precision.
+   * Records the frame's dataset values and captures high-resolution
+   * monotonic time (steady_clock) at construction with nanosecond precision.
    *
-   * @param f Frame data to move into this timestamped frame
+   * @param s Schema that is structurally equivalent to @p f
+   * @param f Frame whose values are captured
+   * @param d Ordinals refreshed by this update, empty for a full update
    */
-  explicit TimestampedFrame(DataModel::Frame&& f) noexcept
-    : data(std::move(f)), timestamp(SteadyClock::now())
-  {}
+  TimestampedFrame(FrameSchemaPtr s, const DataModel::Frame& f, DirtyDatasets d = {})
+    : schema(std::move(s)), dirty(std::move(d)), timestamp(SteadyClock::now())
+  {
+    capture_frame_values(f, values);
+  }
 
   TimestampedFrame(TimestampedFrame&&) noexcept            = default;
   TimestampedFrame(const TimestampedFrame&)                = delete;
@@ -1286,6 +1675,25 @@ struct TimestampedFrame {
   TimestampedFrame& operator=(const TimestampedFrame&)     = delete;
 };
 
+/**
+ * @brief Rebuilds a complete Frame from a timestamped value record.
+ *
+ * Copies the schema and applies the captured values. Meant for consumers
+ * that need a full Frame (e.g. JSON serialization) and run off the hotpath.
+ *
+ * @param frame The timestamped frame to expand.
+ * @return A self-contained Frame with the captured values.
+ */
+[[nodiscard]] inline Frame materialize_frame(const TimestampedFrame& frame)
+{
+  if (!frame.schema) [[unlikely]]
+    return {};
+
+  Frame f = *frame.schema;
+  apply_frame_values(f, frame.values);
+  return f;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Shared pointer definitions
 //--------------------------------------------------------------------------------------------------
@@ -1305,14 +1713,14 @@ struct TimestampedFrame {
  * - **Move semantics**: TimestampedFrame itself is move-only (non-copyable)
  *   to prevent accidental copies, so it must be wrapped in a shared_ptr for
  *   multi-consumer scenarios.
- * - **Thread safety**: The underlying Frame data is immutable
- *   (std::shared_ptr<const Frame>), ensuring safe concurrent access from
- *   worker threads.
+ * - **Thread safety**: The schema is immutable (FrameSchemaPtr) and the value
+ *   record is never modified after construction, ensuring safe concurrent
+ *   access from worker threads.
  *
  * **Usage:**
  * - **Producer (FrameBuilder)**: Creates a TimestampedFramePtr via
- *   `std::make_shared<TimestampedFrame>(frame_data)` and distributes it to
- *   all registered consumers.
+ *   `std::make_shared<TimestampedFrame>(schema, frame_data)` and distributes
+ *   it to all registered consumers.
  * - **Consumers (CSV::Export, MDF4::Export)**: Receive TimestampedFramePtr
  *   through lock-free queues and process asynchronously on worker threads.
  *
@@ -102,6 +102,98 @@ void parseCsvValues(const QByteArray& data, QStringList& out, const int reserveH
   }
 }
 
+/**
+ * @brief Assigns a CSV/text channel value to a dataset.
+ *
+ * @param dataset Dataset to update.
+ * @param channel Channel text as received or exported.
+ */
+static inline void assignChannel(DataModel::Dataset& dataset, const QString& channel)
+{
+  dataset.value        = channel;
+  dataset.numericValue = channel.toDouble(&dataset.isNumeric);
+}
+
+/**
+ * @brief Assigns a natively decoded numeric channel value to a dataset.
+ *
+ * @param dataset Dataset to update.
+ * @param channel Value produced by a DataModel::BinaryDecoder.
+ */
+static inline void assignChannel(DataModel::Dataset& dataset, const double channel)
+{
+  dataset.value.clear();
+  dataset.numericValue = channel;
+  dataset.isNumeric    = true;
+}
+
+/**
+ * @brief Assigns a typed script channel value to a dataset.
+ *
+ * Numbers are written to numericValue only; the string form is left empty
+ * and produced on demand by DataModel::dataset_text().
+ *
+ * @param dataset Dataset to update.
+ * @param channel Typed channel value returned by the frame parser.
+ */
+static inline void assignChannel(DataModel::Dataset& dataset,
+                                 const DataModel::ChannelValue& channel)
+{
+  if (const auto* text = std::get_if<QString>(&channel)) [[unlikely]] {
+    assignChannel(dataset, *text);
+    return;
+  }
+
+  dataset.value.clear();
+  dataset.numericValue = DataModel::channelToDouble(channel, &dataset.isNumeric);
+}
+
+/**
+ * @brief Assigns replayed channel values to the datasets of a frame.
+ *
+ * Transforms are not applied, because exported data is already transformed.
+ *
+ * @param frame    Frame to update.
+ * @param channels Replayed values, where channel N feeds Frame Index N + 1.
+ */
+template<typename Channels>
+static void assignPlaybackChannels(DataModel::Frame& frame, const Channels& channels)
+{
+  const auto* channelData = channels.data();
+  const int channelCount  = static_cast<int>(channels.size());
+  for (auto& group : frame.groups) {
+    for (auto& dataset : group.datasets) {
+      const int idx = dataset.index;
+      if (idx <= 0 || idx > channelCount) [[unlikely]]
+        continue;
+
+      assignChannel(dataset, channelData[idx - 1]);
+    }
+  }
+}
+
+/**
+ * @brief Returns the text form of replayed channel values, used only when
+ *        the Quick Plot frame has to be rebuilt.
+ */
+static QStringList channelStrings(const QStringList& channels)
+{
+  return channels;
+}
+
+/**
+ * @copydoc channelStrings(const QStringList&)
+ */
+static QStringList channelStrings(const std::vector<double>& channels)
+{
+  QStringList list;
+  list.reserve(static_cast<qsizetype>(channels.size()));
+  for (const auto value : channels)
+    list.append(QString::number(value, 'g', 15));
+
+  return list;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Constructor & singleton access
 //--------------------------------------------------------------------------------------------------
@@ -112,7 +204,7 @@ void parseCsvValues(const QByteArray& data, QStringList& out, const int reserveH
 DataModel::FrameBuilder::FrameBuilder()
   : m_quickPlotChannels(-1), m_quickPlotHasHeader(false), m_timestampedFramesEnabled(false)
 {
-  // Configure the single-shot JS watchdog used by applyTransform() to
+  // Configure the single-shot JS watchdog used by runJsTransforms() to
   // interrupt runaway user scripts. The timer fires on the main thread
   // while the QJSEngine call is still executing — setInterrupted() flips
   // an atomic flag that the JS VM checks on the next opcode, causing the
@@ -210,6 +302,8 @@ void DataModel::FrameBuilder::syncFromProjectModel()
 
   clear_frame(m_frame);
   m_sourceFrames.clear();
+  m_frameSchemas.clear();
+  m_channelSlots.clear();
 
   m_frame.title   = pm.title();
   m_frame.groups  = pm.groups();
@@ -295,6 +389,86 @@ void DataModel::FrameBuilder::hotpathRxSourceFrame(int sourceId, const QByteArra
   parseProjectFrame(sourceId, data);
 }
 
+/**
+ * @brief Builds a frame from replayed text cells (CSV playback).
+ *
+ * @param channels Cells of the replayed row, without the timestamp column.
+ */
+void DataModel::FrameBuilder::hotpathRxPlaybackFrame(const QStringList& channels)
+{
+  applyPlaybackFrame(-1, channels);
+}
+
+/**
+ * @brief Builds a frame from replayed numeric values (MDF4 playback).
+ *
+ * @param channels Values of the replayed record.
+ */
+void DataModel::FrameBuilder::hotpathRxPlaybackFrame(const std::vector<double>& channels)
+{
+  applyPlaybackFrame(-1, channels);
+}
+
+/**
+ * @brief Builds a per-source frame from replayed text cells.
+ *
+ * @param sourceId Source whose columns are contained in @p channels.
+ * @param channels Cells that belong to @p sourceId, in export order.
+ */
+void DataModel::FrameBuilder::hotpathRxPlaybackFrame(int sourceId, const QStringList& channels)
+{
+  applyPlaybackFrame(sourceId, channels);
+}
+
+/**
+ * @brief Builds a per-source frame from replayed numeric values.
+ *
+ * @param sourceId Source whose channels are contained in @p channels.
+ * @param channels Values that belong to @p sourceId, in export order.
+ */
+void DataModel::FrameBuilder::hotpathRxPlaybackFrame(int sourceId,
+                                                     const std::vector<double>& channels)
+{
+  applyPlaybackFrame(sourceId, channels);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Session management
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Prepares the frame pipeline for a new stream of data.
+ *
+ * Reloads the frame parser scripts and recompiles the dataset transforms of
+ * the loaded project. Called when a device connects, and by the batch
+ * reprocessor before it feeds a recorded file through the pipeline.
+ */
+void DataModel::FrameBuilder::openSession()
+{
+  m_quickPlotChannels = -1;
+
+  if (AppState::instance().operationMode() != SerialStudio::ProjectFile)
+    return;
+
+  Q_ASSERT(!m_frame.title.isEmpty());
+  DataModel::FrameParser::instance().readCode();
+  compileTransforms();
+}
+
+/**
+ * @brief Releases the per-session state built while data was streaming.
+ *
+ * Clears per-source frames, export schemas, CAN slot tables and the
+ * transform engines.
+ */
+void DataModel::FrameBuilder::closeSession()
+{
+  m_sourceFrames.clear();
+  m_frameSchemas.clear();
+  m_channelSlots.clear();
+  destroyTransformEngines();
+}
+
 //--------------------------------------------------------------------------------------------------
 // Private slots
 //--------------------------------------------------------------------------------------------------
@@ -310,20 +484,16 @@ void DataModel::FrameBuilder::onConnectedChanged()
   // Reset quick-plot channel count
   m_quickPlotChannels = -1;
 
-  // Clear per-source frames and transform engines on disconnect
+  // Clear per-source frames, export schemas and transform engines on disconnect
   if (!IO::ConnectionManager::instance().isConnected()) {
-    m_sourceFrames.clear();
-    destroyTransformEngines();
+    closeSession();
     return;
   }
 
   if (AppState::instance().operationMode() != SerialStudio::ProjectFile)
     return;
 
-  // Reload parser scripts and recompile transforms for the new session
-  Q_ASSERT(!m_frame.title.isEmpty());
-  DataModel::FrameParser::instance().readCode();
-  compileTransforms();
+  openSession();
 
   const auto& actions = m_frame.actions;
   for (const auto& action : actions)
@@ -380,61 +550,91 @@ void DataModel::FrameBuilder::parseProjectFrame(const QByteArray& data)
   Q_ASSERT(!data.isEmpty());
   Q_ASSERT(!m_frame.groups.empty());
 
-  // Decode via JS parser or CSV fallback
-  QList<QStringList> multiChannels;
-
-  if (!SerialStudio::isAnyPlayerOpen()) [[likely]] {
-    auto& parser             = DataModel::FrameParser::instance();
-    const auto decoderMethod = DataModel::ProjectModel::instance().decoderMethod();
-
-    switch (decoderMethod) {
-      case SerialStudio::Hexadecimal:
-        multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toHex()), 0);
-        break;
-      case SerialStudio::Base64:
-        multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toBase64()), 0);
-        break;
-      case SerialStudio::Binary:
-        multiChannels = parser.parseMultiFrame(data, 0);
-        break;
-      case SerialStudio::PlainText:
-      default:
-        multiChannels = parser.parseMultiFrame(QString::fromUtf8(data), 0);
-        break;
-    }
-  } else {
-    auto& channels = m_channelScratch;
-    parseCsvValues(data, channels, 64);
-    multiChannels.append(channels);
-  }
-
-  auto applyChannelData = [this](const QStringList& chs, int srcId) {
+  // Returns false if the channel list refreshed none of the datasets
+  auto applyChannelData = [this](const auto& chs, int srcId) {
     const auto* channelData = chs.data();
     const int channelCount  = chs.size();
+
+    bool sparse     = false;
+    quint32 ordinal = 0;
+    m_dirtyDatasets.clear();
     for (auto& group : m_frame.groups) {
       for (auto& dataset : group.datasets) {
-        const int idx = dataset.index;
-        if (idx <= 0 || idx > channelCount) [[unlikely]]
+        const auto current = ordinal++;
+        const int idx      = dataset.index;
+        if (idx <= 0 || idx > channelCount) [[unlikely]] {
+          sparse |= idx > channelCount;
           continue;
+        }
 
-        dataset.value        = channelData[idx - 1];
-        dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
+        assignChannel(dataset, channelData[idx - 1]);
+        m_dirtyDatasets.push_back(current);
 
         // Skip transforms during playback — exported data is already transformed
         if (!dataset.transformCode.isEmpty() && dataset.isNumeric
-            && !SerialStudio::isAnyPlayerOpen()) {
-          dataset.numericValue = applyTransform(srcId, dataset.uniqueId, dataset.numericValue);
-          dataset.value        = QString::number(dataset.numericValue, 'g', 15);
-        }
+            && !SerialStudio::isAnyPlayerOpen())
+          applyTransform(srcId, dataset);
       }
     }
+
+    flushTransforms(srcId);
+    return finishChannelUpdate(sparse);
   };
 
+  // Playback replays exported CSV text, no frame parser involved
+  if (SerialStudio::isAnyPlayerOpen()) [[unlikely]] {
+    auto& channels = m_channelScratch;
+    parseCsvValues(data, channels, 64);
+    if (!channels.isEmpty() && applyChannelData(channels, 0))
+      hotpathTxFrame(m_frame, m_dirtyDatasets);
+
+    return;
+  }
+
+  auto& parser             = DataModel::FrameParser::instance();
+  const auto decoderMethod = DataModel::ProjectModel::instance().decoderMethod();
+
+  // Fixed binary and CAN layouts are decoded natively, without the script engine
+  if (decoderMethod == SerialStudio::Binary) {
+    if (const auto* can = parser.canDecoder(0)) {
+      if (can->decode(data, m_canScratch) && applyCanSamples(m_frame, 0))
+        hotpathTxFrame(m_frame, m_dirtyDatasets);
+
+      return;
+    }
+
+    if (const auto* decoder = parser.binaryDecoder(0)) {
+      if (decoder->decode(data, m_binaryScratch) && applyChannelData(m_binaryScratch, 0))
+        hotpathTxFrame(m_frame, m_dirtyDatasets);
+
+      return;
+    }
+  }
+
+  // Decode via the frame parser script
+  QList<ChannelList> multiChannels;
+  switch (decoderMethod) {
+    case SerialStudio::Hexadecimal:
+      multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toHex()), 0);
+      break;
+    case SerialStudio::Base64:
+      multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toBase64()), 0);
+      break;
+    case SerialStudio::Binary:
+      multiChannels = parser.parseMultiFrame(data, 0);
+      break;
+    case SerialStudio::PlainText:
+    default:
+      multiChannels = parser.parseMultiFrame(QString::fromUtf8(data), 0);
+      break;
+  }
+
   for (const auto& channels : std::as_const(multiChannels)) {
     if (channels.isEmpty()) [[unlikely]]
       continue;
-    applyChannelData(channels, 0);
-    hotpathTxFrame(m_frame);
+
+    if (applyChannelData(channels, 0))
+      hotpathTxFrame(m_frame, m_dirtyDatasets);
   }
 }
 
@@ -449,91 +649,241 @@ void DataModel::FrameBuilder::parseProjectFrame(int sourceId, const QByteArray&
   Q_ASSERT(sourceId >= 0);
   Q_ASSERT(!data.isEmpty());
 
-  // Decode via source-specific parser
-  QList<QStringList> multiChannels;
+  auto applyChannelData = [this, sourceId](const auto& chs) {
+    const auto* channelData = chs.data();
+    const int channelCount  = chs.size();
 
-  if (!SerialStudio::isAnyPlayerOpen()) [[likely]] {
-    auto& parser = DataModel::FrameParser::instance();
+    bool sparse     = false;
+    quint32 ordinal = 0;
+    m_dirtyDatasets.clear();
 
-    SerialStudio::DecoderMethod decoderMethod = DataModel::ProjectModel::instance().decoderMethod();
-    const auto& sources                       = DataModel::ProjectModel::instance().sources();
-    for (const auto& src : sources) {
-      if (src.sourceId == sourceId) {
-        decoderMethod = static_cast<SerialStudio::DecoderMethod>(src.decoderMethod);
-        break;
+    DataModel::Frame& srcFrame = sourceFrame(sourceId);
+    for (auto& group : srcFrame.groups) {
+      for (auto& dataset : group.datasets) {
+        const auto current = ordinal++;
+        const int idx      = dataset.index;
+        if (idx <= 0 || idx > channelCount) [[unlikely]] {
+          sparse |= idx > channelCount;
+          continue;
+        }
+
+        assignChannel(dataset, channelData[idx - 1]);
+        m_dirtyDatasets.push_back(current);
+
+        // Skip transforms during playback — exported data is already transformed
+        if (!dataset.transformCode.isEmpty() && dataset.isNumeric
+            && !SerialStudio::isAnyPlayerOpen())
+          applyTransform(sourceId, dataset);
       }
     }
 
-    switch (decoderMethod) {
-      case SerialStudio::Hexadecimal:
-        multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toHex()), sourceId);
-        break;
-      case SerialStudio::Base64:
-        multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toBase64()), sourceId);
-        break;
-      case SerialStudio::Binary:
-        multiChannels = parser.parseMultiFrame(data, sourceId);
-        break;
-      case SerialStudio::PlainText:
-      default:
-        multiChannels = parser.parseMultiFrame(QString::fromUtf8(data), sourceId);
-        break;
-    }
-  } else {
+    flushTransforms(sourceId);
+    if (finishChannelUpdate(sparse))
+      hotpathTxFrame(srcFrame, m_dirtyDatasets);
+  };
+
+  // Playback replays exported CSV text, no frame parser involved
+  if (SerialStudio::isAnyPlayerOpen()) [[unlikely]] {
     auto& channels = m_channelScratch;
     parseCsvValues(data, channels, 64);
-    multiChannels.append(channels);
-  }
+    if (!channels.isEmpty())
+      applyChannelData(channels);
 
-  auto applyChannelData = [this, sourceId](const QStringList& chs) {
-    const auto* channelData = chs.data();
-    const int channelCount  = chs.size();
+    return;
+  }
 
-    // Create source frame on first encounter (single lookup)
-    auto it = m_sourceFrames.find(sourceId);
-    if (it == m_sourceFrames.end()) [[unlikely]] {
-      DataModel::Frame newFrame;
-      newFrame.sourceId                   = sourceId;
-      newFrame.title                      = m_frame.title;
-      newFrame.actions                    = m_frame.actions;
-      newFrame.containsCommercialFeatures = m_frame.containsCommercialFeatures;
-      for (const auto& g : m_frame.groups)
-        if (g.sourceId == sourceId)
-          newFrame.groups.push_back(g);
+  // Decode via source-specific parser
+  auto& parser = DataModel::FrameParser::instance();
 
-      it = m_sourceFrames.insert(sourceId, std::move(newFrame));
+  SerialStudio::DecoderMethod decoderMethod = DataModel::ProjectModel::instance().decoderMethod();
+  const auto& sources                       = DataModel::ProjectModel::instance().sources();
+  for (const auto& src : sources) {
+    if (src.sourceId == sourceId) {
+      decoderMethod = static_cast<SerialStudio::DecoderMethod>(src.decoderMethod);
+      break;
     }
+  }
 
-    DataModel::Frame& srcFrame = it.value();
-    for (auto& group : srcFrame.groups) {
-      for (auto& dataset : group.datasets) {
-        const int idx = dataset.index;
-        if (idx <= 0 || idx > channelCount) [[unlikely]]
-          continue;
+  // Fixed binary and CAN layouts are decoded natively, without the script engine
+  if (decoderMethod == SerialStudio::Binary) {
+    if (const auto* can = parser.canDecoder(sourceId)) {
+      auto& srcFrame = sourceFrame(sourceId);
+      if (can->decode(data, m_canScratch) && applyCanSamples(srcFrame, sourceId))
+        hotpathTxFrame(srcFrame, m_dirtyDatasets);
 
-        dataset.value        = channelData[idx - 1];
-        dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
+      return;
+    }
 
-        // Skip transforms during playback — exported data is already transformed
-        if (!dataset.transformCode.isEmpty() && dataset.isNumeric
-            && !SerialStudio::isAnyPlayerOpen()) {
-          dataset.numericValue = applyTransform(sourceId, dataset.uniqueId, dataset.numericValue);
-          dataset.value        = QString::number(dataset.numericValue, 'g', 15);
-        }
-      }
+    if (const auto* decoder = parser.binaryDecoder(sourceId)) {
+      if (decoder->decode(data, m_binaryScratch)) [[likely]]
+        applyChannelData(m_binaryScratch);
+
+      return;
     }
-  };
+  }
+
+  QList<ChannelList> multiChannels;
+  switch (decoderMethod) {
+    case SerialStudio::Hexadecimal:
+      multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toHex()), sourceId);
+      break;
+    case SerialStudio::Base64:
+      multiChannels = parser.parseMultiFrame(QString::fromLatin1(data.toBase64()), sourceId);
+      break;
+    case SerialStudio::Binary:
+      multiChannels = parser.parseMultiFrame(data, sourceId);
+      break;
+    case SerialStudio::PlainText:
+    default:
+      multiChannels = parser.parseMultiFrame(QString::fromUtf8(data), sourceId);
+      break;
+  }
 
   for (const auto& channels : std::as_const(multiChannels)) {
     if (channels.isEmpty()) [[unlikely]]
       continue;
 
     applyChannelData(channels);
+  }
+}
 
-    auto txIt = m_sourceFrames.find(sourceId);
-    if (txIt != m_sourceFrames.end()) [[likely]]
-      hotpathTxFrame(txIt.value());
+/**
+ * @brief Returns the per-source frame, creating it on first encounter.
+ *
+ * The new frame copies the project metadata and only the groups that belong
+ * to @p sourceId.
+ *
+ * @param sourceId Source whose frame is requested.
+ * @return Reference to the cached per-source frame.
+ */
+DataModel::Frame& DataModel::FrameBuilder::sourceFrame(int sourceId)
+{
+  auto it = m_sourceFrames.find(sourceId);
+  if (it == m_sourceFrames.end()) [[unlikely]] {
+    DataModel::Frame newFrame;
+    newFrame.sourceId                   = sourceId;
+    newFrame.title                      = m_frame.title;
+    newFrame.actions                    = m_frame.actions;
+    newFrame.containsCommercialFeatures = m_frame.containsCommercialFeatures;
+    for (const auto& g : m_frame.groups)
+      if (g.sourceId == sourceId)
+        newFrame.groups.push_back(g);
+
+    it = m_sourceFrames.insert(sourceId, std::move(newFrame));
   }
+
+  return it.value();
+}
+
+/**
+ * @brief Returns the channel-index to dataset lookup table for a source.
+ *
+ * The table is built lazily on first use by scanning the dataset indexes of
+ * @p frame, and is dropped whenever the project or connection changes.
+ *
+ * @param sourceId Source whose table is requested.
+ * @param frame    Frame that receives the decoded values for @p sourceId.
+ * @return For each channel index, the positions and ordinals of the datasets
+ *         it feeds.
+ */
+const DataModel::FrameBuilder::ChannelSlots& DataModel::FrameBuilder::channelSlots(
+  int sourceId, const DataModel::Frame& frame)
+{
+  auto it = m_channelSlots.find(sourceId);
+  if (it != m_channelSlots.end()) [[likely]]
+    return it->second;
+
+  ChannelSlots table;
+  quint32 ordinal = 0;
+  for (int g = 0; g < static_cast<int>(frame.groups.size()); ++g) {
+    const auto& datasets = frame.groups[g].datasets;
+    for (int d = 0; d < static_cast<int>(datasets.size()); ++d, ++ordinal) {
+      const int idx = datasets[d].index;
+      if (idx <= 0) [[unlikely]]
+        continue;
+
+      if (static_cast<int>(table.size()) <= idx)
+        table.resize(idx + 1);
+
+      table[idx].push_back({g, d, ordinal});
+    }
+  }
+
+  return m_channelSlots.emplace(sourceId, std::move(table)).first->second;
+}
+
+/**
+ * @brief Writes the samples of a decoded CAN message into their datasets.
+ *
+ * Only the datasets fed by the received message are touched; every other
+ * dataset keeps the value of the message that last updated it. The touched
+ * ordinals are collected in m_dirtyDatasets so that consumers can process
+ * the update as a delta. The first update after the lookup table is (re)built
+ * is published as a full update, so consumers resynchronize their structure.
+ *
+ * @param frame    Frame that receives the samples in m_canScratch.
+ * @param sourceId Source that produced the CAN message.
+ * @return @c true if the frame should be published.
+ */
+bool DataModel::FrameBuilder::applyCanSamples(DataModel::Frame& frame, int sourceId)
+{
+  const bool fullUpdate = !m_channelSlots.contains(sourceId);
+  m_dirtyDatasets.clear();
+
+  const auto& table    = channelSlots(sourceId, frame);
+  const int tableSize  = static_cast<int>(table.size());
+  const int groupCount = static_cast<int>(frame.groups.size());
+  for (const auto& sample : m_canScratch) {
+    if (sample.index <= 0 || sample.index >= tableSize) [[unlikely]]
+      continue;
+
+    for (const auto& pos : table[sample.index]) {
+      if (pos.group >= groupCount) [[unlikely]]
+        continue;
+
+      auto& datasets = frame.groups[pos.group].datasets;
+      if (pos.dataset >= static_cast<int>(datasets.size())) [[unlikely]]
+        continue;
+
+      auto& dataset = datasets[pos.dataset];
+      assignChannel(dataset, sample.value);
+      if (!dataset.transformCode.isEmpty())
+        applyTransform(sourceId, dataset);
+
+      m_dirtyDatasets.push_back(pos.ordinal);
+    }
+  }
+
+  flushTransforms(sourceId);
+
+  if (fullUpdate) [[unlikely]] {
+    m_dirtyDatasets.clear();
+    return true;
+  }
+
+  return !m_dirtyDatasets.empty();
+}
+
+/**
+ * @brief Turns the datasets refreshed by a channel list into a dirty list.
+ *
+ * Frame parsers and binary layouts usually return every channel, which is
+ * published as a full update. A shorter channel list (e.g. a multiplexed
+ * packet) leaves the datasets past its end at their last known value, so the
+ * ordinals collected in m_dirtyDatasets are kept and the update is sparse.
+ *
+ * @param sparse @c true if a dataset was skipped because its channel index
+ *               is beyond the end of the channel list.
+ * @return @c true if the frame should be published.
+ */
+bool DataModel::FrameBuilder::finishChannelUpdate(bool sparse)
+{
+  if (!sparse) [[likely]] {
+    m_dirtyDatasets.clear();
+    return true;
+  }
+
+  return !m_dirtyDatasets.empty();
 }
 
 /**
@@ -550,8 +900,7 @@ void DataModel::FrameBuilder::parseQuickPlotFrame(const QByteArray& data)
   const int reserveHint = (m_quickPlotChannels > 0) ? m_quickPlotChannels : 64;
   parseCsvValues(data, channels, reserveHint);
 
-  const int channelCount = channels.size();
-  if (channelCount <= 0)
+  if (channels.isEmpty())
     return;
 
   if (m_quickPlotChannels == -1) {
@@ -572,12 +921,29 @@ void DataModel::FrameBuilder::parseQuickPlotFrame(const QByteArray& data)
     }
   }
 
+  applyQuickPlotChannels(channels);
+}
+
+/**
+ * @brief Writes channel values into the Quick Plot frame and publishes it.
+ *
+ * Rebuilds the frame structure first if the channel count changed.
+ *
+ * @param channels Text cells or numeric values, one per channel.
+ */
+template<typename Channels>
+void DataModel::FrameBuilder::applyQuickPlotChannels(const Channels& channels)
+{
+  const int channelCount = static_cast<int>(channels.size());
+  if (channelCount <= 0) [[unlikely]]
+    return;
+
   if (channelCount != m_quickPlotChannels) [[unlikely]] {
-    buildQuickPlotFrame(channels);
+    buildQuickPlotFrame(channelStrings(channels));
     m_quickPlotChannels = channelCount;
   }
 
-  const auto* channelData = channels.constData();
+  const auto* channelData = channels.data();
   const size_t groupCount = m_quickPlotFrame.groups.size();
   for (size_t g = 0; g < groupCount; ++g) {
     auto& group               = m_quickPlotFrame.groups[g];
@@ -585,16 +951,49 @@ void DataModel::FrameBuilder::parseQuickPlotFrame(const QByteArray& data)
     for (size_t d = 0; d < datasetCount; ++d) {
       auto& dataset = group.datasets[d];
       const int idx = dataset.index;
-      if (idx > 0 && idx <= channelCount) [[likely]] {
-        dataset.value        = channelData[idx - 1];
-        dataset.numericValue = dataset.value.toDouble(&dataset.isNumeric);
-      }
+      if (idx > 0 && idx <= channelCount) [[likely]]
+        assignChannel(dataset, channelData[idx - 1]);
     }
   }
 
   hotpathTxFrame(m_quickPlotFrame);
 }
 
+/**
+ * @brief Writes replayed channel values into the frame model and publishes it.
+ *
+ * Playback hands typed values straight to the frame model, so rows are never
+ * formatted to text and parsed back. In Quick Plot mode the values feed the
+ * Quick Plot frame; in project mode they feed the project frame, or the
+ * per-source frame when @p sourceId is not negative.
+ *
+ * @param sourceId Source that owns @p channels, or -1 for the whole frame.
+ * @param channels Text cells or numeric values, in export order.
+ */
+template<typename Channels>
+void DataModel::FrameBuilder::applyPlaybackFrame(int sourceId, const Channels& channels)
+{
+  if (channels.empty()) [[unlikely]]
+    return;
+
+  switch (AppState::instance().operationMode()) {
+    case SerialStudio::QuickPlot:
+      applyQuickPlotChannels(channels);
+      break;
+    case SerialStudio::ProjectFile: {
+      if (m_frame.groups.empty()) [[unlikely]]
+        break;
+
+      auto& frame = sourceId < 0 ? m_frame : sourceFrame(sourceId);
+      assignPlaybackChannels(frame, channels);
+      hotpathTxFrame(frame);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // Quick-plot project generation functions
 //--------------------------------------------------------------------------------------------------
@@ -643,6 +1042,7 @@ void DataModel::FrameBuilder::buildQuickPlotFrame(const QStringList& channels)
   }
 
   clear_frame(m_quickPlotFrame);
+  m_frameSchemas.clear();
   m_quickPlotFrame.title = tr("Quick Plot");
 
   DataModel::Group datagrid;
@@ -765,6 +1165,7 @@ void DataModel::FrameBuilder::buildQuickPlotAudioFrame(const QStringList& channe
     group.widget = QStringLiteral("multiplot");
 
   clear_frame(m_quickPlotFrame);
+  m_frameSchemas.clear();
   m_quickPlotFrame.title = tr("Quick Plot");
   m_quickPlotFrame.groups.push_back(group);
   finalize_frame(m_quickPlotFrame);
@@ -796,8 +1197,11 @@ void DataModel::FrameBuilder::updateTimestampedFramesEnabled()
  * @brief Publishes a fully constructed DataModel frame to all registered output modules.
  *
  * @param frame The fully populated frame to distribute.
+ * @param dirty Ordinals of the datasets refreshed by this update, or an empty
+ *              list if every dataset was refreshed.
  */
-void DataModel::FrameBuilder::hotpathTxFrame(const DataModel::Frame& frame)
+void DataModel::FrameBuilder::hotpathTxFrame(const DataModel::Frame& frame,
+                                             const DataModel::DirtyDatasets& dirty)
 {
   Q_ASSERT(!frame.groups.empty());
   Q_ASSERT(!frame.title.isEmpty());
@@ -807,10 +1211,11 @@ void DataModel::FrameBuilder::hotpathTxFrame(const DataModel::Frame& frame)
   static auto& dashboard     = UI::Dashboard::instance();
   static auto& pluginsServer = API::Server::instance();
 
-  dashboard.hotpathRxFrame(frame);
+  dashboard.hotpathRxFrame(frame, dirty);
 
   if (m_timestampedFramesEnabled) [[unlikely]] {
-    auto timestampedFrame = std::make_shared<DataModel::TimestampedFrame>(frame);
+    const auto& schema    = frameSchema(frame);
+    auto timestampedFrame = std::make_shared<DataModel::TimestampedFrame>(schema, frame, dirty);
     csvExport.hotpathTxFrame(timestampedFrame);
     mdf4Export.hotpathTxFrame(timestampedFrame);
     pluginsServer.hotpathTxFrame(timestampedFrame);
@@ -822,6 +1227,29 @@ void DataModel::FrameBuilder::hotpathTxFrame(const DataModel::Frame& frame)
   }
 }
 
+/**
+ * @brief Returns the shared export schema for a frame, rebuilding it only when
+ *        the frame's structure, titles or units no longer match the cached
+ *        snapshot.
+ *
+ * Schemas are cached per source, so multi-source projects keep one snapshot
+ * for each of their per-source frames. Titles and units are part of the
+ * comparison because exporters name their columns and channels after them;
+ * a device that renames a dataset without changing the layout gets a new
+ * schema.
+ *
+ * @param frame The frame about to be exported.
+ * @return Immutable schema that matches @p frame.
+ */
+const DataModel::FrameSchemaPtr& DataModel::FrameBuilder::frameSchema(const DataModel::Frame& frame)
+{
+  auto& schema = m_frameSchemas[frame.sourceId];
+  if (!schema || !compare_frame_schemas(*schema, frame)) [[unlikely]]
+    schema = std::make_shared<const DataModel::Frame>(frame);
+
+  return schema;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Per-dataset value transforms
 //--------------------------------------------------------------------------------------------------
@@ -851,6 +1279,153 @@ static void openSafeLibsForTransform(lua_State* L)
   }
 }
 
+/**
+ * @brief Returns the TransformFilters bound to the running dsp.* function.
+ */
+static DataModel::TransformFilters* luaFilters(lua_State* L)
+{
+  return static_cast<DataModel::TransformFilters*>(lua_touserdata(L, lua_upvalueindex(1)));
+}
+
+/**
+ * @brief Lua binding for dsp.sma(value, window).
+ */
+static int luaFilterSma(lua_State* L)
+{
+  const double value = luaL_checknumber(L, 1);
+  const int window   = static_cast<int>(luaL_checknumber(L, 2));
+  lua_pushnumber(L, luaFilters(L)->sma(value, window));
+  return 1;
+}
+
+/**
+ * @brief Lua binding for dsp.ema(value, alpha).
+ */
+static int luaFilterEma(lua_State* L)
+{
+  const double value = luaL_checknumber(L, 1);
+  const double alpha = luaL_checknumber(L, 2);
+  lua_pushnumber(L, luaFilters(L)->ema(value, alpha));
+  return 1;
+}
+
+/**
+ * @brief Lua binding for dsp.biquad(value, b0, b1, b2, a1, a2).
+ */
+static int luaFilterBiquad(lua_State* L)
+{
+  const double value = luaL_checknumber(L, 1);
+  const double b0    = luaL_checknumber(L, 2);
+  const double b1    = luaL_checknumber(L, 3);
+  const double b2    = luaL_checknumber(L, 4);
+  const double a1    = luaL_checknumber(L, 5);
+  const double a2    = luaL_checknumber(L, 6);
+  lua_pushnumber(L, luaFilters(L)->biquad(value, b0, b1, b2, a1, a2));
+  return 1;
+}
+
+/**
+ * @brief Lua binding for dsp.derivative(value[, dt]).
+ */
+static int luaFilterDerivative(lua_State* L)
+{
+  const double value = luaL_checknumber(L, 1);
+  const double dt    = luaL_optnumber(L, 2, 1);
+  lua_pushnumber(L, luaFilters(L)->derivative(value, dt));
+  return 1;
+}
+
+/**
+ * @brief Lua binding for dsp.integrate(value[, dt]).
+ */
+static int luaFilterIntegrate(lua_State* L)
+{
+  const double value = luaL_checknumber(L, 1);
+  const double dt    = luaL_optnumber(L, 2, 1);
+  lua_pushnumber(L, luaFilters(L)->integrate(value, dt));
+  return 1;
+}
+
+/**
+ * @brief Selects the filter state of a dataset, called by the batch runner.
+ */
+static int luaFilterBegin(lua_State* L)
+{
+  luaFilters(L)->begin(static_cast<int>(luaL_checkinteger(L, 1)));
+  return 0;
+}
+
+/**
+ * @brief Registers the global dsp table, bound to @p filters.
+ */
+static void openTransformFilters(lua_State* L, DataModel::TransformFilters* filters)
+{
+  static const luaL_Reg kFilters[] = {
+    {       "sma",        luaFilterSma},
+    {       "ema",        luaFilterEma},
+    {    "biquad",     luaFilterBiquad},
+    {"derivative", luaFilterDerivative},
+    { "integrate",  luaFilterIntegrate},
+    {     nullptr,             nullptr}
+  };
+
+  lua_newtable(L);
+  lua_pushlightuserdata(L, filters);
+  luaL_setfuncs(L, kFilters, 1);
+  lua_setglobal(L, "dsp");
+}
+
+/**
+ * @brief Lua chunk that builds the per-frame transform runner.
+ *
+ * Called with the function, id, value and error tables plus the begin
+ * callback. The returned runner transforms values[1..n] in place, isolates
+ * each dataset with its own pcall and returns the number of failures.
+ */
+static constexpr const char* kLuaTransformBatch = R"(
+local pcall, tostring, fns, ids, values, errors, begin = pcall, tostring, ...
+return function(n)
+  local failed = 0
+  for i = 1, n do
+    local id = ids[i]
+    begin(id)
+    local ok, result = pcall(fns[id], values[i])
+    if ok then
+      values[i] = result
+    else
+      values[i] = nil
+      failed = failed + 1
+      errors[failed] = id .. ": " .. tostring(result)
+    end
+  end
+  return failed
+end
+)";
+
+/**
+ * @brief JavaScript factory for the per-frame transform runner.
+ *
+ * The runner transforms the values array in place and returns the failed
+ * transforms as [uniqueId, message] pairs.
+ */
+static constexpr const char* kJsTransformBatch = R"(
+(function(fns, dsp) {
+  return function(ids, values) {
+    var errors = [];
+    for (var i = 0; i < ids.length; ++i) {
+      dsp.begin(ids[i]);
+      try {
+        values[i] = fns[ids[i]](values[i]);
+      } catch (e) {
+        values[i] = NaN;
+        errors.push([ids[i], String(e)]);
+      }
+    }
+    return errors;
+  };
+})
+)";
+
 /**
  * @brief Lua instruction-count hook that aborts runaway transforms.
  *
@@ -858,7 +1433,7 @@ static void openSafeLibsForTransform(lua_State* L)
  * LUA_MASKCOUNT. Fires every kTransformHookInstrCount instructions: it
  * fetches the owning TransformEngine* from the Lua registry and checks
  * the per-engine deadline. When the deadline has expired, luaL_error()
- * unwinds the current lua_pcall() with an error, which applyTransform()
+ * unwinds the current lua_pcall() with an error, which runLuaTransforms()
  * catches and translates to "return rawValue unchanged".
  */
 void DataModel::FrameBuilder::transformLuaWatchdogHook(lua_State* L, lua_Debug* ar)
@@ -883,9 +1458,12 @@ void DataModel::FrameBuilder::transformLuaWatchdogHook(lua_State* L, lua_Debug*
  * @brief Compiles per-dataset transform expressions into shared engines.
  *
  * Scans all datasets in m_frame.groups. For each source that has at least
- * one dataset with a non-empty transformCode, creates a shared Lua or JS
- * engine and compiles each expression into a named function. The function
- * reference is cached for O(1) lookup during the hotpath.
+ * one dataset with a non-empty transformCode, first tries to compile each
+ * transform natively (see NativeTransform), then creates a shared Lua or JS
+ * engine for the remaining ones and compiles each expression into a named
+ * function. Script transforms are not called one by one: each engine also
+ * gets a runner that evaluates all of a frame's script transforms in a
+ * single call (see flushTransforms()).
  */
 void DataModel::FrameBuilder::compileTransforms()
 {
@@ -922,14 +1500,25 @@ void DataModel::FrameBuilder::compileTransforms()
     Q_ASSERT(inserted);
     TransformEngine& engine = it->second;
 
-    // Delegate to language-specific compiler
-    if (lang == SerialStudio::Lua)
-      compileTransformsLua(engine, entries);
-    else
-      compileTransformsJS(engine, entries);
+    // Plain formulas run natively, everything else needs a script engine
+    std::erase_if(entries, [&](const TransformEntry& entry) {
+      auto native = NativeTransform::compile(entry.code, lang);
+      if (native)
+        engine.nativeRefs.emplace(entry.uniqueId, std::move(*native));
+
+      return native.has_value();
+    });
+
+    // Delegate the remaining transforms to the language-specific compiler
+    if (!entries.empty()) {
+      if (lang == SerialStudio::Lua)
+        compileTransformsLua(engine, entries);
+      else
+        compileTransformsJS(engine, entries);
+    }
 
     // Remove the engine entry if compilation produced nothing useful
-    if (!engine.luaState && !engine.jsEngine)
+    if (!engine.luaState && !engine.jsEngine && engine.nativeRefs.empty())
       m_transformEngines.erase(it);
   }
 }
@@ -938,8 +1527,8 @@ void DataModel::FrameBuilder::compileTransforms()
  * @brief Compiles per-dataset Lua transforms into a shared lua_State.
  *
  * Each dataset's chunk is executed to define a transform() global, which is
- * then renamed to a per-dataset alias and stored via luaL_ref for O(1)
- * hotpath lookup.
+ * then renamed to a per-dataset alias and registered with the batch runner
+ * built from kLuaTransformBatch, keyed by uniqueId.
  */
 void DataModel::FrameBuilder::compileTransformsLua(
   TransformEngine& engine, const std::vector<TransformEntry>& entries)
@@ -961,6 +1550,41 @@ void DataModel::FrameBuilder::compileTransformsLua(
   lua_sethook(L, &FrameBuilder::transformLuaWatchdogHook, LUA_MASKCOUNT,
               kTransformHookInstrCount);
 
+  // Expose the native stateful filters as the dsp table
+  engine.filters = std::make_unique<TransformFilters>();
+  openTransformFilters(L, engine.filters.get());
+
+  // Create the tables shared between C++ and the batch runner
+  lua_newtable(L);
+  const int fnsRef = luaL_ref(L, LUA_REGISTRYINDEX);
+  lua_newtable(L);
+  engine.luaIdsRef = luaL_ref(L, LUA_REGISTRYINDEX);
+  lua_newtable(L);
+  engine.luaValuesRef = luaL_ref(L, LUA_REGISTRYINDEX);
+  lua_newtable(L);
+  engine.luaErrorsRef = luaL_ref(L, LUA_REGISTRYINDEX);
+
+  // Build the batch runner before any user code can touch the globals
+  if (luaL_loadstring(L, kLuaTransformBatch) != LUA_OK) [[unlikely]] {
+    qWarning() << "[FrameBuilder] Transform runner error:" << lua_tostring(L, -1);
+    lua_close(L);
+    return;
+  }
+
+  lua_rawgeti(L, LUA_REGISTRYINDEX, fnsRef);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaIdsRef);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaValuesRef);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaErrorsRef);
+  lua_pushlightuserdata(L, engine.filters.get());
+  lua_pushcclosure(L, luaFilterBegin, 1);
+  if (lua_pcall(L, 5, 1, 0) != LUA_OK) [[unlikely]] {
+    qWarning() << "[FrameBuilder] Transform runner error:" << lua_tostring(L, -1);
+    lua_close(L);
+    return;
+  }
+
+  engine.luaBatchRef = luaL_ref(L, LUA_REGISTRYINDEX);
+
   // Arm the deadline while the user's compile-time chunk runs
   engine.luaDeadline.setRemainingTime(kTransformWatchdogMs);
 
@@ -992,13 +1616,20 @@ void DataModel::FrameBuilder::compileTransformsLua(
     lua_pushnil(L);
     lua_setglobal(L, "transform");
 
-    // Store a registry reference for O(1) hotpath lookup
+    // Store a registry reference and hand the function to the batch runner
     lua_getglobal(L, alias.toUtf8().constData());
     Q_ASSERT(lua_isfunction(L, -1));
+    lua_rawgeti(L, LUA_REGISTRYINDEX, fnsRef);
+    lua_pushvalue(L, -2);
+    lua_rawseti(L, -2, entry.uniqueId);
+    lua_pop(L, 1);
     engine.luaRefs[entry.uniqueId] = luaL_ref(L, LUA_REGISTRYINDEX);
   }
 
-  // Disarm the deadline — subsequent arming happens per-call
+  // The runner keeps the function table alive through its upvalue
+  luaL_unref(L, LUA_REGISTRYINDEX, fnsRef);
+
+  // Disarm the deadline — subsequent arming happens per-frame
   engine.luaDeadline = QDeadlineTimer(QDeadlineTimer::Forever);
   engine.luaState    = L;
 }
@@ -1007,7 +1638,8 @@ void DataModel::FrameBuilder::compileTransformsLua(
  * @brief Compiles per-dataset JavaScript transforms into a shared QJSEngine.
  *
  * Each dataset's code is wrapped in an IIFE so that top-level var
- * declarations become per-dataset closure state.
+ * declarations become per-dataset closure state. The resulting functions are
+ * collected into the batch runner built from kJsTransformBatch.
  */
 void DataModel::FrameBuilder::compileTransformsJS(
   TransformEngine& engine, const std::vector<TransformEntry>& entries)
@@ -1015,6 +1647,12 @@ void DataModel::FrameBuilder::compileTransformsJS(
   // Create a shared QJSEngine for all transforms in this source
   auto* js = new QJSEngine();
 
+  // Expose the native stateful filters as the dsp object
+  engine.filters = std::make_unique<TransformFilters>();
+  QJSEngine::setObjectOwnership(engine.filters.get(), QJSEngine::CppOwnership);
+  const auto dsp = js->newQObject(engine.filters.get());
+  js->globalObject().setProperty(QStringLiteral("dsp"), dsp);
+
   for (const auto& entry : entries) {
     // Wrap the user's code in an IIFE for per-dataset closure isolation
     const QString wrapped =
@@ -1043,6 +1681,18 @@ void DataModel::FrameBuilder::compileTransformsJS(
     engine.jsRefs[entry.uniqueId] = evalResult;
   }
 
+  // Build the batch runner over the compiled functions
+  auto fns = js->newObject();
+  for (const auto& [uniqueId, fn] : engine.jsRefs)
+    fns.setProperty(static_cast<quint32>(uniqueId), fn);
+
+  auto factory   = js->evaluate(QString::fromUtf8(kJsTransformBatch));
+  engine.jsBatch = factory.call({fns, dsp});
+  if (!engine.jsBatch.isCallable()) [[unlikely]] {
+    qWarning() << "[FrameBuilder] Transform runner error:" << engine.jsBatch.toString();
+    engine.jsBatch = QJSValue();
+  }
+
   engine.jsEngine = js;
 }
 
@@ -1055,6 +1705,7 @@ void DataModel::FrameBuilder::destroyTransformEngines()
     // Clear JS function refs BEFORE deleting the engine — QJSValue
     // destructors access the engine's internal state
     engine.jsRefs.clear();
+    engine.jsBatch = QJSValue();
 
     // Release Lua state
     if (engine.luaState) {
@@ -1065,8 +1716,12 @@ void DataModel::FrameBuilder::destroyTransformEngines()
     // Release JS engine (refs already cleared above)
     delete engine.jsEngine;
     engine.jsEngine = nullptr;
+
+    // Release the filter state once no engine can reach it
+    engine.filters.reset();
   }
 
+  m_pendingTransforms.clear();
   m_transformEngines.clear();
   Q_ASSERT(m_transformEngines.empty());
 }
@@ -1074,103 +1729,198 @@ void DataModel::FrameBuilder::destroyTransformEngines()
 /**
  * @brief Applies the pre-compiled transform for a dataset.
  *
- * Looks up the function reference by uniqueId and calls it with the raw
- * numeric value. Returns the transformed value, or @p rawValue if no
- * transform is configured or if the call fails.
+ * Native programs run immediately. Lua and JavaScript transforms are queued
+ * and evaluated together by flushTransforms(), so a frame costs one script
+ * call instead of one per dataset. Until then the dataset keeps its raw
+ * numeric value, which is also what it keeps if the transform fails. The
+ * raw value is queued along with the dataset, so a dataset assigned twice in
+ * one batch is transformed once per sample, in order.
  *
  * @param sourceId  Source that owns the dataset.
- * @param uniqueId  Dataset unique identifier.
- * @param rawValue  Raw numeric value from the frame parser.
- * @return Transformed value, or rawValue on error / missing transform.
+ * @param dataset   Dataset holding the raw numeric value.
  */
-double DataModel::FrameBuilder::applyTransform(int sourceId, int uniqueId, double rawValue)
+void DataModel::FrameBuilder::applyTransform(int sourceId, DataModel::Dataset& dataset)
 {
   Q_ASSERT(sourceId >= 0);
-  Q_ASSERT(uniqueId >= 0);
+  Q_ASSERT(dataset.uniqueId >= 0);
+
+  dataset.value.clear();
 
   auto engineIt = m_transformEngines.find(sourceId);
   if (engineIt == m_transformEngines.end())
-    return rawValue;
+    return;
 
   auto& engine = engineIt->second;
 
-  // Lua transform path
-  if (engine.luaState) {
-    auto refIt = engine.luaRefs.find(uniqueId);
-    if (refIt == engine.luaRefs.end())
-      return rawValue;
+  // Native transform path, no script call or watchdog needed
+  auto nativeIt = engine.nativeRefs.find(dataset.uniqueId);
+  if (nativeIt != engine.nativeRefs.end()) {
+    const double result = nativeIt->second.evaluate(dataset.numericValue);
+    if (std::isfinite(result)) [[likely]]
+      dataset.numericValue = result;
 
-    // Arm the per-call deadline — the lua_sethook watchdog installed in
-    // compileTransforms() will abort the call if it runs past this point.
-    // The deadline is disarmed on exit so out-of-band hook fires don't
-    // interrupt anything unrelated.
-    lua_State* L = engine.luaState;
-    engine.luaDeadline.setRemainingTime(kTransformWatchdogMs);
+    return;
+  }
 
-    lua_rawgeti(L, LUA_REGISTRYINDEX, refIt->second);
-    lua_pushnumber(L, rawValue);
-    const int pcallStatus = lua_pcall(L, 1, 1, 0);
+  // Queue script transforms for the per-frame batch
+  const bool queued = engine.luaState ? engine.luaRefs.contains(dataset.uniqueId)
+                                      : engine.jsRefs.contains(dataset.uniqueId);
+  if (queued)
+    m_pendingTransforms.push_back({&dataset, dataset.uniqueId, dataset.numericValue});
+}
 
-    engine.luaDeadline = QDeadlineTimer(QDeadlineTimer::Forever);
+/**
+ * @brief Evaluates the script transforms queued for a frame.
+ *
+ * Called once the frame's datasets have been assigned, with all datasets
+ * queued by applyTransform() still in place.
+ *
+ * @param sourceId  Source whose engine compiled the queued transforms.
+ */
+void DataModel::FrameBuilder::flushTransforms(int sourceId)
+{
+  if (m_pendingTransforms.empty())
+    return;
 
-    if (pcallStatus != LUA_OK) [[unlikely]] {
-      qWarning() << "[FrameBuilder] Lua transform call failed for dataset"
-                 << uniqueId << ":" << lua_tostring(L, -1);
-      lua_pop(L, 1);
-      return rawValue;
-    }
+  auto engineIt = m_transformEngines.find(sourceId);
+  if (engineIt != m_transformEngines.end()) {
+    if (engineIt->second.luaState)
+      runLuaTransforms(engineIt->second);
+    else if (engineIt->second.jsEngine)
+      runJsTransforms(engineIt->second);
+  }
+
+  m_pendingTransforms.clear();
+}
+
+/**
+ * @brief Runs the queued transforms through the Lua batch runner.
+ *
+ * The ids and raw values are staged in registry tables and transformed in a
+ * single lua_pcall(). The watchdog deadline covers the whole frame; a
+ * dataset whose transform fails or returns a non-finite or non-numeric
+ * value keeps its raw value.
+ */
+void DataModel::FrameBuilder::runLuaTransforms(TransformEngine& engine)
+{
+  lua_State* L    = engine.luaState;
+  const int top   = lua_gettop(L);
+  const int count = static_cast<int>(m_pendingTransforms.size());
+
+  // Stage the dataset ids and raw values
+  lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaIdsRef);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaValuesRef);
+  for (int i = 0; i < count; ++i) {
+    const auto& pending = m_pendingTransforms[i];
+    lua_pushinteger(L, pending.uniqueId);
+    lua_rawseti(L, top + 1, i + 1);
+    lua_pushnumber(L, pending.rawValue);
+    lua_rawseti(L, top + 2, i + 1);
+  }
+
+  // Arm the deadline — the lua_sethook watchdog installed in
+  // compileTransforms() aborts the runner if it runs past this point.
+  // The deadline is disarmed on exit so out-of-band hook fires don't
+  // interrupt anything unrelated.
+  engine.luaDeadline.setRemainingTime(kTransformWatchdogMs);
+
+  lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaBatchRef);
+  lua_pushinteger(L, count);
+  const int pcallStatus = lua_pcall(L, 1, 1, 0);
 
-    // Validate return type — lua_tonumber silently returns 0.0 for nil
-    if (!lua_isnumber(L, -1)) [[unlikely]] {
+  engine.luaDeadline = QDeadlineTimer(QDeadlineTimer::Forever);
+
+  if (pcallStatus != LUA_OK) [[unlikely]] {
+    qWarning() << "[FrameBuilder] Lua transform call failed:" << lua_tostring(L, -1);
+    lua_settop(L, top);
+    return;
+  }
+
+  // Read back the results, lua_tonumber silently returns 0.0 for nil
+  for (int i = 0; i < count; ++i) {
+    auto& pending = m_pendingTransforms[i];
+    lua_rawgeti(L, top + 2, i + 1);
+    const double result          = lua_isnumber(L, -1) ? lua_tonumber(L, -1) : pending.rawValue;
+    pending.dataset->numericValue = std::isfinite(result) ? result : pending.rawValue;
+    lua_pop(L, 1);
+  }
+
+  // Report the datasets whose transform raised an error
+  const auto failed = lua_tointeger(L, -1);
+  if (failed > 0) [[unlikely]] {
+    lua_rawgeti(L, LUA_REGISTRYINDEX, engine.luaErrorsRef);
+    for (lua_Integer i = 1; i <= failed; ++i) {
+      lua_rawgeti(L, -1, i);
+      qWarning() << "[FrameBuilder] Lua transform call failed for dataset"
+                 << lua_tostring(L, -1);
       lua_pop(L, 1);
-      return rawValue;
+      lua_pushnil(L);
+      lua_rawseti(L, -2, i);
     }
+  }
 
-    const double result = lua_tonumber(L, -1);
-    lua_pop(L, 1);
+  lua_settop(L, top);
+}
 
-    // Guard against NaN/Inf propagating to the dashboard
-    if (!std::isfinite(result)) [[unlikely]]
-      return rawValue;
+/**
+ * @brief Runs the queued transforms through the JavaScript batch runner.
+ *
+ * The QJSEngine watchdog covers the whole frame; a dataset whose transform
+ * fails or returns a non-finite or non-numeric value keeps its raw value.
+ */
+void DataModel::FrameBuilder::runJsTransforms(TransformEngine& engine)
+{
+  if (!engine.jsBatch.isCallable()) [[unlikely]]
+    return;
 
-    return result;
+  // Stage the dataset ids and raw values
+  auto* js         = engine.jsEngine;
+  const auto count = static_cast<quint32>(m_pendingTransforms.size());
+  auto ids         = js->newArray(count);
+  auto values      = js->newArray(count);
+  for (quint32 i = 0; i < count; ++i) {
+    const auto& pending = m_pendingTransforms[i];
+    ids.setProperty(i, pending.uniqueId);
+    values.setProperty(i, pending.rawValue);
   }
 
-  // JavaScript transform path
-  if (engine.jsEngine) {
-    auto refIt = engine.jsRefs.find(uniqueId);
-    if (refIt == engine.jsRefs.end())
-      return rawValue;
-
-    // Arm the QJSEngine watchdog: the QTimer fires on the main thread
-    // while call() is still executing, and setInterrupted() flips an
-    // atomic flag the JS VM checks on its next opcode — so the call
-    // unwinds with an error result and we fall back to rawValue.
-    engine.jsEngine->setInterrupted(false);
-    m_jsTransformWatchdog.start();
-
-    QJSValueList args;
-    args << QJSValue(rawValue);
-    auto result = refIt->second.call(args);
-
-    m_jsTransformWatchdog.stop();
-
-    if (engine.jsEngine->isInterrupted()) [[unlikely]] {
-      engine.jsEngine->setInterrupted(false);
-      qWarning() << "[FrameBuilder] JS transform for dataset" << uniqueId
-                 << "timed out after" << kTransformWatchdogMs << "ms";
-      return rawValue;
-    }
+  // Arm the QJSEngine watchdog: the QTimer fires on the main thread
+  // while call() is still executing, and setInterrupted() flips an
+  // atomic flag the JS VM checks on its next opcode — so the call
+  // unwinds with an error result and every dataset keeps its raw value.
+  js->setInterrupted(false);
+  m_jsTransformWatchdog.start();
+
+  const auto errors = engine.jsBatch.call({ids, values});
 
-    if (!result.isNumber())
-      return rawValue;
+  m_jsTransformWatchdog.stop();
 
-    const double val = result.toNumber();
-    if (!std::isfinite(val)) [[unlikely]]
-      return rawValue;
+  if (js->isInterrupted()) [[unlikely]] {
+    js->setInterrupted(false);
+    qWarning() << "[FrameBuilder] JS transforms timed out after" << kTransformWatchdogMs
+               << "ms";
+    return;
+  }
+
+  if (errors.isError()) [[unlikely]] {
+    qWarning() << "[FrameBuilder] JS transform call failed:"
+               << errors.property("message").toString();
+    return;
+  }
 
-    return val;
+  // Read back the results
+  for (quint32 i = 0; i < count; ++i) {
+    auto& pending                 = m_pendingTransforms[i];
+    const auto result             = values.property(i);
+    const double val              = result.isNumber() ? result.toNumber() : pending.rawValue;
+    pending.dataset->numericValue = std::isfinite(val) ? val : pending.rawValue;
   }
 
-  return rawValue;
+  // Report the datasets whose transform threw
+  const auto failed = errors.property(QStringLiteral("length")).toUInt();
+  for (quint32 i = 0; i < failed; ++i) {
+    const auto error = errors.property(i);
+    qWarning() << "[FrameBuilder] JS transform call failed for dataset"
+               << error.property(0).toInt() << ":" << error.property(1).toString();
+  }
 }
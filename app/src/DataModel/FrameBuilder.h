@@ -24,14 +24,19 @@
 #include <lua.h>
 
 #include <map>
+#include <memory>
 #include <QDeadlineTimer>
 #include <QJSEngine>
 #include <QJSValue>
 #include <QMap>
 #include <QObject>
 #include <QTimer>
+#include <vector>
 
+#include "DataModel/CanDecoder.h"
 #include "DataModel/Frame.h"
+#include "DataModel/NativeTransform.h"
+#include "DataModel/TransformFilters.h"
 #include "SerialStudio.h"
 
 namespace DataModel {
@@ -68,6 +73,14 @@ public:
 
   [[nodiscard]] const DataModel::Frame& frame() const noexcept;
 
+  void hotpathRxPlaybackFrame(const QStringList& channels);
+  void hotpathRxPlaybackFrame(const std::vector<double>& channels);
+  void hotpathRxPlaybackFrame(int sourceId, const QStringList& channels);
+  void hotpathRxPlaybackFrame(int sourceId, const std::vector<double>& channels);
+
+  void openSession();
+  void closeSession();
+
 public slots:
   void setupExternalConnections();
   void syncFromProjectModel();
@@ -84,17 +97,49 @@ private:
   void parseProjectFrame(const QByteArray& data);
   void parseProjectFrame(int sourceId, const QByteArray& data);
   void parseQuickPlotFrame(const QByteArray& data);
+
+  template<typename Channels>
+  void applyPlaybackFrame(int sourceId, const Channels& channels);
+  template<typename Channels>
+  void applyQuickPlotChannels(const Channels& channels);
   void buildQuickPlotFrame(const QStringList& channels);
   void buildQuickPlotAudioFrame(const QStringList& channels);
 
-  void hotpathTxFrame(const DataModel::Frame& frame);
+  struct DatasetSlot {
+    int group;
+    int dataset;
+    quint32 ordinal;
+  };
+
+  using ChannelSlots = std::vector<std::vector<DatasetSlot>>;
+
+  [[nodiscard]] DataModel::Frame& sourceFrame(int sourceId);
+  [[nodiscard]] const ChannelSlots& channelSlots(int sourceId, const DataModel::Frame& frame);
+  [[nodiscard]] bool applyCanSamples(DataModel::Frame& frame, int sourceId);
+  [[nodiscard]] bool finishChannelUpdate(bool sparse);
+
+  void hotpathTxFrame(const DataModel::Frame& frame, const DataModel::DirtyDatasets& dirty = {});
+  [[nodiscard]] const DataModel::FrameSchemaPtr& frameSchema(const DataModel::Frame& frame);
 
   struct TransformEngine {
     lua_State* luaState = nullptr;
     QJSEngine* jsEngine = nullptr;
     std::map<int, int> luaRefs;
     std::map<int, QJSValue> jsRefs;
+    std::map<int, NativeTransform> nativeRefs;
     QDeadlineTimer luaDeadline{QDeadlineTimer::Forever};
+    int luaBatchRef  = 0;
+    int luaIdsRef    = 0;
+    int luaValuesRef = 0;
+    int luaErrorsRef = 0;
+    QJSValue jsBatch;
+    std::unique_ptr<TransformFilters> filters;
+  };
+
+  struct PendingTransform {
+    DataModel::Dataset* dataset;
+    int uniqueId;
+    double rawValue;
   };
 
   static constexpr int kTransformWatchdogMs     = 100;
@@ -113,10 +158,14 @@ private:
   void compileTransformsJS(TransformEngine& engine,
                            const std::vector<TransformEntry>& entries);
   void destroyTransformEngines();
-  [[nodiscard]] double applyTransform(int sourceId, int uniqueId, double rawValue);
+  void applyTransform(int sourceId, DataModel::Dataset& dataset);
+  void flushTransforms(int sourceId);
+  void runLuaTransforms(TransformEngine& engine);
+  void runJsTransforms(TransformEngine& engine);
 
 private:
   std::map<int, TransformEngine> m_transformEngines;
+  std::vector<PendingTransform> m_pendingTransforms;
   QTimer m_jsTransformWatchdog;
 
   DataModel::Frame m_frame;
@@ -124,11 +173,16 @@ private:
   DataModel::Frame m_quickPlotFrame;
 
   QMap<int, DataModel::Frame> m_sourceFrames;
+  std::map<int, DataModel::FrameSchemaPtr> m_frameSchemas;
+  std::map<int, ChannelSlots> m_channelSlots;
 
   int m_quickPlotChannels;
   bool m_quickPlotHasHeader;
   QStringList m_quickPlotChannelNames;
   QStringList m_channelScratch;
+  std::vector<double> m_binaryScratch;
+  std::vector<DataModel::CanDecoder::Sample> m_canScratch;
+  DataModel::DirtyDatasets m_dirtyDatasets;
 
   bool m_timestampedFramesEnabled;
 };
@@ -364,6 +364,34 @@ public:
     m_consumerEnabled.store(enabled, std::memory_order_relaxed);
   }
 
+  /**
+   * @brief Checks if the pending queue is at least half full.
+   *
+   * Producers that can pause (e.g. batch reprocessing) poll this before
+   * enqueueing more work, because enqueueData() drops items once the queue
+   * is full.
+   *
+   * @return true if the worker is falling behind the producer
+   */
+  [[nodiscard]] bool backlogged() const
+  {
+    return m_queueSize.load(std::memory_order_relaxed) >= m_config.queueCapacity / 2;
+  }
+
+  /**
+   * @brief Writes all pending items and closes the worker's resources.
+   *
+   * Unlike a queued close, this blocks until the worker thread is done, so
+   * the caller knows that every item enqueued so far has been processed.
+   * Must not be called from the worker thread.
+   */
+  void closeAndWait()
+  {
+    if (m_worker)
+      QMetaObject::invokeMethod(
+        m_worker, &FrameConsumerWorkerBase::close, Qt::BlockingQueuedConnection);
+  }
+
 protected:
   /**
    * @brief Factory method to create the worker object.
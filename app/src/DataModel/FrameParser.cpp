@@ -21,6 +21,7 @@
 
 #include "DataModel/FrameParser.h"
 
+#include <algorithm>
 #include <QFile>
 
 #include "DataModel/IScriptEngine.h"
@@ -313,9 +314,9 @@ void DataModel::FrameParser::clearSourceEngine(int sourceId)
  *
  * @param frame    Decoded UTF-8 string frame.
  * @param sourceId Source identifier whose engine should be used.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::FrameParser::parseMultiFrame(const QString& frame, int sourceId)
+QList<DataModel::ChannelList> DataModel::FrameParser::parseMultiFrame(const QString& frame, int sourceId)
 {
   Q_ASSERT(sourceId >= 0);
   Q_ASSERT(!frame.isEmpty());
@@ -343,9 +344,9 @@ QList<QStringList> DataModel::FrameParser::parseMultiFrame(const QString& frame,
  *
  * @param frame    Binary frame data.
  * @param sourceId Source identifier whose engine should be used.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::FrameParser::parseMultiFrame(const QByteArray& frame, int sourceId)
+QList<DataModel::ChannelList> DataModel::FrameParser::parseMultiFrame(const QByteArray& frame, int sourceId)
 {
   Q_ASSERT(sourceId >= 0);
   Q_ASSERT(!frame.isEmpty());
@@ -365,6 +366,95 @@ QList<QStringList> DataModel::FrameParser::parseMultiFrame(const QByteArray& fra
   return it->second->parseBinary(frame);
 }
 
+/**
+ * @brief Returns the native binary decoder for @p sourceId, if any.
+ *
+ * Unlike script engines there is no fallback to source 0: a layout always
+ * describes the frames of the source that declares it.
+ *
+ * @param sourceId Source identifier.
+ * @return Decoder pointer, or @c nullptr if the source has no binary layout.
+ */
+const DataModel::BinaryDecoder* DataModel::FrameParser::binaryDecoder(int sourceId) const
+{
+  const auto it = m_binaryDecoders.find(sourceId);
+  if (it == m_binaryDecoders.end())
+    return nullptr;
+
+  return &it->second;
+}
+
+/**
+ * @brief Returns the native CAN decoder of a source, if it declares a CAN layout.
+ *
+ * @param sourceId Source identifier.
+ * @return Decoder pointer, or @c nullptr if the source has no CAN layout.
+ */
+const DataModel::CanDecoder* DataModel::FrameParser::canDecoder(int sourceId) const
+{
+  const auto it = m_canDecoders.find(sourceId);
+  if (it == m_canDecoders.end())
+    return nullptr;
+
+  return &it->second;
+}
+
+/**
+ * @brief Rebuilds the native binary and CAN decoders from the project's sources.
+ */
+void DataModel::FrameParser::loadBinaryDecoders()
+{
+  m_canDecoders.clear();
+  m_binaryDecoders.clear();
+
+  for (const auto& src : ProjectModel::instance().sources()) {
+    if (!src.canMessages.empty() && !loadCanDecoder(src.sourceId, src.frameParserCode))
+      qWarning() << "[FrameParser] Ignoring CAN layout of source" << src.sourceId
+                 << "because its frame parser was edited";
+
+    if (src.binaryLayout.empty())
+      continue;
+
+    BinaryDecoder decoder(src.binaryLayout);
+    if (!decoder.isEmpty())
+      m_binaryDecoders.emplace(src.sourceId, std::move(decoder));
+  }
+}
+
+/**
+ * @brief Rebuilds the native CAN decoder of @p sourceId for parser @p code.
+ *
+ * The DBC importer stores the digest of its generated Lua parser next to the
+ * CAN layout. The layout is only used while @p code still has that digest,
+ * so edits to the parser are never silently ignored.
+ *
+ * @param sourceId Source identifier.
+ * @param code     Frame parser code the source is decoded with.
+ * @return @c true if a native decoder was built for the source.
+ */
+bool DataModel::FrameParser::loadCanDecoder(int sourceId, const QString& code)
+{
+  m_canDecoders.erase(sourceId);
+
+  const auto& sources = ProjectModel::instance().sources();
+  const auto it = std::find_if(sources.begin(), sources.end(), [sourceId](const Source& src) {
+    return src.sourceId == sourceId;
+  });
+
+  if (it == sources.end() || it->canMessages.empty())
+    return false;
+
+  if (it->canParserDigest != CanDecoder::parserDigest(code))
+    return false;
+
+  CanDecoder decoder(it->canMessages);
+  if (decoder.isEmpty())
+    return false;
+
+  m_canDecoders.emplace(sourceId, std::move(decoder));
+  return true;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Script loading
 //--------------------------------------------------------------------------------------------------
@@ -374,6 +464,8 @@ QList<QStringList> DataModel::FrameParser::parseMultiFrame(const QByteArray& fra
  * @p sourceId.
  *
  * Delegates all language-specific validation to the concrete IScriptEngine.
+ * The source's native CAN decoder is kept only if @p script is still the
+ * parser its CAN layout was generated with.
  *
  * @param sourceId         Target source engine (0 = global).
  * @param script           The script source to validate and load.
@@ -399,7 +491,16 @@ bool DataModel::FrameParser::loadScript(int sourceId, const QString& script, boo
   }
 
   auto& engine = engineForSource(sourceId);
-  return engine.loadScript(script, sourceId, showMessageBoxes);
+  if (!engine.loadScript(script, sourceId, showMessageBoxes))
+    return false;
+
+  // An edited DBC parser takes over from the native CAN decoder
+  const bool wasNative = m_canDecoders.contains(sourceId);
+  if (!loadCanDecoder(sourceId, script) && wasNative)
+    qWarning() << "[FrameParser] Frame parser of source" << sourceId
+               << "no longer matches its CAN layout, decoding with the script";
+
+  return true;
 }
 
 /**
@@ -419,7 +520,7 @@ void DataModel::FrameParser::setSuppressMessageBoxes(const bool suppress)
  *
  * Destroys all engines except source 0 (which is reset in-place), then
  * reloads source 0 from the project and lazily loads each per-source engine
- * from its stored parser code.
+ * from its stored parser code. Native binary decoders are rebuilt as well.
  */
 void DataModel::FrameParser::readCode()
 {
@@ -430,6 +531,9 @@ void DataModel::FrameParser::readCode()
     else
       ++it;
 
+  // CAN decoders are rebuilt for the project's current parsers
+  m_canDecoders.clear();
+
   // Recreate source 0 engine if language changed
   const int lang0  = languageForSource(0);
   auto it0         = m_engines.find(0);
@@ -453,6 +557,7 @@ void DataModel::FrameParser::readCode()
     if (src.sourceId > 0 && !src.frameParserCode.isEmpty())
       (void)loadScript(src.sourceId, src.frameParserCode, false);
 
+  loadBinaryDecoders();
   Q_EMIT modifiedChanged();
 }
 
@@ -468,6 +573,9 @@ void DataModel::FrameParser::clearContext()
     else
       ++it;
 
+  // CAN decoders are rebuilt for the project's current parsers
+  m_canDecoders.clear();
+
   // Recreate source 0 engine if language changed
   const int lang0  = languageForSource(0);
   auto it0         = m_engines.find(0);
@@ -486,6 +594,8 @@ void DataModel::FrameParser::clearContext()
   for (const auto& src : sources)
     if (src.sourceId > 0 && !src.frameParserCode.isEmpty())
       (void)loadScript(src.sourceId, src.frameParserCode, false);
+
+  loadBinaryDecoders();
 }
 
 /**
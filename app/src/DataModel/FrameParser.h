@@ -26,6 +26,8 @@
 #include <QObject>
 #include <QStringList>
 
+#include "DataModel/BinaryDecoder.h"
+#include "DataModel/CanDecoder.h"
 #include "DataModel/IScriptEngine.h"
 
 namespace DataModel {
@@ -38,7 +40,9 @@ namespace DataModel {
  * that multi-source projects can run independent parser code per device.
  *
  * Supports multiple scripting languages via the IScriptEngine interface
- * (JavaScript via QJSEngine, Lua via embedded Lua 5.4).
+ * (JavaScript via QJSEngine, Lua via embedded Lua 5.4). Sources that declare
+ * a fixed binary layout also get a native BinaryDecoder, which FrameBuilder
+ * uses instead of the script for binary frames.
  */
 class FrameParser : public QObject {
   Q_OBJECT
@@ -63,8 +67,10 @@ public:
   [[nodiscard]] const QStringList& templateNames() const;
   [[nodiscard]] const QStringList& templateFiles() const;
 
-  [[nodiscard]] QList<QStringList> parseMultiFrame(const QString& frame, int sourceId);
-  [[nodiscard]] QList<QStringList> parseMultiFrame(const QByteArray& frame, int sourceId);
+  [[nodiscard]] QList<ChannelList> parseMultiFrame(const QString& frame, int sourceId);
+  [[nodiscard]] QList<ChannelList> parseMultiFrame(const QByteArray& frame, int sourceId);
+  [[nodiscard]] const BinaryDecoder* binaryDecoder(int sourceId) const;
+  [[nodiscard]] const CanDecoder* canDecoder(int sourceId) const;
 
   [[nodiscard]] bool loadScript(int sourceId, const QString& script, bool showMessageBoxes = true);
 
@@ -87,6 +93,9 @@ private:
   [[nodiscard]] IScriptEngine& engineForSource(int sourceId);
   [[nodiscard]] int languageForSource(int sourceId) const;
 
+  void loadBinaryDecoders();
+  [[nodiscard]] bool loadCanDecoder(int sourceId, const QString& code);
+
 private:
   bool m_suppressMessageBoxes;
 
@@ -95,6 +104,8 @@ private:
   QStringList m_templateNames;
 
   std::map<int, std::unique_ptr<IScriptEngine>> m_engines;
+  std::map<int, BinaryDecoder> m_binaryDecoders;
+  std::map<int, CanDecoder> m_canDecoders;
 };
 
 }  // namespace DataModel
@@ -182,15 +182,17 @@ void DataModel::FrameParserTestDialog::parseData()
     return;
   }
 
+  QList<ChannelList> frames;
+  if (m_hexCheckBox->isChecked())
+    frames = m_parser->parseMultiFrame(SerialStudio::hexToBytes(input), m_sourceId);
+  else
+    frames = m_parser->parseMultiFrame(input, m_sourceId);
+
   QStringList result;
-  if (m_hexCheckBox->isChecked()) {
-    const auto frames = m_parser->parseMultiFrame(SerialStudio::hexToBytes(input), m_sourceId);
-    if (!frames.isEmpty())
-      result = frames.first();
-  } else {
-    const auto frames = m_parser->parseMultiFrame(input, m_sourceId);
-    if (!frames.isEmpty())
-      result = frames.first();
+  if (!frames.isEmpty()) {
+    result.reserve(frames.first().size());
+    for (const auto& value : std::as_const(frames.first()))
+      result.append(channelToString(value));
   }
 
   displayOutput(input, result);
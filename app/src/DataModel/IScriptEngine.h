@@ -25,9 +25,63 @@
 #include <QList>
 #include <QString>
 #include <QStringList>
+#include <variant>
 
 namespace DataModel {
 
+/**
+ * @brief A single channel value produced by a frame parser script.
+ *
+ * Numbers keep their native type so that FrameBuilder can assign
+ * Dataset::numericValue directly instead of formatting the number as text
+ * and parsing it back. Strings are only used for values the script returned
+ * as strings.
+ */
+using ChannelValue = std::variant<double, qint64, QString>;
+
+/**
+ * @brief One parsed frame: the channel values in dataset index order.
+ */
+using ChannelList = QList<ChannelValue>;
+
+/**
+ * @brief Returns the text form of a channel value.
+ *
+ * Doubles use the same 15 significant digit formatting that the engines
+ * produced before values were typed, so displayed/exported text is unchanged.
+ */
+[[nodiscard]] inline QString channelToString(const ChannelValue& value)
+{
+  if (const auto* d = std::get_if<double>(&value))
+    return QString::number(*d, 'g', 15);
+
+  if (const auto* i = std::get_if<qint64>(&value))
+    return QString::number(*i);
+
+  return std::get<QString>(value);
+}
+
+/**
+ * @brief Returns the numeric form of a channel value.
+ *
+ * @param value Channel value to convert.
+ * @param ok    Set to @c true if the value is (or parses as) a number.
+ */
+[[nodiscard]] inline double channelToDouble(const ChannelValue& value, bool* ok)
+{
+  if (const auto* d = std::get_if<double>(&value)) {
+    *ok = true;
+    return *d;
+  }
+
+  if (const auto* i = std::get_if<qint64>(&value)) {
+    *ok = true;
+    return static_cast<double>(*i);
+  }
+
+  return std::get<QString>(value).toDouble(ok);
+}
+
 /**
  * @brief Abstract interface for script engines used by the FrameParser.
  *
@@ -43,8 +97,8 @@ public:
                                         int sourceId,
                                         bool showMessageBoxes) = 0;
 
-  [[nodiscard]] virtual QList<QStringList> parseString(const QString& frame)    = 0;
-  [[nodiscard]] virtual QList<QStringList> parseBinary(const QByteArray& frame) = 0;
+  [[nodiscard]] virtual QList<ChannelList> parseString(const QString& frame)    = 0;
+  [[nodiscard]] virtual QList<ChannelList> parseBinary(const QByteArray& frame) = 0;
 
   [[nodiscard]] virtual bool isLoaded() const noexcept = 0;
 
@@ -44,21 +44,38 @@ enum class ArrayType {
 };
 
 /**
- * @brief Converts a JavaScript array to a QStringList.
+ * @brief Converts a JavaScript value to a typed channel value.
+ *
+ * Numbers are kept as doubles; every other type is converted to its string
+ * representation, exactly as before values were typed.
+ *
+ * @param jsValue JavaScript value to convert.
+ * @return The typed channel value.
+ */
+static DataModel::ChannelValue jsValueToChannel(const QJSValue& jsValue)
+{
+  if (jsValue.isNumber())
+    return jsValue.toNumber();
+
+  return jsValue.toString();
+}
+
+/**
+ * @brief Converts a JavaScript array to a ChannelList.
  *
  * @param jsValue JavaScript array to convert.
- * @return QStringList containing string representation of each element.
+ * @return ChannelList containing the typed value of each element.
  */
-static QStringList jsArrayToStringList(const QJSValue& jsValue)
+static DataModel::ChannelList jsArrayToChannelList(const QJSValue& jsValue)
 {
   static const QString kLength = QStringLiteral("length");
 
-  QStringList result;
+  DataModel::ChannelList result;
   const int length = jsValue.property(kLength).toInt();
   result.reserve(length);
 
   for (int i = 0; i < length; ++i)
-    result.append(jsValue.property(static_cast<quint32>(i)).toString());
+    result.append(jsValueToChannel(jsValue.property(static_cast<quint32>(i))));
 
   return result;
 }
@@ -113,13 +130,13 @@ static ArrayType detectArrayType(const QJSValue& jsValue)
  * Invalid rows (non-arrays) are skipped with a warning.
  *
  * @param jsValue JavaScript 2D array.
- * @return List of QStringList, one per row/frame.
+ * @return List of ChannelList, one per row/frame.
  */
-static QList<QStringList> convert2DArray(const QJSValue& jsValue)
+static QList<DataModel::ChannelList> convert2DArray(const QJSValue& jsValue)
 {
   static const QString kLength = QStringLiteral("length");
 
-  QList<QStringList> results;
+  QList<DataModel::ChannelList> results;
   const int rowCount = jsValue.property(kLength).toInt();
   results.reserve(rowCount);
 
@@ -131,7 +148,7 @@ static QList<QStringList> convert2DArray(const QJSValue& jsValue)
       continue;
     }
 
-    results.append(jsArrayToStringList(rowArray));
+    results.append(jsArrayToChannelList(rowArray));
   }
 
   return results;
@@ -151,9 +168,9 @@ static QList<QStringList> convert2DArray(const QJSValue& jsValue)
  * by repeating their last value.
  *
  * @param jsValue JavaScript mixed array.
- * @return List of QStringList, one per frame.
+ * @return List of ChannelList, one per frame.
  */
-static QList<QStringList> convertMixedArray(const QJSValue& jsValue)
+static QList<DataModel::ChannelList> convertMixedArray(const QJSValue& jsValue)
 {
   static const QString kLength = QStringLiteral("length");
   const int elementCount       = jsValue.property(kLength).toInt();
@@ -161,26 +178,26 @@ static QList<QStringList> convertMixedArray(const QJSValue& jsValue)
   constexpr int kMaxElements     = 10000;
   constexpr qsizetype kMaxVecLen = 10000;
 
-  QStringList scalars;
-  QList<QStringList> vectors;
+  DataModel::ChannelList scalars;
+  QList<DataModel::ChannelList> vectors;
   qsizetype maxVectorLength = 0;
 
   for (int i = 0; i < qMin(elementCount, kMaxElements); ++i) {
     const auto element = jsValue.property(static_cast<quint32>(i));
 
     if (element.isArray()) {
-      const auto vec = jsArrayToStringList(element);
+      const auto vec = jsArrayToChannelList(element);
       if (!vec.isEmpty()) {
         vectors.append(vec);
         maxVectorLength = std::max(maxVectorLength, vec.size());
       }
     } else {
-      scalars.append(element.toString());
+      scalars.append(jsValueToChannel(element));
     }
   }
 
   if (vectors.isEmpty()) [[unlikely]] {
-    QList<QStringList> results;
+    QList<DataModel::ChannelList> results;
     results.append(scalars);
     return results;
   }
@@ -190,17 +207,17 @@ static QList<QStringList> convertMixedArray(const QJSValue& jsValue)
 
   for (auto& vec : vectors) {
     if (!vec.isEmpty() && vec.size() < maxVectorLength) {
-      const QString lastValue = vec.last();
+      const DataModel::ChannelValue lastValue = vec.last();
       while (vec.size() < maxVectorLength)
         vec.append(lastValue);
     }
   }
 
-  QList<QStringList> results;
+  QList<DataModel::ChannelList> results;
   results.reserve(maxVectorLength);
 
   for (int i = 0; i < maxVectorLength; ++i) {
-    QStringList frame;
+    DataModel::ChannelList frame;
     frame.reserve(scalars.size() + vectors.size());
 
     frame.append(scalars);
@@ -219,11 +236,11 @@ static QList<QStringList> convertMixedArray(const QJSValue& jsValue)
  * @brief Classifies the JS result and converts it to a list of frames.
  *
  * @param jsResult The value returned by the parse function.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-static QList<QStringList> convertJsResult(const QJSValue& jsResult)
+static QList<DataModel::ChannelList> convertJsResult(const QJSValue& jsResult)
 {
-  QList<QStringList> results;
+  QList<DataModel::ChannelList> results;
   switch (detectArrayType(jsResult)) {
     case ArrayType::Array2D:
       return convert2DArray(jsResult);
@@ -232,7 +249,7 @@ static QList<QStringList> convertJsResult(const QJSValue& jsResult)
     case ArrayType::Array1D:
     case ArrayType::Scalar:
     default:
-      results.append(jsArrayToStringList(jsResult));
+      results.append(jsArrayToChannelList(jsResult));
       return results;
   }
 }
@@ -275,7 +292,7 @@ void DataModel::JsScriptEngine::collectGarbage()
 void DataModel::JsScriptEngine::reset()
 {
   m_parseFunction = QJSValue();
-  m_hexToArray    = QJSValue();
+  m_uint8Array    = QJSValue();
 }
 
 /**
@@ -311,9 +328,9 @@ QJSValue DataModel::JsScriptEngine::guardedCall(QJSValueList& args)
  * frames.
  *
  * @param frame Decoded UTF-8 string frame.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::JsScriptEngine::parseString(const QString& frame)
+QList<DataModel::ChannelList> DataModel::JsScriptEngine::parseString(const QString& frame)
 {
   Q_ASSERT(!frame.isEmpty());
 
@@ -337,39 +354,29 @@ QList<QStringList> DataModel::JsScriptEngine::parseString(const QString& frame)
  * more frames.
  *
  * @param frame Binary frame data.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::JsScriptEngine::parseBinary(const QByteArray& frame)
+QList<DataModel::ChannelList> DataModel::JsScriptEngine::parseBinary(const QByteArray& frame)
 {
   Q_ASSERT(!frame.isEmpty());
 
   if (!m_parseFunction.isCallable())
     return {};
 
-  // Convert binary data to JS array via hex helper or manual loop
-  QJSValue jsArray;
-  if (m_hexToArray.isCallable()) [[likely]] {
-    QJSValueList hexArgs;
-    hexArgs << QString::fromLatin1(frame.toHex());
-    jsArray = m_hexToArray.call(hexArgs);
-
-    // Fall back to manual loop if the hex helper failed
-    if (jsArray.isError()) [[unlikely]] {
-      qWarning() << "[JsScriptEngine] hex helper error:"
-                 << jsArray.property("message").toString();
-      jsArray = QJSValue();
-    }
-  }
+  // Wrap the frame in an ArrayBuffer (shares the QByteArray storage) + view
+  if (!m_uint8Array.isCallable()) [[unlikely]]
+    m_uint8Array = m_engine.globalObject().property(QStringLiteral("Uint8Array"));
 
-  if (!jsArray.isArray()) {
-    jsArray          = m_engine.newArray(frame.size());
-    const auto* data = reinterpret_cast<const quint8*>(frame.constData());
-    for (int i = 0; i < frame.size(); ++i)
-      jsArray.setProperty(i, data[i]);
+  QJSValueList ctorArgs;
+  ctorArgs << m_engine.toScriptValue(frame);
+  const auto bytes = m_uint8Array.callAsConstructor(ctorArgs);
+  if (bytes.isError()) [[unlikely]] {
+    qWarning() << "[JsScriptEngine] Uint8Array error:" << bytes.property("message").toString();
+    return {};
   }
 
   QJSValueList args;
-  args << jsArray;
+  args << bytes;
   const auto jsResult = guardedCall(args);
 
   if (jsResult.isError()) [[unlikely]] {
@@ -566,11 +573,11 @@ bool DataModel::JsScriptEngine::loadScript(const QString& script,
 
   // Save existing parse function in case validation fails
   QJSValue prevParseFn  = m_parseFunction;
-  QJSValue prevHexToArr = m_hexToArray;
+  QJSValue prevUint8Arr = m_uint8Array;
 
   auto restorePrevious = [&]() {
     m_parseFunction = prevParseFn;
-    m_hexToArray    = prevHexToArr;
+    m_uint8Array    = prevUint8Arr;
   };
 
   // Syntax check
@@ -653,12 +660,8 @@ bool DataModel::JsScriptEngine::loadScript(const QString& script,
 
   m_parseFunction = parseFunction;
 
-  // Hex-to-byte-array helper for binary frame parsing
-  m_engine.evaluate(QStringLiteral("function __ss_internal_hex_to_array__(h){"
-                                   "var n=h.length>>1,a=new Array(n);"
-                                   "for(var i=0,j=0;i<h.length;i+=2,j++)"
-                                   "a[j]=parseInt(h.substr(i,2),16);return a;}"));
-  m_hexToArray = m_engine.globalObject().property(QStringLiteral("__ss_internal_hex_to_array__"));
+  // Typed array constructor used to hand binary frames to the parser
+  m_uint8Array = m_engine.globalObject().property(QStringLiteral("Uint8Array"));
 
   return true;
 }
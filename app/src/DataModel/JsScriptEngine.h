@@ -45,8 +45,8 @@ public:
                                 int sourceId,
                                 bool showMessageBoxes) override;
 
-  [[nodiscard]] QList<QStringList> parseString(const QString& frame) override;
-  [[nodiscard]] QList<QStringList> parseBinary(const QByteArray& frame) override;
+  [[nodiscard]] QList<ChannelList> parseString(const QString& frame) override;
+  [[nodiscard]] QList<ChannelList> parseBinary(const QByteArray& frame) override;
 
   [[nodiscard]] bool isLoaded() const noexcept override;
 
@@ -69,7 +69,7 @@ private:
 private:
   QJSEngine m_engine;
   QJSValue m_parseFunction;
-  QJSValue m_hexToArray;
+  QJSValue m_uint8Array;
   QTimer m_watchdog;
 };
 
@@ -348,9 +348,9 @@ bool DataModel::LuaScriptEngine::loadScript(const QString& script,
  * @brief Executes the Lua parse function over text data.
  *
  * @param frame Decoded UTF-8 string frame.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::LuaScriptEngine::parseString(const QString& frame)
+QList<DataModel::ChannelList> DataModel::LuaScriptEngine::parseString(const QString& frame)
 {
   Q_ASSERT(!frame.isEmpty());
   Q_ASSERT(m_state != nullptr);
@@ -384,9 +384,9 @@ QList<QStringList> DataModel::LuaScriptEngine::parseString(const QString& frame)
  * Passes the frame as a Lua table of byte integers (1-indexed).
  *
  * @param frame Binary frame data.
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::LuaScriptEngine::parseBinary(const QByteArray& frame)
+QList<DataModel::ChannelList> DataModel::LuaScriptEngine::parseBinary(const QByteArray& frame)
 {
   Q_ASSERT(!frame.isEmpty());
   Q_ASSERT(m_state != nullptr);
@@ -424,29 +424,42 @@ QList<QStringList> DataModel::LuaScriptEngine::parseBinary(const QByteArray& fra
 //--------------------------------------------------------------------------------------------------
 
 /**
- * @brief Converts a Lua table at the top of the stack to a QStringList.
+ * @brief Converts the Lua value at @p index to a typed channel value.
+ *
+ * Integers and floats keep their numeric type; anything else is converted
+ * with lua_tostring().
+ *
+ * @param index Stack index of the value.
+ * @return The typed channel value.
+ */
+DataModel::ChannelValue DataModel::LuaScriptEngine::toChannelValue(int index)
+{
+  if (lua_isinteger(m_state, index))
+    return static_cast<qint64>(lua_tointeger(m_state, index));
+
+  if (lua_type(m_state, index) == LUA_TNUMBER)
+    return static_cast<double>(lua_tonumber(m_state, index));
+
+  return QString::fromUtf8(lua_tostring(m_state, index));
+}
+
+/**
+ * @brief Converts a Lua table at the top of the stack to a ChannelList.
  *
  * @param tableIndex Stack index of the table.
- * @return QStringList with string representation of each element.
+ * @return ChannelList with the typed value of each element.
  */
-QStringList DataModel::LuaScriptEngine::tableToStringList(int tableIndex)
+DataModel::ChannelList DataModel::LuaScriptEngine::tableToChannelList(int tableIndex)
 {
   Q_ASSERT(lua_istable(m_state, tableIndex));
 
-  QStringList result;
+  ChannelList result;
   const int len = static_cast<int>(lua_rawlen(m_state, tableIndex));
   result.reserve(qMin(len, kMaxElements));
 
   for (int i = 1; i <= qMin(len, kMaxElements); ++i) {
     lua_rawgeti(m_state, tableIndex, i);
-
-    if (lua_isinteger(m_state, -1))
-      result.append(QString::number(lua_tointeger(m_state, -1)));
-    else if (lua_isnumber(m_state, -1))
-      result.append(QString::number(lua_tonumber(m_state, -1), 'g', 15));
-    else
-      result.append(QString::fromUtf8(lua_tostring(m_state, -1)));
-
+    result.append(toChannelValue(-1));
     lua_pop(m_state, 1);
   }
 
@@ -461,21 +474,17 @@ QStringList DataModel::LuaScriptEngine::tableToStringList(int tableIndex)
  *
  * Pops the return value from the stack before returning.
  *
- * @return List of QStringList, each representing one frame.
+ * @return List of ChannelList, each representing one frame.
  */
-QList<QStringList> DataModel::LuaScriptEngine::convertResult()
+QList<DataModel::ChannelList> DataModel::LuaScriptEngine::convertResult()
 {
-  QList<QStringList> results;
+  QList<ChannelList> results;
 
   // Scalar return (number or string)
   if (!lua_istable(m_state, -1)) {
-    QStringList frame;
-    if (lua_isinteger(m_state, -1))
-      frame.append(QString::number(lua_tointeger(m_state, -1)));
-    else if (lua_isnumber(m_state, -1))
-      frame.append(QString::number(lua_tonumber(m_state, -1), 'g', 15));
-    else if (lua_isstring(m_state, -1))
-      frame.append(QString::fromUtf8(lua_tostring(m_state, -1)));
+    ChannelList frame;
+    if (lua_isstring(m_state, -1))
+      frame.append(toChannelValue(-1));
 
     lua_pop(m_state, 1);
     if (!frame.isEmpty())
@@ -509,7 +518,7 @@ QList<QStringList> DataModel::LuaScriptEngine::convertResult()
 
   // Pure 1D array — all scalars
   if (!hasTable) {
-    results.append(tableToStringList(-1));
+    results.append(tableToChannelList(-1));
     lua_pop(m_state, 1);
     return results;
   }
@@ -520,7 +529,7 @@ QList<QStringList> DataModel::LuaScriptEngine::convertResult()
     for (int i = 1; i <= qMin(len, kMaxElements); ++i) {
       lua_rawgeti(m_state, -1, i);
       if (lua_istable(m_state, -1))
-        results.append(tableToStringList(-1));
+        results.append(tableToChannelList(-1));
       else [[unlikely]]
         qWarning() << "[LuaScriptEngine] Row" << i << "is not a table, skipping";
 
@@ -532,25 +541,21 @@ QList<QStringList> DataModel::LuaScriptEngine::convertResult()
   }
 
   // Mixed array — scalars + sub-tables (same unzip logic as JS engine)
-  QStringList scalars;
-  QList<QStringList> vectors;
+  ChannelList scalars;
+  QList<ChannelList> vectors;
   qsizetype maxVectorLength = 0;
 
   for (int i = 1; i <= qMin(len, kMaxElements); ++i) {
     lua_rawgeti(m_state, -1, i);
 
     if (lua_istable(m_state, -1)) {
-      const auto vec = tableToStringList(-1);
+      const auto vec = tableToChannelList(-1);
       if (!vec.isEmpty()) {
         vectors.append(vec);
         maxVectorLength = std::max(maxVectorLength, vec.size());
       }
-    } else if (lua_isinteger(m_state, -1)) {
-      scalars.append(QString::number(lua_tointeger(m_state, -1)));
-    } else if (lua_isnumber(m_state, -1)) {
-      scalars.append(QString::number(lua_tonumber(m_state, -1), 'g', 15));
     } else {
-      scalars.append(QString::fromUtf8(lua_tostring(m_state, -1)));
+      scalars.append(toChannelValue(-1));
     }
 
     lua_pop(m_state, 1);
@@ -570,7 +575,7 @@ QList<QStringList> DataModel::LuaScriptEngine::convertResult()
   // Extend shorter vectors by repeating their last value
   for (auto& vec : vectors) {
     if (!vec.isEmpty() && vec.size() < maxVectorLength) {
-      const QString lastValue = vec.last();
+      const ChannelValue lastValue = vec.last();
       while (vec.size() < maxVectorLength)
         vec.append(lastValue);
     }
@@ -579,7 +584,7 @@ QList<QStringList> DataModel::LuaScriptEngine::convertResult()
   // Build output frames: scalars repeated, vectors unzipped
   results.reserve(maxVectorLength);
   for (int i = 0; i < maxVectorLength; ++i) {
-    QStringList frame;
+    ChannelList frame;
     frame.reserve(scalars.size() + vectors.size());
     frame.append(scalars);
 
@@ -45,8 +45,8 @@ public:
                                 int sourceId,
                                 bool showMessageBoxes) override;
 
-  [[nodiscard]] QList<QStringList> parseString(const QString& frame) override;
-  [[nodiscard]] QList<QStringList> parseBinary(const QByteArray& frame) override;
+  [[nodiscard]] QList<ChannelList> parseString(const QString& frame) override;
+  [[nodiscard]] QList<ChannelList> parseBinary(const QByteArray& frame) override;
 
   [[nodiscard]] bool isLoaded() const noexcept override;
 
@@ -57,8 +57,9 @@ private:
   void createState();
   void destroyState();
 
-  [[nodiscard]] QList<QStringList> convertResult();
-  [[nodiscard]] QStringList tableToStringList(int tableIndex);
+  [[nodiscard]] QList<ChannelList> convertResult();
+  [[nodiscard]] ChannelValue toChannelValue(int index);
+  [[nodiscard]] ChannelList tableToChannelList(int tableIndex);
 
   static void watchdogHook(lua_State* L, lua_Debug* ar);
 
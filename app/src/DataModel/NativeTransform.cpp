@@ -0,0 +1,1056 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "DataModel/NativeTransform.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <QByteArray>
+#include <string>
+#include <string_view>
+
+#include "SerialStudio.h"
+
+//--------------------------------------------------------------------------------------------------
+// Compiler
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Tokenizer and recursive-descent parser for the native subset.
+ *
+ * The parser emits postfix instructions as it goes. Constant operands are
+ * folded on emission, and locals initialized with a constant expression are
+ * remembered as constants instead of being stored in a slot.
+ */
+class DataModel::NativeTransform::Compiler {
+public:
+  Compiler(std::string_view source, bool lua, std::vector<Instruction>& program)
+    : m_lua(lua)
+    , m_source(source)
+    , m_position(0)
+    , m_depth(0)
+    , m_nextSlot(1)
+    , m_powerOperand(false)
+    , m_program(program)
+  {}
+
+  [[nodiscard]] bool compile();
+
+private:
+  enum class TokenKind {
+    End,
+    Name,
+    Number,
+    Symbol
+  };
+
+  struct Token {
+    TokenKind kind;
+    std::string_view text;
+    double number;
+  };
+
+  struct Binding {
+    std::string_view name;
+    int slot;
+    bool constant;
+    double value;
+  };
+
+  struct LibraryFunction {
+    std::string_view name;
+    Function function;
+    int minArgs;
+    int maxArgs;
+  };
+
+  struct LibraryConstant {
+    std::string_view name;
+    double value;
+  };
+
+  [[nodiscard]] bool tokenize();
+  [[nodiscard]] bool skipComment(std::size_t& i) const;
+  [[nodiscard]] bool scanNumber(std::size_t& i);
+
+  [[nodiscard]] const Token& peek() const { return m_tokens[m_position]; }
+  [[nodiscard]] bool accept(std::string_view text);
+  [[nodiscard]] bool isReserved(std::string_view name) const;
+
+  [[nodiscard]] bool parseDeclaration();
+  [[nodiscard]] bool parseExpression();
+  [[nodiscard]] bool parseTerm();
+  [[nodiscard]] bool parseUnary();
+  [[nodiscard]] bool parsePower();
+  [[nodiscard]] bool parsePrimary();
+  [[nodiscard]] bool parseLibraryMember();
+
+  [[nodiscard]] bool emit(Opcode op, int arg = 0, double constant = 0);
+  [[nodiscard]] bool emitCall(Function function, int count);
+
+private:
+  bool m_lua;
+  std::string_view m_source;
+  std::vector<Token> m_tokens;
+  std::size_t m_position;
+
+  int m_depth;
+  int m_nextSlot;
+  bool m_powerOperand;
+  std::vector<Binding> m_bindings;
+  std::vector<Instruction>& m_program;
+};
+
+//--------------------------------------------------------------------------------------------------
+// Tokenizer
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Splits the source into names, numbers and symbols.
+ *
+ * Comments and whitespace are dropped. Strings and characters outside of the
+ * subset make tokenizing fail, which sends the transform to the script engine.
+ */
+bool DataModel::NativeTransform::Compiler::tokenize()
+{
+  std::size_t i = 0;
+  while (i < m_source.size()) {
+    const char c = m_source[i];
+
+    // Skip whitespace
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v') {
+      ++i;
+      continue;
+    }
+
+    // Skip comments
+    if (skipComment(i))
+      continue;
+
+    // Names and keywords
+    if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+      const auto start = i;
+      while (i < m_source.size()
+             && (std::isalnum(static_cast<unsigned char>(m_source[i])) || m_source[i] == '_'))
+        ++i;
+
+      m_tokens.push_back({TokenKind::Name, m_source.substr(start, i - start), 0});
+      continue;
+    }
+
+    // Numeric literals
+    const bool fraction = c == '.' && i + 1 < m_source.size()
+                       && std::isdigit(static_cast<unsigned char>(m_source[i + 1]));
+    if (std::isdigit(static_cast<unsigned char>(c)) || fraction) {
+      if (!scanNumber(i))
+        return false;
+
+      continue;
+    }
+
+    // Two-character operators of the subset, and JS ++/-- so they are rejected
+    const auto pair = m_source.substr(i, 2);
+    if ((m_lua && pair == "//") || (!m_lua && (pair == "**" || pair == "++" || pair == "--"))) {
+      m_tokens.push_back({TokenKind::Symbol, pair, 0});
+      i += 2;
+      continue;
+    }
+
+    // Any other printable ASCII character is a single-character symbol
+    if (c < '!' || c > '~' || c == '"' || c == '\'' || c == '`')
+      return false;
+
+    m_tokens.push_back({TokenKind::Symbol, m_source.substr(i, 1), 0});
+    ++i;
+  }
+
+  m_tokens.push_back({TokenKind::End, {}, 0});
+  return true;
+}
+
+/**
+ * @brief Skips the comment that starts at @p i, if any.
+ *
+ * Handles Lua line and long-bracket comments, and JavaScript line and block
+ * comments. An unterminated block comment runs to the end of the source,
+ * which later fails to parse.
+ *
+ * @return @c true if a comment was skipped.
+ */
+bool DataModel::NativeTransform::Compiler::skipComment(std::size_t& i) const
+{
+  const auto rest = m_source.substr(i);
+
+  // Lua comments: --[==[ ... ]==] or -- to the end of the line
+  if (m_lua && rest.starts_with("--")) {
+    std::size_t level = 0;
+    while (rest.size() > 3 + level && rest[3 + level] == '=')
+      ++level;
+
+    if (rest.size() > 3 + level && rest[2] == '[' && rest[3 + level] == '[') {
+      const std::string close = "]" + std::string(level, '=') + "]";
+      const auto end          = rest.find(close, 4 + level);
+      if (end == std::string_view::npos)
+        i = m_source.size();
+      else
+        i += end + close.size();
+
+      return true;
+    }
+
+    const auto end = rest.find('\n');
+    i              = end == std::string_view::npos ? m_source.size() : i + end + 1;
+    return true;
+  }
+
+  // JavaScript comments: /* ... */ or // to the end of the line
+  if (!m_lua && rest.starts_with("/*")) {
+    const auto end = rest.find("*/", 2);
+    i              = end == std::string_view::npos ? m_source.size() : i + end + 2;
+    return true;
+  }
+
+  if (!m_lua && rest.starts_with("//")) {
+    const auto end = rest.find('\n');
+    i              = end == std::string_view::npos ? m_source.size() : i + end + 1;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Reads the numeric literal that starts at @p i.
+ *
+ * Accepts decimal literals with an optional fraction and exponent, and hex
+ * integers small enough to be exact in both languages. Literals whose meaning
+ * differs between the two (legacy JS octal, wrapping Lua hex) are rejected.
+ */
+bool DataModel::NativeTransform::Compiler::scanNumber(std::size_t& i)
+{
+  const auto start = i;
+  auto digit       = [&](std::size_t p) {
+    return p < m_source.size() && std::isdigit(static_cast<unsigned char>(m_source[p]));
+  };
+
+  // Hex integers, limited to 13 digits so that they fit in a double
+  double value = 0;
+  if (m_source.substr(i, 2) == "0x" || m_source.substr(i, 2) == "0X") {
+    i += 2;
+    while (i < m_source.size() && std::isxdigit(static_cast<unsigned char>(m_source[i]))) {
+      const auto c = std::tolower(static_cast<unsigned char>(m_source[i++]));
+      value        = value * 16 + (std::isdigit(c) ? c - '0' : c - 'a' + 10);
+    }
+
+    if (i - start < 3 || i - start > 15)
+      return false;
+  }
+
+  // Decimal literals
+  else {
+    if (!m_lua && m_source[i] == '0' && digit(i + 1))
+      return false;
+
+    while (digit(i))
+      ++i;
+
+    if (i < m_source.size() && m_source[i] == '.') {
+      ++i;
+      while (digit(i))
+        ++i;
+    }
+
+    if (i < m_source.size() && (m_source[i] == 'e' || m_source[i] == 'E')) {
+      ++i;
+      if (i < m_source.size() && (m_source[i] == '+' || m_source[i] == '-'))
+        ++i;
+
+      if (!digit(i))
+        return false;
+
+      while (digit(i))
+        ++i;
+    }
+
+    bool ok           = false;
+    const auto length = static_cast<qsizetype>(i - start);
+    value             = QByteArray(m_source.data() + start, length).toDouble(&ok);
+    if (!ok)
+      return false;
+  }
+
+  // A literal glued to a name is malformed in both languages
+  if (i < m_source.size()
+      && (std::isalnum(static_cast<unsigned char>(m_source[i])) || m_source[i] == '_'
+          || m_source[i] == '.'))
+    return false;
+
+  m_tokens.push_back({TokenKind::Number, m_source.substr(start, i - start), value});
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Parser
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Parses the whole transform and emits its program.
+ *
+ * Accepts exactly one `function transform(param)` definition whose body is a
+ * list of local declarations followed by a `return` statement.
+ */
+bool DataModel::NativeTransform::Compiler::compile()
+{
+  if (!tokenize())
+    return false;
+
+  // function transform(<param>)
+  if (!accept("function") || !accept("transform") || !accept("("))
+    return false;
+
+  const auto param = peek();
+  if (param.kind != TokenKind::Name || isReserved(param.text))
+    return false;
+
+  ++m_position;
+  if (!accept(")") || (!m_lua && !accept("{")))
+    return false;
+
+  m_bindings.push_back({param.text, 0, false, 0});
+
+  // Local declarations, separated by optional semicolons
+  while (true) {
+    while (accept(";"))
+      ;
+
+    if (accept("return"))
+      break;
+
+    if (!parseDeclaration())
+      return false;
+  }
+
+  // return <expression>, then the end of the function and of the source
+  if (!parseExpression())
+    return false;
+
+  while (accept(";"))
+    ;
+
+  if (!accept(m_lua ? "end" : "}"))
+    return false;
+
+  while (!m_lua && accept(";"))
+    ;
+
+  return peek().kind == TokenKind::End && m_depth == 1;
+}
+
+/**
+ * @brief Consumes the next token if it is the name or symbol @p text.
+ */
+bool DataModel::NativeTransform::Compiler::accept(std::string_view text)
+{
+  const auto& token = peek();
+  if (token.kind == TokenKind::End || token.kind == TokenKind::Number || token.text != text)
+    return false;
+
+  ++m_position;
+  return true;
+}
+
+/**
+ * @brief Checks whether @p name cannot be used as a local or parameter name.
+ *
+ * Covers the keywords of the language and the name of its math library,
+ * which would otherwise be shadowed.
+ */
+bool DataModel::NativeTransform::Compiler::isReserved(std::string_view name) const
+{
+  // clang-format off
+  static constexpr std::string_view kLua[] = {
+    "and", "break", "do", "else", "elseif", "end", "false", "for", "function", "goto", "if",
+    "in", "local", "nil", "not", "or", "repeat", "return", "then", "true", "until", "while",
+    "math",
+  };
+
+  static constexpr std::string_view kJs[] = {
+    "arguments", "await", "break", "case", "catch", "class", "const", "continue", "debugger",
+    "default", "delete", "do", "else", "enum", "eval", "export", "extends", "false", "finally",
+    "for", "function", "if", "implements", "import", "in", "instanceof", "interface", "let",
+    "new", "null", "package", "private", "protected", "public", "return", "static", "super",
+    "switch", "this", "throw", "true", "try", "typeof", "var", "void", "while", "with",
+    "yield", "Math",
+  };
+  // clang-format on
+
+  if (m_lua)
+    return std::find(std::begin(kLua), std::end(kLua), name) != std::end(kLua);
+
+  return std::find(std::begin(kJs), std::end(kJs), name) != std::end(kJs);
+}
+
+/**
+ * @brief Parses `local name = expression` (Lua) or `var|let|const name =
+ *        expression` (JavaScript).
+ *
+ * A Lua local may shadow an earlier one, and its initializer still sees the
+ * earlier binding. JavaScript redeclarations are rejected, since their
+ * hoisting rules differ from a plain assignment.
+ */
+bool DataModel::NativeTransform::Compiler::parseDeclaration()
+{
+  if (m_lua ? !accept("local") : !(accept("var") || accept("let") || accept("const")))
+    return false;
+
+  const auto name = peek();
+  if (name.kind != TokenKind::Name || isReserved(name.text))
+    return false;
+
+  ++m_position;
+  if (!accept("="))
+    return false;
+
+  if (!m_lua) {
+    for (const auto& binding : m_bindings)
+      if (binding.name == name.text)
+        return false;
+  }
+
+  // Parse the initializer before the name comes into scope
+  const auto start = m_program.size();
+  if (!parseExpression())
+    return false;
+
+  // Fold constant initializers into the binding itself
+  const auto& last = m_program.back();
+  if (m_program.size() == start + 1 && last.op == Opcode::Constant) {
+    m_bindings.push_back({name.text, -1, true, last.constant});
+    m_program.pop_back();
+    --m_depth;
+    return true;
+  }
+
+  if (m_nextSlot >= kMaxSlots)
+    return false;
+
+  m_bindings.push_back({name.text, m_nextSlot, false, 0});
+  return emit(Opcode::Store, m_nextSlot++);
+}
+
+/**
+ * @brief Parses an additive expression: term { (+|-) term }.
+ */
+bool DataModel::NativeTransform::Compiler::parseExpression()
+{
+  if (!parseTerm())
+    return false;
+
+  while (true) {
+    if (accept("+")) {
+      if (!parseTerm() || !emit(Opcode::Add))
+        return false;
+    }
+
+    else if (accept("-")) {
+      if (!parseTerm() || !emit(Opcode::Subtract))
+        return false;
+    }
+
+    else
+      return true;
+  }
+}
+
+/**
+ * @brief Parses a multiplicative expression: unary { (*|/|%|//) unary }.
+ */
+bool DataModel::NativeTransform::Compiler::parseTerm()
+{
+  if (!parseUnary())
+    return false;
+
+  while (true) {
+    Opcode op;
+    if (accept("*"))
+      op = Opcode::Multiply;
+    else if (accept("/"))
+      op = Opcode::Divide;
+    else if (accept("%"))
+      op = m_lua ? Opcode::LuaModulo : Opcode::JsModulo;
+    else if (m_lua && accept("//"))
+      op = Opcode::FloorDivide;
+    else
+      return true;
+
+    if (!parseUnary() || !emit(op))
+      return false;
+  }
+}
+
+/**
+ * @brief Parses unary minus (and JavaScript unary plus) in front of a power.
+ *
+ * JavaScript forbids an unparenthesized unary operand on the left of `**`,
+ * so such expressions are rejected instead of guessing a precedence.
+ */
+bool DataModel::NativeTransform::Compiler::parseUnary()
+{
+  const bool minus = accept("-");
+  if (!minus && (m_lua || !accept("+")))
+    return parsePower();
+
+  const bool powerOperand = m_powerOperand;
+  m_powerOperand          = true;
+  const bool ok           = parseUnary();
+  m_powerOperand          = powerOperand;
+  if (!ok)
+    return false;
+
+  return minus ? emit(Opcode::Negate) : true;
+}
+
+/**
+ * @brief Parses a right-associative power: primary [ (^|**) unary ].
+ *
+ * In Lua `-x^2` is `-(x^2)`, which falls out of parsing the exponent base as
+ * a primary expression.
+ */
+bool DataModel::NativeTransform::Compiler::parsePower()
+{
+  if (!parsePrimary())
+    return false;
+
+  if (!accept(m_lua ? "^" : "**"))
+    return true;
+
+  if (!m_lua && m_powerOperand)
+    return false;
+
+  const bool powerOperand = m_powerOperand;
+  m_powerOperand          = false;
+  const bool ok           = parseUnary();
+  m_powerOperand          = powerOperand;
+  if (!ok)
+    return false;
+
+  return emit(m_lua ? Opcode::LuaPower : Opcode::JsPower);
+}
+
+/**
+ * @brief Parses a number, a bound name, a parenthesized expression or a
+ *        member of the math library.
+ */
+bool DataModel::NativeTransform::Compiler::parsePrimary()
+{
+  const auto token = peek();
+
+  // Numeric literal
+  if (token.kind == TokenKind::Number) {
+    ++m_position;
+    return emit(Opcode::Constant, 0, token.number);
+  }
+
+  // Parenthesized expression, which may start a new power operand
+  if (accept("(")) {
+    const bool powerOperand = m_powerOperand;
+    m_powerOperand          = false;
+    const bool ok           = parseExpression() && accept(")");
+    m_powerOperand          = powerOperand;
+    return ok;
+  }
+
+  if (token.kind != TokenKind::Name)
+    return false;
+
+  // math.<member> or Math.<member>
+  ++m_position;
+  if (token.text == (m_lua ? "math" : "Math"))
+    return accept(".") && parseLibraryMember();
+
+  // Innermost binding with that name
+  for (auto it = m_bindings.rbegin(); it != m_bindings.rend(); ++it) {
+    if (it->name != token.text)
+      continue;
+
+    if (it->constant)
+      return emit(Opcode::Constant, 0, it->value);
+
+    return emit(Opcode::Load, it->slot);
+  }
+
+  return false;
+}
+
+/**
+ * @brief Parses the constant or function call that follows `math.`/`Math.`.
+ *
+ * Only pure functions that exist in the embedded Lua 5.4 or in ECMAScript
+ * are listed, with the argument counts that behave identically natively.
+ */
+bool DataModel::NativeTransform::Compiler::parseLibraryMember()
+{
+  // clang-format off
+  static constexpr LibraryConstant kLuaConstants[] = {
+    {"pi",   std::numbers::pi},
+    {"huge", std::numeric_limits<double>::infinity()},
+  };
+
+  static constexpr LibraryConstant kJsConstants[] = {
+    {"PI",      std::numbers::pi},
+    {"E",       std::numbers::e},
+    {"LN2",     std::numbers::ln2},
+    {"LN10",    std::numbers::ln10},
+    {"LOG2E",   std::numbers::log2e},
+    {"LOG10E",  std::numbers::log10e},
+    {"SQRT2",   std::numbers::sqrt2},
+    {"SQRT1_2", std::numbers::sqrt2 / 2},
+  };
+
+  static constexpr LibraryFunction kLuaFunctions[] = {
+    {"abs",   Function::Abs,    1,  1},
+    {"acos",  Function::Acos,   1,  1},
+    {"asin",  Function::Asin,   1,  1},
+    {"atan",  Function::Atan,   1,  2},
+    {"ceil",  Function::Ceil,   1,  1},
+    {"cos",   Function::Cos,    1,  1},
+    {"deg",   Function::Deg,    1,  1},
+    {"exp",   Function::Exp,    1,  1},
+    {"floor", Function::Floor,  1,  1},
+    {"fmod",  Function::Fmod,   2,  2},
+    {"log",   Function::Log,    1,  2},
+    {"max",   Function::LuaMax, 1, -1},
+    {"min",   Function::LuaMin, 1, -1},
+    {"rad",   Function::Rad,    1,  1},
+    {"sin",   Function::Sin,    1,  1},
+    {"sqrt",  Function::Sqrt,   1,  1},
+    {"tan",   Function::Tan,    1,  1},
+  };
+
+  static constexpr LibraryFunction kJsFunctions[] = {
+    {"abs",   Function::Abs,     1,  1},
+    {"acos",  Function::Acos,    1,  1},
+    {"asin",  Function::Asin,    1,  1},
+    {"atan",  Function::Atan,    1,  1},
+    {"atan2", Function::Atan2,   2,  2},
+    {"cbrt",  Function::Cbrt,    1,  1},
+    {"ceil",  Function::Ceil,    1,  1},
+    {"cos",   Function::Cos,     1,  1},
+    {"cosh",  Function::Cosh,    1,  1},
+    {"exp",   Function::Exp,     1,  1},
+    {"expm1", Function::Expm1,   1,  1},
+    {"floor", Function::Floor,   1,  1},
+    {"hypot", Function::Hypot,   1, -1},
+    {"log",   Function::Log,     1,  1},
+    {"log10", Function::Log10,   1,  1},
+    {"log1p", Function::Log1p,   1,  1},
+    {"log2",  Function::Log2,    1,  1},
+    {"max",   Function::JsMax,   1, -1},
+    {"min",   Function::JsMin,   1, -1},
+    {"pow",   Function::Pow,     2,  2},
+    {"round", Function::JsRound, 1,  1},
+    {"sign",  Function::Sign,    1,  1},
+    {"sin",   Function::Sin,     1,  1},
+    {"sinh",  Function::Sinh,    1,  1},
+    {"sqrt",  Function::Sqrt,    1,  1},
+    {"tan",   Function::Tan,     1,  1},
+    {"tanh",  Function::Tanh,    1,  1},
+    {"trunc", Function::Trunc,   1,  1},
+  };
+  // clang-format on
+
+  const auto member = peek();
+  if (member.kind != TokenKind::Name)
+    return false;
+
+  ++m_position;
+
+  // Library constants
+  if (!accept("(")) {
+    if (m_lua) {
+      for (const auto& c : kLuaConstants)
+        if (c.name == member.text)
+          return emit(Opcode::Constant, 0, c.value);
+    }
+
+    else {
+      for (const auto& c : kJsConstants)
+        if (c.name == member.text)
+          return emit(Opcode::Constant, 0, c.value);
+    }
+
+    return false;
+  }
+
+  // Library functions
+  const LibraryFunction* function = nullptr;
+  if (m_lua) {
+    for (const auto& f : kLuaFunctions)
+      if (f.name == member.text)
+        function = &f;
+  }
+
+  else {
+    for (const auto& f : kJsFunctions)
+      if (f.name == member.text)
+        function = &f;
+  }
+
+  if (!function)
+    return false;
+
+  // Arguments, each parsed as a separate power operand context
+  int count               = 0;
+  const bool powerOperand = m_powerOperand;
+  m_powerOperand          = false;
+  if (!accept(")")) {
+    do {
+      if (!parseExpression())
+        return false;
+
+      ++count;
+    } while (accept(","));
+
+    if (!accept(")"))
+      return false;
+  }
+
+  m_powerOperand = powerOperand;
+  if (count < function->minArgs || (function->maxArgs >= 0 && count > function->maxArgs))
+    return false;
+
+  // Two-argument forms of Lua's atan() and log()
+  auto id = function->function;
+  if (id == Function::Atan && count == 2)
+    id = Function::Atan2;
+  else if (id == Function::Log && count == 2)
+    id = Function::LogBase;
+
+  return emitCall(id, count);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Code generation
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Appends an instruction, folding it if all of its operands are
+ *        constants.
+ *
+ * Keeps track of the stack depth, and fails if a program would need more
+ * stack than evaluate() provides.
+ */
+bool DataModel::NativeTransform::Compiler::emit(Opcode op, int arg, double constant)
+{
+  // Pushes
+  if (op == Opcode::Constant || op == Opcode::Load) {
+    if (++m_depth > kMaxStack)
+      return false;
+
+    m_program.push_back({op, Function::Abs, arg, constant});
+    return true;
+  }
+
+  // Stores
+  if (op == Opcode::Store) {
+    --m_depth;
+    m_program.push_back({op, Function::Abs, arg, 0});
+    return true;
+  }
+
+  // Unary minus
+  const auto n = m_program.size();
+  if (op == Opcode::Negate) {
+    if (m_program.back().op == Opcode::Constant)
+      m_program.back().constant = -m_program.back().constant;
+    else
+      m_program.push_back({op, Function::Abs, 0, 0});
+
+    return true;
+  }
+
+  // Binary operators
+  --m_depth;
+  const auto* lhs = n >= 2 ? &m_program[n - 2] : nullptr;
+  const auto* rhs = n >= 1 ? &m_program[n - 1] : nullptr;
+  if (lhs && lhs->op == Opcode::Constant && rhs->op == Opcode::Constant) {
+    const auto value = binary(op, lhs->constant, rhs->constant);
+    m_program.pop_back();
+    m_program.back().constant = value;
+    return true;
+  }
+
+  m_program.push_back({op, Function::Abs, 0, 0});
+  return true;
+}
+
+/**
+ * @brief Appends a call to @p function with @p count arguments, folding it
+ *        if all of the arguments are constants.
+ */
+bool DataModel::NativeTransform::Compiler::emitCall(Function function, int count)
+{
+  m_depth -= count - 1;
+
+  const auto n    = m_program.size();
+  const auto args = static_cast<std::size_t>(count);
+  auto isConstant = [](const Instruction& i) {
+    return i.op == Opcode::Constant;
+  };
+
+  if (std::all_of(m_program.end() - count, m_program.end(), isConstant)) {
+    double values[kMaxStack];
+    for (std::size_t i = 0; i < args; ++i)
+      values[i] = m_program[n - args + i].constant;
+
+    m_program.resize(n - args + 1);
+    m_program.back().constant = call(function, values, count);
+    return true;
+  }
+
+  m_program.push_back({Opcode::Call, function, count, 0});
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Evaluation
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Compiles @p code if it fits the native subset.
+ *
+ * @param code     Transform source as stored in the dataset.
+ * @param language SerialStudio::ScriptLanguage of the owning source.
+ * @return The compiled transform, or std::nullopt if the code needs the
+ *         script engine.
+ */
+std::optional<DataModel::NativeTransform> DataModel::NativeTransform::compile(
+  const QString& code, int language)
+{
+  const auto utf8 = code.toUtf8();
+  const std::string_view source(utf8.constData(), static_cast<std::size_t>(utf8.size()));
+
+  NativeTransform transform;
+  Compiler compiler(source, language == SerialStudio::Lua, transform.m_program);
+  if (!compiler.compile())
+    return std::nullopt;
+
+  return transform;
+}
+
+/**
+ * @brief Runs the program for one input value.
+ *
+ * Non-finite results are returned as-is; the caller decides how to handle
+ * them, exactly like for script results.
+ */
+double DataModel::NativeTransform::evaluate(double value) const noexcept
+{
+  double stack[kMaxStack];
+  double slots[kMaxSlots];
+  slots[0] = value;
+
+  double* top = stack;
+  for (const auto& i : m_program) {
+    switch (i.op) {
+      case Opcode::Constant:
+        *top++ = i.constant;
+        break;
+      case Opcode::Load:
+        *top++ = slots[i.arg];
+        break;
+      case Opcode::Store:
+        slots[i.arg] = *--top;
+        break;
+      case Opcode::Negate:
+        top[-1] = -top[-1];
+        break;
+      case Opcode::Call:
+        top -= i.arg;
+        *top = call(i.function, top, i.arg);
+        ++top;
+        break;
+      default:
+        --top;
+        top[-1] = binary(i.op, top[-1], *top);
+        break;
+    }
+  }
+
+  return stack[0];
+}
+
+/**
+ * @brief Applies the binary operator @p op with the semantics of the source
+ *        language.
+ */
+double DataModel::NativeTransform::binary(Opcode op, double a, double b) noexcept
+{
+  switch (op) {
+    case Opcode::Add:
+      return a + b;
+    case Opcode::Subtract:
+      return a - b;
+    case Opcode::Multiply:
+      return a * b;
+    case Opcode::Divide:
+      return a / b;
+    case Opcode::FloorDivide:
+      return std::floor(a / b);
+    case Opcode::LuaModulo: {
+      // Lua's floored modulo, as implemented by luai_nummod
+      double m = std::fmod(a, b);
+      if ((m > 0) ? b < 0 : (m < 0 && b != m))
+        m += b;
+
+      return m;
+    }
+    case Opcode::JsModulo:
+      return std::fmod(a, b);
+    case Opcode::LuaPower:
+      return std::pow(a, b);
+    case Opcode::JsPower:
+      // ECMAScript differs from C for NaN exponents and |base| == 1 with ±inf
+      if (std::isnan(b) || (std::abs(a) == 1 && std::isinf(b)))
+        return std::numeric_limits<double>::quiet_NaN();
+
+      return std::pow(a, b);
+    default:
+      return std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+/**
+ * @brief Calls the library function @p function with @p count arguments.
+ */
+double DataModel::NativeTransform::call(Function function, const double* args, int count) noexcept
+{
+  const double x = args[0];
+  switch (function) {
+    case Function::Abs:
+      return std::abs(x);
+    case Function::Acos:
+      return std::acos(x);
+    case Function::Asin:
+      return std::asin(x);
+    case Function::Atan:
+      return std::atan(x);
+    case Function::Atan2:
+      return std::atan2(x, args[1]);
+    case Function::Cbrt:
+      return std::cbrt(x);
+    case Function::Ceil:
+      return std::ceil(x);
+    case Function::Cos:
+      return std::cos(x);
+    case Function::Cosh:
+      return std::cosh(x);
+    case Function::Deg:
+      return x * (180.0 / std::numbers::pi);
+    case Function::Exp:
+      return std::exp(x);
+    case Function::Expm1:
+      return std::expm1(x);
+    case Function::Floor:
+      return std::floor(x);
+    case Function::Fmod:
+      return std::fmod(x, args[1]);
+    case Function::Log:
+      return std::log(x);
+    case Function::Log10:
+      return std::log10(x);
+    case Function::Log1p:
+      return std::log1p(x);
+    case Function::Log2:
+      return std::log2(x);
+    case Function::Rad:
+      return x * (std::numbers::pi / 180.0);
+    case Function::Sin:
+      return std::sin(x);
+    case Function::Sinh:
+      return std::sinh(x);
+    case Function::Sqrt:
+      return std::sqrt(x);
+    case Function::Tan:
+      return std::tan(x);
+    case Function::Tanh:
+      return std::tanh(x);
+    case Function::Trunc:
+      return std::trunc(x);
+    case Function::LogBase:
+      // Lua's math.log(x, base) special-cases bases 2 and 10
+      if (args[1] == 2)
+        return std::log2(x);
+      if (args[1] == 10)
+        return std::log10(x);
+
+      return std::log(x) / std::log(args[1]);
+    case Function::Pow:
+      return binary(Opcode::JsPower, x, args[1]);
+    case Function::Sign:
+      if (x > 0)
+        return 1;
+      if (x < 0)
+        return -1;
+
+      return x;
+    case Function::JsRound: {
+      // Rounds half-way cases towards +inf and keeps -0, like Math.round()
+      const double r = std::floor(x);
+      return std::copysign(x - r >= 0.5 ? r + 1 : r, x);
+    }
+    case Function::Hypot: {
+      double sum = 0;
+      for (int i = 0; i < count; ++i)
+        sum = std::hypot(sum, args[i]);
+
+      return sum;
+    }
+    case Function::JsMax:
+    case Function::JsMin: {
+      double r = x;
+      for (int i = 1; i < count; ++i) {
+        if (std::isnan(r) || std::isnan(args[i]))
+          return std::numeric_limits<double>::quiet_NaN();
+
+        r = function == Function::JsMax ? std::max(r, args[i]) : std::min(r, args[i]);
+      }
+
+      return r;
+    }
+    case Function::LuaMax:
+    case Function::LuaMin: {
+      // Same comparisons as math_max/math_min in lmathlib.c
+      double r = x;
+      for (int i = 1; i < count; ++i) {
+        if (function == Function::LuaMax ? r < args[i] : args[i] < r)
+          r = args[i];
+      }
+
+      return r;
+    }
+  }
+
+  return std::numeric_limits<double>::quiet_NaN();
+}
@@ -0,0 +1,133 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <optional>
+#include <QString>
+#include <vector>
+
+namespace DataModel {
+
+/**
+ * @brief Native evaluator for simple arithmetic dataset transforms.
+ *
+ * Most transforms are a single formula: a scale and offset, a polynomial, a
+ * clamp or a unit conversion. compile() recognizes that subset in both Lua
+ * and JavaScript and turns it into a short stack program, so applying the
+ * transform is a loop over a few instructions instead of a script call.
+ *
+ * The accepted code is a lone `function transform(value)` whose body holds
+ * local constants or formulas (`local`, `var`, `let`, `const`) followed by a
+ * `return` statement. Expressions may use numbers, the parameter, earlier
+ * locals, `+ - * / %`, exponentiation (`^` in Lua, `**` in JavaScript),
+ * Lua's `//`, parentheses, and the pure functions and constants of Lua's
+ * `math` or JavaScript's `Math` library. Locals bound to constants are folded
+ * into the program.
+ *
+ * Anything else (top-level state, conditionals, loops, strings, other
+ * globals) makes compile() return std::nullopt, and the transform runs in
+ * the script engine as before. The operators follow the semantics of the
+ * source language, so both paths produce the same values.
+ */
+class NativeTransform {
+public:
+  [[nodiscard]] static std::optional<NativeTransform> compile(const QString& code, int language);
+
+  [[nodiscard]] double evaluate(double value) const noexcept;
+
+private:
+  enum class Opcode : quint8 {
+    Constant,
+    Load,
+    Store,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    FloorDivide,
+    LuaModulo,
+    JsModulo,
+    LuaPower,
+    JsPower,
+    Negate,
+    Call
+  };
+
+  enum class Function : quint8 {
+    Abs,
+    Acos,
+    Asin,
+    Atan,
+    Atan2,
+    Cbrt,
+    Ceil,
+    Cos,
+    Cosh,
+    Deg,
+    Exp,
+    Expm1,
+    Floor,
+    Fmod,
+    Hypot,
+    JsMax,
+    JsMin,
+    JsRound,
+    Log,
+    Log10,
+    Log1p,
+    Log2,
+    LogBase,
+    LuaMax,
+    LuaMin,
+    Pow,
+    Rad,
+    Sign,
+    Sin,
+    Sinh,
+    Sqrt,
+    Tan,
+    Tanh,
+    Trunc
+  };
+
+  struct Instruction {
+    Opcode op;
+    Function function;
+    int arg;
+    double constant;
+  };
+
+  class Compiler;
+
+  static constexpr int kMaxStack = 32;
+  static constexpr int kMaxSlots = 32;
+
+  NativeTransform() = default;
+
+  [[nodiscard]] static double call(Function function, const double* args, int count) noexcept;
+  [[nodiscard]] static double binary(Opcode op, double a, double b) noexcept;
+
+private:
+  std::vector<Instruction> m_program;
+};
+
+}  // namespace DataModel
@@ -1346,8 +1346,8 @@ void DataModel::ProjectEditor::buildSourceModel(const DataModel::Source& source)
       const auto props = driver->driverProperties();
       for (const auto& prop : props) {
         auto* item = new QStandardItem();
-        item->setEditable(true);
-        item->setData(true, Active);
+        item->setEditable(!prop.readOnly);
+        item->setData(!prop.readOnly, Active);
         item->setData(prop.key, ParameterKey);
         item->setData(kSourceView_Property, ParameterType);
         item->setData(prop.label, ParameterName);
@@ -661,7 +661,8 @@ void DataModel::ProjectModel::captureSourceSettings(int sourceId)
 
   QJsonObject settings;
   for (const auto& prop : driver->driverProperties())
-    settings.insert(prop.key, QJsonValue::fromVariant(prop.value));
+    if (!prop.readOnly)
+      settings.insert(prop.key, QJsonValue::fromVariant(prop.value));
 
   // Save stable hardware identifiers for cross-platform device matching
   const auto deviceId = driver->deviceIdentifier();
@@ -1355,7 +1356,8 @@ bool DataModel::ProjectModel::openJsonFile(const QString& path)
     if (uiDriver) {
       QJsonObject settings;
       for (const auto& prop : uiDriver->driverProperties())
-        settings.insert(prop.key, QJsonValue::fromVariant(prop.value));
+        if (!prop.readOnly)
+          settings.insert(prop.key, QJsonValue::fromVariant(prop.value));
 
       const auto deviceId = uiDriver->deviceIdentifier();
       if (!deviceId.isEmpty())
@@ -0,0 +1,482 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "DataModel/Reprocessor.h"
+
+#include <chrono>
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QTimer>
+
+#include "AppState.h"
+#include "CSV/Export.h"
+#include "DataModel/FrameBuilder.h"
+#include "IO/ConnectionManager.h"
+#include "MDF4/Export.h"
+#include "SerialStudio.h"
+
+//--------------------------------------------------------------------------------------------------
+// Constructor & singleton access
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs the reprocessor in the idle state.
+ */
+DataModel::Reprocessor::Reprocessor()
+  : m_running(false)
+  , m_cancelled(false)
+  , m_readerDone(false)
+  , m_bytesRead(0)
+  , m_fileSize(0)
+  , m_lastReportMs(0)
+  , m_lastReportFrames(0)
+  , m_framesPerSecond(0)
+  , m_csvWasEnabled(false)
+  , m_mdf4WasEnabled(false)
+{}
+
+/**
+ * @brief Stops the reader thread if a run is still active.
+ */
+DataModel::Reprocessor::~Reprocessor()
+{
+  m_cancelled.store(true, std::memory_order_relaxed);
+  if (m_readerThread.joinable())
+    m_readerThread.join();
+}
+
+/**
+ * @brief Returns the singleton instance.
+ */
+DataModel::Reprocessor& DataModel::Reprocessor::instance()
+{
+  static Reprocessor instance;
+  return instance;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Member access functions
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true while a file is being reprocessed.
+ *
+ * Safe to call from any thread; MDF4::Export reads it from its worker.
+ */
+bool DataModel::Reprocessor::isRunning() const noexcept
+{
+  return m_running.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the fraction of the input file consumed so far (0.0 to 1.0).
+ */
+double DataModel::Reprocessor::progress() const noexcept
+{
+  if (m_fileSize <= 0)
+    return isRunning() ? 0.0 : 1.0;
+
+  const auto bytes = m_bytesRead.load(std::memory_order_relaxed);
+  return qMin(1.0, static_cast<double>(bytes) / static_cast<double>(m_fileSize));
+}
+
+/**
+ * @brief Returns the throughput measured over the last report interval.
+ */
+double DataModel::Reprocessor::framesPerSecond() const noexcept
+{
+  return m_framesPerSecond;
+}
+
+/**
+ * @brief Returns the reason why the last call to start() failed, or why the
+ *        last run could not read its file.
+ */
+const QString& DataModel::Reprocessor::errorString() const noexcept
+{
+  return m_errorString;
+}
+
+/**
+ * @brief Returns the counters of the current or last run.
+ */
+const DataModel::ReprocessStats& DataModel::Reprocessor::stats() const noexcept
+{
+  return m_stats;
+}
+
+/**
+ * @brief Returns the state of the current or last run as a JSON object.
+ *
+ * Used by the API handler and the command-line summary.
+ */
+QJsonObject DataModel::Reprocessor::status() const
+{
+  const bool running = isRunning();
+
+  QJsonObject result;
+  result[QStringLiteral("running")]     = running;
+  result[QStringLiteral("filePath")]    = m_stats.filePath;
+  result[QStringLiteral("progress")]    = progress();
+  result[QStringLiteral("frames")]      = static_cast<qint64>(m_stats.frames);
+  result[QStringLiteral("bytes")]       = static_cast<qint64>(m_stats.bytes);
+  result[QStringLiteral("cancelled")]   = m_stats.cancelled;
+
+  if (running) {
+    result[QStringLiteral("elapsedSeconds")]  = m_clock.elapsed() / 1000.0;
+    result[QStringLiteral("framesPerSecond")] = m_framesPerSecond;
+  }
+
+  else {
+    result[QStringLiteral("elapsedSeconds")]  = m_stats.elapsedSeconds;
+    result[QStringLiteral("framesPerSecond")] = m_stats.framesPerSecond();
+  }
+
+  if (!m_errorString.isEmpty())
+    result[QStringLiteral("error")] = m_errorString;
+
+  return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Run control
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Starts reprocessing @p filePath with the current project settings.
+ *
+ * The file is treated as a raw capture of the bytes sent by device 0. CSV
+ * and MDF4 files are rejected: they hold values that were already parsed and
+ * transformed, so there is nothing to re-run and they can only be replayed
+ * with the players. The requested exporters are enabled for the duration of
+ * the run and restored afterwards; at least one of them must be available.
+ *
+ * @param filePath   File to reprocess.
+ * @param csvExport  Write the frames to a new CSV file.
+ * @param mdf4Export Write the frames to a new MDF4 file (Pro).
+ * @return @c true if the run started, otherwise errorString() says why.
+ */
+bool DataModel::Reprocessor::start(const QString& filePath, bool csvExport, bool mdf4Export)
+{
+  m_errorString.clear();
+
+  // The pipeline is shared with live connections and players
+  if (isRunning())
+    return fail(tr("A file is already being reprocessed"));
+
+  if (IO::ConnectionManager::instance().isConnected())
+    return fail(tr("Disconnect from the device before reprocessing a file"));
+
+  if (SerialStudio::isAnyPlayerOpen())
+    return fail(tr("Close the CSV/MDF4 player before reprocessing a file"));
+
+  // A run without an exporter would discard every frame
+#ifndef BUILD_COMMERCIAL
+  if (mdf4Export)
+    return fail(tr("MDF4 export requires Serial Studio Pro"));
+#endif
+
+  if (!csvExport && !mdf4Export)
+    return fail(tr("Select at least one output format (CSV or MDF4)"));
+
+  // Validate the input file
+  const QFileInfo info(filePath);
+  if (!info.isFile() || !info.isReadable())
+    return fail(tr("Cannot read file: %1").arg(filePath));
+
+  // Exports hold parsed and transformed values, not the bytes sent by the device
+  const auto suffix = info.suffix().toLower();
+  if (suffix == QLatin1String("csv"))
+    return fail(tr("CSV files can only be replayed, open them with the CSV player"));
+
+  if (suffix == QLatin1String("mf4") || suffix == QLatin1String("mdf"))
+    return fail(tr("MDF4 files can only be replayed, open them with the MDF4 player"));
+
+  const bool projectMode   = AppState::instance().operationMode() == SerialStudio::ProjectFile;
+  const bool projectLoaded = !DataModel::FrameBuilder::instance().frame().groups.empty();
+  if (projectMode && !projectLoaded)
+    return fail(tr("The loaded project has no groups"));
+
+  // Reset counters
+  m_stats            = ReprocessStats();
+  m_stats.filePath   = info.absoluteFilePath();
+  m_fileSize         = info.size();
+  m_lastReportMs     = 0;
+  m_lastReportFrames = 0;
+  m_framesPerSecond  = 0;
+  m_readError.clear();
+  m_bytesRead.store(0, std::memory_order_relaxed);
+  m_cancelled.store(false, std::memory_order_relaxed);
+  m_readerDone.store(false, std::memory_order_relaxed);
+
+  // The capture is split into frames exactly like device 0's stream
+  const auto config = IO::ConnectionManager::instance().buildFrameConfig(0);
+  m_frameReader     = std::make_unique<IO::FrameReader>();
+  m_frameReader->setChecksum(config.checksumAlgorithm);
+  m_frameReader->setStartSequence(config.startSequence);
+  m_frameReader->setFinishSequence(config.finishSequence);
+  m_frameReader->setOperationMode(config.operationMode);
+  m_frameReader->setFrameDetectionMode(config.frameDetection);
+
+  // Enable the requested exporters, creating fresh output files
+  auto& csv  = CSV::Export::instance();
+  auto& mdf4 = MDF4::Export::instance();
+  m_csvWasEnabled  = csv.exportEnabled();
+  m_mdf4WasEnabled = mdf4.exportEnabled();
+
+  csv.closeFile();
+  mdf4.closeFile();
+  csv.setExportEnabled(csvExport);
+  mdf4.setExportEnabled(mdf4Export);
+  csv.cacheTemplateFrame();
+  mdf4.cacheTemplateFrame();
+
+  // Compile the parser and transforms, then start reading
+  DataModel::FrameBuilder::instance().openSession();
+
+  m_running.store(true, std::memory_order_release);
+  m_clock.start();
+  m_readerThread = std::thread([this] { readRawFile(); });
+
+  Q_EMIT runningChanged();
+  Q_EMIT progressChanged();
+
+  scheduleDrain(false);
+  return true;
+}
+
+/**
+ * @brief Aborts the current run, keeping the output written so far.
+ */
+void DataModel::Reprocessor::cancel()
+{
+  if (!isRunning())
+    return;
+
+  m_cancelled.store(true, std::memory_order_relaxed);
+  finish(true);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Main-thread pipeline
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Feeds queued frames to FrameBuilder for one time slice.
+ *
+ * Runs on the main thread in short slices so that the event loop (API
+ * server, exporter signals) stays responsive, and yields early whenever an
+ * exporter falls behind.
+ */
+void DataModel::Reprocessor::drainFrames()
+{
+  if (!isRunning())
+    return;
+
+  // Let the export workers catch up before publishing more frames
+  if (exportersBacklogged()) {
+    scheduleDrain(true);
+    return;
+  }
+
+  static auto& frameBuilder = DataModel::FrameBuilder::instance();
+
+  bool idle = false;
+  QElapsedTimer slice;
+  slice.start();
+  while (!idle && slice.elapsed() < kSliceMs) {
+    // Check the clock and the exporters every 256 frames
+    for (int i = 0; i < 256; ++i) {
+      if (!m_frameReader->queue().try_dequeue(m_frameScratch)) {
+        idle = true;
+        break;
+      }
+
+      if (!m_frameScratch.isEmpty()) [[likely]]
+        frameBuilder.hotpathRxSourceFrame(0, m_frameScratch);
+
+      m_frameReader->recycleFrame(m_frameScratch);
+      ++m_stats.frames;
+    }
+
+    if (exportersBacklogged())
+      break;
+  }
+
+  updateThroughput(false);
+
+  // The reader publishes its last frames before raising the done flag
+  if (idle && m_readerDone.load(std::memory_order_acquire)) {
+    if (m_frameReader->queue().peek() == nullptr) {
+      finish(m_cancelled.load(std::memory_order_relaxed));
+      return;
+    }
+
+    idle = false;
+  }
+
+  scheduleDrain(idle);
+}
+
+/**
+ * @brief Queues the next drainFrames() call.
+ *
+ * @param idle Wait a millisecond first, because the reader or an exporter
+ *             needs time to catch up; otherwise run on the next event loop
+ *             iteration.
+ */
+void DataModel::Reprocessor::scheduleDrain(bool idle)
+{
+  if (idle)
+    QTimer::singleShot(1, this, &DataModel::Reprocessor::drainFrames);
+  else
+    QMetaObject::invokeMethod(this, &DataModel::Reprocessor::drainFrames, Qt::QueuedConnection);
+}
+
+/**
+ * @brief Refreshes the throughput figure and notifies listeners once per
+ *        second, or immediately when @p force is set.
+ */
+void DataModel::Reprocessor::updateThroughput(bool force)
+{
+  const auto now = m_clock.elapsed();
+  if (!force && now - m_lastReportMs < 1000)
+    return;
+
+  const auto frames = m_stats.frames - m_lastReportFrames;
+  if (now > m_lastReportMs)
+    m_framesPerSecond = static_cast<double>(frames) * 1000.0 / (now - m_lastReportMs);
+
+  m_lastReportMs     = now;
+  m_lastReportFrames = m_stats.frames;
+  Q_EMIT progressChanged();
+}
+
+/**
+ * @brief Checks whether an enabled exporter has a large backlog.
+ */
+bool DataModel::Reprocessor::exportersBacklogged() const
+{
+  if (CSV::Export::instance().backlogged())
+    return true;
+
+#ifdef BUILD_COMMERCIAL
+  if (MDF4::Export::instance().backlogged())
+    return true;
+#endif
+
+  return false;
+}
+
+/**
+ * @brief Ends the run, flushes the exporters and publishes the summary.
+ *
+ * @param cancelled @c true if the run was aborted before the end of the file.
+ */
+void DataModel::Reprocessor::finish(bool cancelled)
+{
+  if (m_readerThread.joinable())
+    m_readerThread.join();
+
+  m_frameReader.reset();
+
+  // The reader thread is joined, so its error can be read safely
+  if (!m_readError.isEmpty()) [[unlikely]]
+    static_cast<void>(fail(m_readError));
+
+  // Write every queued frame before the exporters see the run as finished
+  auto& csv  = CSV::Export::instance();
+  auto& mdf4 = MDF4::Export::instance();
+  csv.closeAndWait();
+#ifdef BUILD_COMMERCIAL
+  mdf4.closeAndWait();
+#endif
+
+  csv.setExportEnabled(m_csvWasEnabled);
+  mdf4.setExportEnabled(m_mdf4WasEnabled);
+  DataModel::FrameBuilder::instance().closeSession();
+
+  // Publish the summary
+  updateThroughput(true);
+  m_stats.cancelled      = cancelled;
+  m_stats.bytes          = m_bytesRead.load(std::memory_order_relaxed);
+  m_stats.elapsedSeconds = m_clock.elapsed() / 1000.0;
+  m_running.store(false, std::memory_order_release);
+
+  Q_EMIT runningChanged();
+  Q_EMIT progressChanged();
+  Q_EMIT finished();
+}
+
+/**
+ * @brief Records @p error as the reason why start() or the run failed.
+ * @return Always @c false, so callers can return it directly.
+ */
+bool DataModel::Reprocessor::fail(const QString& error)
+{
+  m_errorString = error;
+  qWarning() << "[Reprocessor]" << error;
+  return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Reader thread
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Reads a raw capture and extracts its frames on the reader thread.
+ *
+ * The file is fed to the FrameReader in small chunks. Before each chunk the
+ * thread waits until the frame queue has room for every frame the chunk
+ * could produce, because the FrameReader drops frames on a full queue.
+ *
+ * Open and read errors are stored in m_readError, which finish() reports
+ * once the thread is joined.
+ */
+void DataModel::Reprocessor::readRawFile()
+{
+  QFile file(m_stats.filePath);
+  if (!file.open(QIODevice::ReadOnly)) {
+    m_readError = tr("Cannot open file: %1 (%2)").arg(m_stats.filePath, file.errorString());
+    m_readerDone.store(true, std::memory_order_release);
+    return;
+  }
+
+  auto& queue = m_frameReader->queue();
+  while (!m_cancelled.load(std::memory_order_relaxed)) {
+    while (queue.size_approx() > kFrameHighWater && !m_cancelled.load(std::memory_order_relaxed))
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+    auto chunk = file.read(kRawChunkSize);
+    if (chunk.isEmpty()) {
+      if (file.error() != QFileDevice::NoError) [[unlikely]]
+        m_readError = tr("Cannot read file: %1 (%2)").arg(m_stats.filePath, file.errorString());
+
+      break;
+    }
+
+    m_bytesRead.fetch_add(static_cast<quint64>(chunk.size()), std::memory_order_relaxed);
+    m_frameReader->processData(IO::makeByteArray(std::move(chunk)));
+  }
+
+  m_readerDone.store(true, std::memory_order_release);
+}
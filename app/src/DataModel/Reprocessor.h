@@ -0,0 +1,155 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QObject>
+#include <thread>
+
+#include "IO/FrameReader.h"
+
+namespace DataModel {
+/**
+ * @brief Counters describing a batch reprocessing run.
+ */
+struct ReprocessStats {
+  QString filePath;
+  quint64 bytes         = 0;
+  quint64 frames        = 0;
+  double elapsedSeconds = 0;
+  bool cancelled        = false;
+
+  /**
+   * @brief Returns the average throughput of the run in frames per second.
+   */
+  [[nodiscard]] double framesPerSecond() const
+  {
+    return elapsedSeconds > 0 ? static_cast<double>(frames) / elapsedSeconds : 0;
+  }
+};
+
+/**
+ * @class DataModel::Reprocessor
+ * @brief Streams a recorded file through the frame pipeline as fast as possible.
+ *
+ * Batch reprocessing re-runs a changed frame parser or dataset transform over
+ * captured data and regenerates the CSV/MDF4 outputs, without waiting for the
+ * wall-clock pacing of CSV::Player and MDF4::Player.
+ *
+ * The input is a raw capture (console log, binary dump): the bytes are split
+ * into frames by an IO::FrameReader configured like device 0, then parsed by
+ * FrameParser and the dataset transforms, exactly like live data. CSV and
+ * MDF4 exports are not accepted; their values were already parsed and
+ * transformed, so they are replayed with the players instead.
+ *
+ * The work is split over three kinds of threads: a reader thread reads the
+ * file and does the frame extraction, the main thread runs FrameBuilder, and
+ * the export workers format and write the output. Both hand-offs are
+ * bounded; the reader waits on a full queue and the main thread waits while
+ * an exporter is backlogged, so no frame is dropped and memory use stays flat
+ * regardless of the file size.
+ *
+ * The dashboard is not updated during a run, since no device is connected and
+ * no player is open.
+ */
+class Reprocessor : public QObject {
+  // clang-format off
+  Q_OBJECT
+  Q_PROPERTY(bool running
+             READ isRunning
+             NOTIFY runningChanged)
+  Q_PROPERTY(double progress
+             READ progress
+             NOTIFY progressChanged)
+  // clang-format on
+
+signals:
+  void finished();
+  void runningChanged();
+  void progressChanged();
+
+private:
+  explicit Reprocessor();
+  Reprocessor(Reprocessor&&)                 = delete;
+  Reprocessor(const Reprocessor&)            = delete;
+  Reprocessor& operator=(Reprocessor&&)      = delete;
+  Reprocessor& operator=(const Reprocessor&) = delete;
+
+  ~Reprocessor();
+
+public:
+  [[nodiscard]] static Reprocessor& instance();
+
+  [[nodiscard]] bool isRunning() const noexcept;
+  [[nodiscard]] double progress() const noexcept;
+  [[nodiscard]] double framesPerSecond() const noexcept;
+  [[nodiscard]] const QString& errorString() const noexcept;
+  [[nodiscard]] const ReprocessStats& stats() const noexcept;
+  [[nodiscard]] QJsonObject status() const;
+
+public slots:
+  bool start(const QString& filePath, bool csvExport, bool mdf4Export);
+  void cancel();
+
+private slots:
+  void drainFrames();
+
+private:
+  void readRawFile();
+  void finish(bool cancelled);
+  void scheduleDrain(bool idle);
+  void updateThroughput(bool force);
+
+  [[nodiscard]] bool exportersBacklogged() const;
+  [[nodiscard]] bool fail(const QString& error);
+
+private:
+  static constexpr int kSliceMs           = 20;
+  static constexpr qint64 kRawChunkSize   = 16 * 1024;
+  static constexpr size_t kFrameHighWater = 8192;
+
+  QString m_readError;
+  QString m_errorString;
+  ReprocessStats m_stats;
+
+  std::thread m_readerThread;
+  std::atomic<bool> m_running;
+  std::atomic<bool> m_cancelled;
+  std::atomic<bool> m_readerDone;
+  std::atomic<quint64> m_bytesRead;
+
+  qint64 m_fileSize;
+  std::unique_ptr<IO::FrameReader> m_frameReader;
+  QByteArray m_frameScratch;
+
+  QElapsedTimer m_clock;
+  qint64 m_lastReportMs;
+  quint64 m_lastReportFrames;
+  double m_framesPerSecond;
+
+  bool m_csvWasEnabled;
+  bool m_mdf4WasEnabled;
+};
+}  // namespace DataModel
@@ -0,0 +1,203 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "DataModel/TransformFilters.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+//--------------------------------------------------------------------------------------------------
+// Constructor
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Creates an empty filter bank.
+ */
+DataModel::TransformFilters::TransformFilters(QObject* parent)
+  : QObject(parent)
+  , m_uniqueId(-1)
+  , m_call(0)
+{}
+
+//--------------------------------------------------------------------------------------------------
+// State management
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Starts a transform invocation for dataset @p uniqueId.
+ *
+ * Resets the call counter, so the filters called by the transform map to
+ * the same state slots on every frame.
+ */
+void DataModel::TransformFilters::begin(int uniqueId)
+{
+  m_uniqueId = uniqueId;
+  m_call     = 0;
+}
+
+/**
+ * @brief Drops the state of every filter.
+ */
+void DataModel::TransformFilters::reset()
+{
+  m_states.clear();
+  m_uniqueId = -1;
+  m_call     = 0;
+}
+
+/**
+ * @brief Returns the state slot of the current filter call.
+ *
+ * New slots, and slots last used by a different filter type, start from a
+ * clean state.
+ */
+DataModel::TransformFilters::State& DataModel::TransformFilters::state(Kind kind)
+{
+  const auto key = (static_cast<quint64>(static_cast<quint32>(m_uniqueId)) << 32) | m_call++;
+  auto& s        = m_states[key];
+  if (s.kind != kind) {
+    s.kind   = kind;
+    s.primed = false;
+    s.z1     = 0;
+    s.z2     = 0;
+    s.head   = 0;
+    s.count  = 0;
+    s.window.clear();
+  }
+
+  return s;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Filters
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Simple moving average of the last @p window samples.
+ *
+ * Keeps a running sum, which is recomputed from the window every time the
+ * ring wraps so rounding errors cannot accumulate.
+ */
+double DataModel::TransformFilters::sma(double value, int window)
+{
+  auto& s = state(Kind::Sma);
+  if (!std::isfinite(value))
+    return value;
+
+  const auto size = static_cast<std::size_t>(std::clamp(window, 1, 65536));
+  if (s.window.size() != size) {
+    s.window.assign(size, 0);
+    s.head  = 0;
+    s.count = 0;
+    s.z1    = 0;
+  }
+
+  // Replace the oldest sample and update the running sum
+  s.z1             = s.z1 - s.window[s.head] + value;
+  s.window[s.head] = value;
+  s.head           = (s.head + 1) % size;
+  s.count          = std::min(s.count + 1, size);
+  if (s.head == 0)
+    s.z1 = std::accumulate(s.window.begin(), s.window.end(), 0.0);
+
+  return s.z1 / static_cast<double>(s.count);
+}
+
+/**
+ * @brief Exponential moving average with smoothing factor @p alpha.
+ *
+ * The first sample initializes the average. @p alpha is clamped to [0, 1];
+ * values closer to 1 follow the input faster.
+ */
+double DataModel::TransformFilters::ema(double value, double alpha)
+{
+  auto& s = state(Kind::Ema);
+  if (!std::isfinite(value))
+    return value;
+
+  if (!s.primed) {
+    s.primed = true;
+    s.z1     = value;
+  }
+
+  else
+    s.z1 += std::clamp(alpha, 0.0, 1.0) * (value - s.z1);
+
+  return s.z1;
+}
+
+/**
+ * @brief Second-order IIR section with a0 normalized to 1.
+ *
+ * Implemented in transposed direct form II:
+ * y = b0·x + z1, z1 = b1·x − a1·y + z2, z2 = b2·x − a2·y.
+ */
+double DataModel::TransformFilters::biquad(
+  double value, double b0, double b1, double b2, double a1, double a2)
+{
+  auto& s = state(Kind::Biquad);
+  if (!std::isfinite(value))
+    return value;
+
+  const auto y = b0 * value + s.z1;
+  s.z1         = b1 * value - a1 * y + s.z2;
+  s.z2         = b2 * value - a2 * y;
+
+  // Recover from unstable coefficients instead of staying at inf/NaN
+  if (!std::isfinite(s.z1) || !std::isfinite(s.z2)) [[unlikely]] {
+    s.z1 = 0;
+    s.z2 = 0;
+  }
+
+  return y;
+}
+
+/**
+ * @brief Rate of change between consecutive samples.
+ *
+ * Returns 0 for the first sample. @p dt is the sample interval; with the
+ * default of 1 the result is the change per sample.
+ */
+double DataModel::TransformFilters::derivative(double value, double dt)
+{
+  auto& s = state(Kind::Derivative);
+  if (!std::isfinite(value))
+    return value;
+
+  const auto change = s.primed && dt != 0 ? (value - s.z1) / dt : 0.0;
+  s.primed          = true;
+  s.z1              = value;
+  return change;
+}
+
+/**
+ * @brief Running integral of the input, accumulated as value * dt.
+ */
+double DataModel::TransformFilters::integrate(double value, double dt)
+{
+  auto& s = state(Kind::Integrate);
+  if (!std::isfinite(value))
+    return value;
+
+  s.z1 += value * dt;
+  return s.z1;
+}
@@ -0,0 +1,95 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <QObject>
+#include <unordered_map>
+#include <vector>
+
+namespace DataModel {
+
+/**
+ * @brief Native stateful filters for dataset transforms.
+ *
+ * Exposed to Lua and JavaScript transforms as the `dsp` object, so filters
+ * no longer need hand-written global state:
+ *
+ * - `dsp.sma(value, window)`: simple moving average over the last samples.
+ * - `dsp.ema(value, alpha)`: exponential moving average.
+ * - `dsp.biquad(value, b0, b1, b2, a1, a2)`: normalized IIR biquad section.
+ * - `dsp.derivative(value[, dt])`: change per sample, or per @c dt seconds.
+ * - `dsp.integrate(value[, dt])`: running sum of value * dt.
+ *
+ * State is keyed by the dataset's uniqueId and by the order of the calls
+ * within one transform invocation: the second filter call of a transform
+ * always gets the second state slot of that dataset. FrameBuilder calls
+ * begin() before each transform, and filter calls should therefore not be
+ * made conditionally. A slot whose filter type or window changes starts
+ * over. Non-finite inputs are returned unchanged and leave the state alone.
+ */
+class TransformFilters : public QObject {
+  // clang-format off
+  Q_OBJECT
+  // clang-format on
+
+public:
+  explicit TransformFilters(QObject* parent = nullptr);
+
+  Q_INVOKABLE void begin(int uniqueId);
+
+  Q_INVOKABLE double sma(double value, int window);
+  Q_INVOKABLE double ema(double value, double alpha);
+  Q_INVOKABLE double biquad(double value, double b0, double b1, double b2, double a1, double a2);
+  Q_INVOKABLE double derivative(double value, double dt = 1);
+  Q_INVOKABLE double integrate(double value, double dt = 1);
+
+  void reset();
+
+private:
+  enum class Kind {
+    None,
+    Sma,
+    Ema,
+    Biquad,
+    Derivative,
+    Integrate
+  };
+
+  struct State {
+    Kind kind;
+    bool primed;
+    double z1;
+    double z2;
+    std::size_t head;
+    std::size_t count;
+    std::vector<double> window;
+  };
+
+  State& state(Kind kind);
+
+private:
+  int m_uniqueId;
+  quint32 m_call;
+  std::unordered_map<quint64, State> m_states;
+};
+
+}  // namespace DataModel
@@ -21,9 +21,52 @@
 
 #include "IO/Checksum.h"
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <QDebug>
 
+//--------------------------------------------------------------------------------------------------
+// Hardware CRC support
+//--------------------------------------------------------------------------------------------------
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define CHECKSUM_X86_CRC 1
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  endif
+#  include <nmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#  define CHECKSUM_ARM_CRC 1
+#  if defined(_WIN32)
+#    include <windows.h>
+#  elif defined(Q_OS_LINUX)
+#    include <asm/hwcap.h>
+#    include <sys/auxv.h>
+#  endif
+#  if defined(__ARM_FEATURE_CRC32) || defined(_MSC_VER)
+#    define CHECKSUM_ARM_CRC_TARGET
+#  elif defined(__clang__)
+#    define CHECKSUM_ARM_CRC_TARGET __attribute__((target("crc")))
+#  else
+#    define CHECKSUM_ARM_CRC_TARGET __attribute__((target("+crc")))
+#  endif
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  else
+#    include <arm_acle.h>
+#  endif
+#endif
+
+#ifndef CHECKSUM_X86_CRC
+#  define CHECKSUM_X86_CRC 0
+#endif
+
+#ifndef CHECKSUM_ARM_CRC
+#  define CHECKSUM_ARM_CRC 0
+#endif
+
 //--------------------------------------------------------------------------------------------------
 // Endianess detection
 //--------------------------------------------------------------------------------------------------
@@ -104,6 +147,196 @@ static void little_endian_memcpy(uint8_t* frame, const void* data, size_t size)
 #endif
 }
 
+//--------------------------------------------------------------------------------------------------
+// Table-driven CRC kernels
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Slice-by-8 lookup tables for a CRC whose width matches @c T.
+ *
+ * Entry @c t[k][b] is the CRC register after feeding byte @c b followed by
+ * @c k zero bytes, so eight input bytes can be folded into the register with
+ * eight independent lookups. Reflected CRCs take the reversed polynomial.
+ *
+ * The tables are built at compile time.
+ */
+template<typename T, T Poly, bool Reflected>
+struct CrcTables {
+  static constexpr int kWidth = static_cast<int>(sizeof(T)) * 8;
+
+  std::array<std::array<T, 256>, 8> t{};
+
+  constexpr CrcTables()
+  {
+    for (int b = 0; b < 256; ++b) {
+      T crc = Reflected ? static_cast<T>(b) : static_cast<T>(b << (kWidth - 8));
+      for (int j = 0; j < 8; ++j) {
+        if constexpr (Reflected)
+          crc = (crc & 1) ? static_cast<T>((crc >> 1) ^ Poly) : static_cast<T>(crc >> 1);
+        else
+          crc = (crc >> (kWidth - 1)) ? static_cast<T>((crc << 1) ^ Poly)
+                                      : static_cast<T>(crc << 1);
+      }
+
+      t[0][b] = crc;
+    }
+
+    for (int k = 1; k < 8; ++k) {
+      for (int b = 0; b < 256; ++b) {
+        const T prev = t[k - 1][b];
+        if constexpr (Reflected)
+          t[k][b] = static_cast<T>((prev >> 8) ^ t[0][prev & 0xFF]);
+        else
+          t[k][b] = static_cast<T>((prev << 8) ^ t[0][prev >> (kWidth - 8)]);
+      }
+    }
+  }
+};
+
+template<typename T, T Poly, bool Reflected>
+static constexpr CrcTables<T, Poly, Reflected> kCrcTables{};
+
+/**
+ * @brief Feeds @p length bytes into a CRC register using slice-by-8 tables.
+ *
+ * Works on bytes only, so the result does not depend on the host endianness
+ * or on the alignment of @p data. The caller applies the initial value and
+ * the final XOR of the CRC variant.
+ *
+ * **Performance:** O(n) with one table lookup per byte and no per-bit loop
+ * **Thread Safety:** Pure function - safe for concurrent calls
+ *
+ * @param crc Current CRC register value
+ * @param data Pointer to the input data array
+ * @param length Length of the input data array
+ * @return The updated CRC register
+ */
+template<typename T, T Poly, bool Reflected>
+static constexpr T crcUpdate(T crc, const char* data, int length) noexcept
+{
+  constexpr int kBytes = static_cast<int>(sizeof(T));
+  constexpr int kWidth = kBytes * 8;
+  const auto& t        = kCrcTables<T, Poly, Reflected>.t;
+
+  // Fold eight bytes per iteration, the leading ones overlap the register
+  int pos = 0;
+  for (; pos + 8 <= length; pos += 8) {
+    T next = 0;
+    for (int i = 0; i < 8; ++i) {
+      auto byte = static_cast<uint8_t>(data[pos + i]);
+      if (i < kBytes) {
+        if constexpr (Reflected)
+          byte ^= static_cast<uint8_t>(crc >> (8 * i));
+        else
+          byte ^= static_cast<uint8_t>(crc >> (8 * (kBytes - 1 - i)));
+      }
+
+      next ^= t[7 - i][byte];
+    }
+
+    crc = next;
+  }
+
+  // Finish the tail one byte at a time
+  for (; pos < length; ++pos) {
+    const auto byte = static_cast<uint8_t>(data[pos]);
+    if constexpr (Reflected)
+      crc = static_cast<T>((crc >> 8) ^ t[0][static_cast<uint8_t>(crc ^ byte)]);
+    else
+      crc = static_cast<T>((crc << 8) ^ t[0][static_cast<uint8_t>(crc >> (kWidth - 8)) ^ byte]);
+  }
+
+  return crc;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Hardware CRC kernels
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Feeds bytes into a CRC-32C register with the SSE4.2 crc32 instruction.
+ *
+ * Only called after cpuSupportsCrc() confirmed SSE4.2 support at runtime.
+ */
+#if CHECKSUM_X86_CRC
+#  if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#  endif
+static uint32_t crc32cHardware(uint32_t crc, const char* data, int length) noexcept
+{
+  const auto* p = reinterpret_cast<const uint8_t*>(data);
+  auto wide     = static_cast<uint64_t>(crc);
+  for (; length >= 8; length -= 8, p += 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    wide = _mm_crc32_u64(wide, word);
+  }
+
+  crc = static_cast<uint32_t>(wide);
+  for (; length > 0; --length, ++p)
+    crc = _mm_crc32_u8(crc, *p);
+
+  return crc;
+}
+#endif
+
+/**
+ * @brief Feeds bytes into a CRC-32 or CRC-32C register with the ARMv8 CRC
+ *        instructions.
+ *
+ * The instructions consume little-endian words, which is the byte order of
+ * every AArch64 target we build for. Only called after cpuSupportsCrc()
+ * confirmed the CRC extension at runtime.
+ */
+#if CHECKSUM_ARM_CRC
+template<bool Castagnoli>
+CHECKSUM_ARM_CRC_TARGET static uint32_t crc32Hardware(uint32_t crc,
+                                                      const char* data,
+                                                      int length) noexcept
+{
+  const auto* p = reinterpret_cast<const uint8_t*>(data);
+  for (; length >= 8; length -= 8, p += 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    crc = Castagnoli ? __crc32cd(crc, word) : __crc32d(crc, word);
+  }
+
+  for (; length > 0; --length, ++p)
+    crc = Castagnoli ? __crc32cb(crc, *p) : __crc32b(crc, *p);
+
+  return crc;
+}
+#endif
+
+/**
+ * @brief Reports whether the CPU running the application has CRC instructions.
+ *
+ * Checked once, the result is cached for the lifetime of the process.
+ */
+[[maybe_unused]] static bool cpuSupportsCrc() noexcept
+{
+  static const bool supported = [] {
+#if CHECKSUM_X86_CRC && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#elif CHECKSUM_X86_CRC
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2") != 0;
+#elif CHECKSUM_ARM_CRC && defined(__ARM_FEATURE_CRC32)
+    return true;
+#elif CHECKSUM_ARM_CRC && defined(_WIN32)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#elif CHECKSUM_ARM_CRC && defined(Q_OS_LINUX)
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+    return false;
+#endif
+  }();
+
+  return supported;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Checksum implementations
 //--------------------------------------------------------------------------------------------------
@@ -137,7 +370,7 @@ static constexpr uint8_t xor8(const char* data, const int length) noexcept
  * Common in SMBus and lightweight communication protocols.
  *
  * **Algorithm:** CRC-8-SAE-J1850 variant
- * **Performance:** O(n × 8) where n = length (bit-by-bit computation)
+ * **Performance:** O(n) where n = length (slice-by-8 tables)
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
@@ -146,16 +379,7 @@ static constexpr uint8_t xor8(const char* data, const int length) noexcept
  */
 static constexpr uint8_t crc8(const char* data, const int length) noexcept
 {
-  uint8_t crc = 0xFF;
-  for (int i = 0; i < length; ++i) {
-    crc ^= static_cast<uint8_t>(data[i]);
-    for (int j = 0; j < 8; ++j)
-      if (crc & 0x80)
-        crc = (crc << 1) ^ 0x31;
-      else
-        crc <<= 1;
-  }
-  return crc;
+  return crcUpdate<uint8_t, 0x31, false>(0xFF, data, length);
 }
 
 /**
@@ -179,11 +403,16 @@ static constexpr uint8_t mod256(const char* data, const int length) noexcept
 }
 
 /**
- * @brief Computes a 16-bit CRC using a custom bitwise algorithm.
+ * @brief Computes a 16-bit CRC (CRC-16/CCITT-FALSE) using polynomial 0x1021
+ * and initial value 0xFFFF.
  *
- * This is not a standard CRC-16 variant. Rename if needed for clarity.
+ * Listed as both "CRC-16" and "CRC-16-CCITT-FALSE". Used in Bluetooth, SD
+ * cards and many proprietary serial protocols.
  *
- * **Performance:** O(n) where n = length (optimized bit manipulation)
+ * **Algorithm:** CRC-16/CCITT-FALSE (also known as CRC-16/IBM-3740)
+ * **Polynomial:** 0x1021
+ * **Init Value:** 0xFFFF
+ * **Performance:** O(n) where n = length (slice-by-8 tables)
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
@@ -192,16 +421,7 @@ static constexpr uint8_t mod256(const char* data, const int length) noexcept
  */
 static constexpr uint16_t crc16(const char* data, const int length) noexcept
 {
-  uint8_t x;
-  uint16_t crc = 0xFFFF;
-
-  for (int i = 0; i < length; ++i) {
-    x = crc >> 8 ^ static_cast<uint8_t>(data[i]);
-    x ^= x >> 4;
-    crc = (crc << 8) ^ ((uint16_t)(x << 12)) ^ ((uint16_t)(x << 5)) ^ x;
-  }
-
-  return crc;
+  return crcUpdate<uint16_t, 0x1021, false>(0xFFFF, data, length);
 }
 
 /**
@@ -211,27 +431,49 @@ static constexpr uint16_t crc16(const char* data, const int length) noexcept
  *
  * **Algorithm:** CRC-32 (IEEE 802.3, used in Ethernet, ZIP, PNG)
  * **Polynomial:** 0x04C11DB7 (normal) / 0xEDB88320 (reflected)
- * **Performance:** O(n × 8) where n = length (bit-by-bit computation)
+ * **Performance:** O(n), ARMv8 CRC instructions or slice-by-8 tables
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
  * @param length Length of the input data array
  * @return The computed 32-bit CRC checksum
  */
-static constexpr uint32_t crc32(const char* data, const int length) noexcept
+static uint32_t crc32(const char* data, const int length) noexcept
 {
-  uint32_t crc = 0xFFFFFFFF;
-
-  for (int i = 0; i < length; ++i) {
-    crc ^= static_cast<uint8_t>(data[i]);
-    for (int j = 0; j < 8; ++j)
-      if (crc & 1)
-        crc = (crc >> 1) ^ 0xEDB88320;
-      else
-        crc >>= 1;
-  }
+#if CHECKSUM_ARM_CRC
+  if (cpuSupportsCrc())
+    return ~crc32Hardware<false>(0xFFFFFFFF, data, length);
+#endif
 
-  return ~crc;
+  return ~crcUpdate<uint32_t, 0xEDB88320, true>(0xFFFFFFFF, data, length);
+}
+
+/**
+ * @brief Computes a 32-bit CRC (CRC-32C) using the Castagnoli polynomial.
+ *
+ * Used by iSCSI, SCTP, ext4, Btrfs and several sensor buses. Detects more
+ * error patterns than CRC-32 for the same width.
+ *
+ * **Algorithm:** CRC-32C (Castagnoli)
+ * **Polynomial:** 0x1EDC6F41 (normal) / 0x82F63B78 (reflected)
+ * **Performance:** O(n), SSE4.2/ARMv8 CRC instructions or slice-by-8 tables
+ * **Thread Safety:** Pure function - safe for concurrent calls
+ *
+ * @param data Pointer to the input data array
+ * @param length Length of the input data array
+ * @return The computed 32-bit CRC checksum
+ */
+static uint32_t crc32c(const char* data, const int length) noexcept
+{
+#if CHECKSUM_X86_CRC
+  if (cpuSupportsCrc())
+    return ~crc32cHardware(0xFFFFFFFF, data, length);
+#elif CHECKSUM_ARM_CRC
+  if (cpuSupportsCrc())
+    return ~crc32Hardware<true>(0xFFFFFFFF, data, length);
+#endif
+
+  return ~crcUpdate<uint32_t, 0x82F63B78, true>(0xFFFFFFFF, data, length);
 }
 
 /**
@@ -241,7 +483,7 @@ static constexpr uint32_t crc32(const char* data, const int length) noexcept
  *
  * **Algorithm:** Adler-32 (faster than CRC-32, weaker error detection)
  * **Modulus:** 65521 (largest prime less than 2^16)
- * **Performance:** O(n) where n = length (two sums with modulo)
+ * **Performance:** O(n) where n = length (one modulo per 5552 bytes)
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
@@ -250,12 +492,20 @@ static constexpr uint32_t crc32(const char* data, const int length) noexcept
  */
 static constexpr uint32_t adler32(const char* data, const int length) noexcept
 {
+  // Largest block for which b cannot overflow 32 bits before the modulo
   constexpr uint32_t kModAdler = 65521;
-  uint32_t a = 1, b = 0;
+  constexpr int kMaxBlock      = 5552;
 
-  for (int i = 0; i < length; ++i) {
-    a = (a + static_cast<uint8_t>(data[i])) % kModAdler;
-    b = (b + a) % kModAdler;
+  uint32_t a = 1, b = 0;
+  for (int i = 0; i < length;) {
+    const int end = std::min(length, i + kMaxBlock);
+    for (; i < end; ++i) {
+      a += static_cast<uint8_t>(data[i]);
+      b += a;
+    }
+
+    a %= kModAdler;
+    b %= kModAdler;
   }
 
   return (b << 16) | a;
@@ -268,7 +518,7 @@ static constexpr uint32_t adler32(const char* data, const int length) noexcept
  *
  * **Algorithm:** Fletcher-16 (similar to Adler but different modulus)
  * **Modulus:** 255
- * **Performance:** O(n) where n = length (two sums with modulo)
+ * **Performance:** O(n) where n = length (one modulo per 4096 bytes)
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
@@ -277,15 +527,23 @@ static constexpr uint32_t adler32(const char* data, const int length) noexcept
  */
 static constexpr uint16_t fletcher16(const char* data, const int length) noexcept
 {
-  uint16_t sum1 = 0;
-  uint16_t sum2 = 0;
-
-  for (int i = 0; i < length; ++i) {
-    sum1 = (sum1 + static_cast<uint8_t>(data[i])) % 255;
-    sum2 = (sum2 + sum1) % 255;
+  // Keeps sum2 below 2^32 before the modulo, even from its largest residue
+  constexpr int kMaxBlock = 4096;
+
+  uint32_t sum1 = 0;
+  uint32_t sum2 = 0;
+  for (int i = 0; i < length;) {
+    const int end = std::min(length, i + kMaxBlock);
+    for (; i < end; ++i) {
+      sum1 += static_cast<uint8_t>(data[i]);
+      sum2 += sum1;
+    }
+
+    sum1 %= 255;
+    sum2 %= 255;
   }
 
-  return (sum2 << 8) | sum1;
+  return static_cast<uint16_t>((sum2 << 8) | sum1);
 }
 
 /**
@@ -296,7 +554,7 @@ static constexpr uint16_t fletcher16(const char* data, const int length) noexcep
  *
  * **Algorithm:** CRC-16-MODBUS (reflected polynomial)
  * **Polynomial:** 0x8005 (normal) / 0xA001 (reflected)
- * **Performance:** O(n × 8) where n = length (bit-by-bit computation)
+ * **Performance:** O(n) where n = length (slice-by-8 tables)
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
@@ -305,18 +563,7 @@ static constexpr uint16_t fletcher16(const char* data, const int length) noexcep
  */
 static constexpr uint16_t crc16_modbus(const char* data, const int length) noexcept
 {
-  uint16_t crc = 0xFFFF;
-
-  for (int i = 0; i < length; ++i) {
-    crc ^= static_cast<uint8_t>(data[i]);
-    for (int j = 0; j < 8; ++j)
-      if (crc & 0x0001)
-        crc = (crc >> 1) ^ 0xA001;
-      else
-        crc >>= 1;
-  }
-
-  return crc;
+  return crcUpdate<uint16_t, 0xA001, true>(0xFFFF, data, length);
 }
 
 /**
@@ -328,7 +575,7 @@ static constexpr uint16_t crc16_modbus(const char* data, const int length) noexc
  * **Algorithm:** CRC-16-CCITT (also known as CRC-16-KERMIT)
  * **Polynomial:** 0x1021
  * **Init Value:** 0x0000 (XModem variant)
- * **Performance:** O(n × 8) where n = length (bit-by-bit computation)
+ * **Performance:** O(n) where n = length (slice-by-8 tables)
  * **Thread Safety:** Pure function - safe for concurrent calls
  *
  * @param data Pointer to the input data array
@@ -337,18 +584,7 @@ static constexpr uint16_t crc16_modbus(const char* data, const int length) noexc
  */
 static constexpr uint16_t crc16_ccitt(const char* data, const int length) noexcept
 {
-  uint16_t crc = 0x0000;
-
-  for (int i = 0; i < length; ++i) {
-    crc ^= static_cast<uint8_t>(data[i]) << 8;
-    for (int j = 0; j < 8; ++j)
-      if (crc & 0x8000)
-        crc = (crc << 1) ^ 0x1021;
-      else
-        crc <<= 1;
-  }
-
-  return crc;
+  return crcUpdate<uint16_t, 0x1021, false>(0x0000, data, length);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -391,6 +627,11 @@ static QByteArray packU32BE(uint32_t v)
  * The list is derived directly from the internal checksum function map.
  * It reflects all available algorithms that can be passed to IO::checksum().
  *
+ * Console settings and the console.setChecksumMethod API address algorithms
+ * by their index in this list. Algorithms added after the original set are
+ * therefore appended at the end instead of being sorted in, so existing
+ * indexes keep selecting the same algorithm.
+ *
  * @return A reference to a static QStringList containing supported algorithm
  * names.
  */
@@ -398,9 +639,17 @@ const QStringList& IO::availableChecksums()
 {
   static QStringList list;
   if (list.isEmpty()) {
+    static const QStringList kAppended = {
+      QStringLiteral("CRC-16-CCITT-FALSE"),
+      QStringLiteral("CRC-32C"),
+    };
+
     const auto& map = checksumFunctionMap();
     for (auto it = map.begin(); it != map.end(); ++it)
-      list.append(it.key());
+      if (!kAppended.contains(it.key()))
+        list.append(it.key());
+
+    list.append(kAppended);
   }
 
   return list;
@@ -435,10 +684,12 @@ const QMap<QString, IO::ChecksumFunc>& IO::checksumFunctionMap()
     {QStringLiteral("CRC-16"),        [](const char* d, int l) { return packU16BE(crc16(d, l)); }},
     {QStringLiteral("CRC-16-MODBUS"), [](const char* d, int l) { return packU16LE(crc16_modbus(d, l)); }},
     {QStringLiteral("CRC-16-CCITT"),  [](const char* d, int l) { return packU16BE(crc16_ccitt(d, l)); }},
+    {QStringLiteral("CRC-16-CCITT-FALSE"), [](const char* d, int l) { return packU16BE(crc16(d, l)); }},
     {QStringLiteral("Fletcher-16"),   [](const char* d, int l) { return packU16BE(fletcher16(d, l)); }},
 
     // 32-bit checksums
     {QStringLiteral("CRC-32"),   [](const char* d, int l) { return packU32BE(crc32(d, l)); }},
+    {QStringLiteral("CRC-32C"),  [](const char* d, int l) { return packU32BE(crc32c(d, l)); }},
     {QStringLiteral("Adler-32"), [](const char* d, int l) { return packU32BE(adler32(d, l)); }},
   };
   // clang-format on
@@ -451,7 +702,8 @@ const QMap<QString, IO::ChecksumFunc>& IO::checksumFunctionMap()
  * specified algorithm.
  *
  * This function supports multiple standard algorithms including CRC-8,
- * CRC-16 (various variants), CRC-32, XOR-8, MOD-256, Adler-32, and Fletcher-16.
+ * CRC-16 (various variants), CRC-32, CRC-32C, XOR-8, MOD-256, Adler-32, and
+ * Fletcher-16.
  *
  * The algorithm name must match exactly one of the entries returned by
  * IO::availableChecksums(). The comparison is case-sensitive.
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <concepts>
+#include <functional>
 #include <QMap>
 #include <QStringList>
 
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 #include <QByteArray>
@@ -29,6 +30,50 @@
 #include "Concepts.h"
 
 namespace IO {
+/**
+ * @brief Resumable position of an incremental pattern search.
+ *
+ * Pattern searches over a streaming buffer are repeated every time new bytes
+ * arrive. Without a persisted position, a frame that trickles in over many
+ * small chunks is rescanned from the head on every call, which makes the
+ * total cost quadratic in the frame size. A ScanState remembers how far the
+ * previous search got and, for KMP, how many pattern bytes were already
+ * matched at that point, so each byte is examined once.
+ *
+ * **Invariant:** no match starts before `cursor - matched`, and the
+ * `matched` bytes right before `cursor` equal the pattern prefix of the same
+ * length. Offsets are logical (relative to the buffer head), so the owner
+ * must call consume() whenever it removes bytes from the head and reset()
+ * whenever the buffer is cleared or overwritten.
+ */
+struct ScanState {
+  qsizetype cursor  = 0;
+  qsizetype matched = 0;
+
+  /**
+   * @brief Forgets all progress; the next search starts from scratch.
+   */
+  void reset() noexcept
+  {
+    cursor  = 0;
+    matched = 0;
+  }
+
+  /**
+   * @brief Shifts the state after @p bytes were removed from the buffer head.
+   *
+   * If the removed range overlaps the partially matched prefix, the state
+   * is reset so the remaining bytes are rescanned.
+   */
+  void consume(qsizetype bytes) noexcept
+  {
+    if (cursor - matched >= bytes)
+      cursor -= bytes;
+    else
+      reset();
+  }
+};
+
 /**
  * @brief A lock-free circular buffer for high-throughput data streaming.
  *
@@ -47,7 +92,9 @@ namespace IO {
  *
  * **Performance:**
  * - O(1) append/read for small data
- * - O(n) for pattern search (KMP algorithm)
+ * - skip() and peekInto() avoid temporary allocations when extracting frames
+ * - O(n) for pattern search (memchr for short patterns, KMP otherwise)
+ * - Resumable searches via ScanState, so streamed data is scanned once
  * - Zero mutex overhead in hotpath
  *
  * @tparam T The type of elements exposed to the user (e.g., QByteArray).
@@ -73,10 +120,24 @@ public:
   [[nodiscard]] T peek(qsizetype size) const;
   [[nodiscard]] T peekRange(qsizetype offset, qsizetype size) const;
 
+  void skip(qsizetype size);
+  void peekInto(qsizetype offset, qsizetype size, T& out) const;
+
   [[nodiscard]] int findPatternKMP(const T& pattern, const int pos = 0);
   [[nodiscard]] int findPatternKMP(const T& pattern,
                                    const std::vector<int>& lps,
                                    const int pos = 0);
+  [[nodiscard]] int findPatternKMP(const T& pattern,
+                                   const std::vector<int>& lps,
+                                   ScanState& state,
+                                   const int pos = 0);
+
+  [[nodiscard]] int findPattern(const T& pattern,
+                                const std::vector<int>& lps,
+                                ScanState& state,
+                                const int pos = 0);
+
+  [[nodiscard]] int findFirstOf(const T& set, ScanState& state);
 
   [[nodiscard]] std::vector<int> buildKMPTable(const T& p) const { return computeKMPTable(p); }
 
@@ -87,7 +148,10 @@ public:
 
   void resetOverflowCount() noexcept { m_overflowCount.store(0, std::memory_order_relaxed); }
 
+  static constexpr qsizetype kShortPatternLength = 8;
+
 private:
+  [[nodiscard]] int findShortPattern(const T& pattern, ScanState& state, const int pos);
   [[nodiscard]] std::vector<int> computeKMPTable(const T& p) const;
 
 private:
@@ -295,6 +359,29 @@ T IO::CircularBuffer<T, StorageType>::read(qsizetype size)
   return result;
 }
 
+/**
+ * @brief Discards data from the head of the buffer without copying it.
+ *
+ * Equivalent to read() when the result is not needed, but only advances the
+ * head index instead of allocating and filling a temporary buffer.
+ *
+ * **Thread Safety:** SPSC safe - call only from consumer thread.
+ * **Performance:** O(1), lock-free.
+ *
+ * @param size The number of bytes to discard.
+ */
+template<typename T, Concepts::ByteLike StorageType>
+void IO::CircularBuffer<T, StorageType>::skip(qsizetype size)
+{
+  const qsizetype current_size = this->size();
+  Q_ASSERT(size >= 0 && size <= current_size);
+  if (size <= 0 || size > current_size) [[unlikely]]
+    return;
+
+  const qsizetype head = m_head.load(std::memory_order_relaxed);
+  m_head.store((head + size) % m_capacity, std::memory_order_release);
+}
+
 /**
  * @brief Retrieves data from the buffer without removing it.
  *
@@ -326,27 +413,50 @@ T IO::CircularBuffer<T, StorageType>::peek(qsizetype size) const
  */
 template<typename T, Concepts::ByteLike StorageType>
 T IO::CircularBuffer<T, StorageType>::peekRange(qsizetype offset, qsizetype size) const
+{
+  T result;
+  peekInto(offset, size, result);
+  return result;
+}
+
+/**
+ * @brief Copies data at the given logical offset into an existing container.
+ *
+ * Same as peekRange(), but writes into @p out so that callers can reuse a
+ * container whose storage is already allocated. Resizing a detached
+ * QByteArray within its capacity does not reallocate, which lets recycled
+ * frame buffers be refilled without touching the heap.
+ *
+ * **Thread Safety:** SPSC safe - call only from consumer thread.
+ * **Performance:** O(n) where n = size, no allocation if @p out has room.
+ *
+ * @param offset The logical offset from the head position.
+ * @param size The number of bytes to copy.
+ * @param out Destination container, resized to the number of bytes copied.
+ */
+template<typename T, Concepts::ByteLike StorageType>
+void IO::CircularBuffer<T, StorageType>::peekInto(qsizetype offset,
+                                                  qsizetype size,
+                                                  T& out) const
 {
   const qsizetype current_size = this->size();
-  if (offset >= current_size)
-    return T();
+  if (offset >= current_size) {
+    out.resize(0);
+    return;
+  }
 
   size = std::min(size, current_size - offset);
-
-  T result;
-  result.resize(size);
+  out.resize(size);
 
   const qsizetype head       = m_head.load(std::memory_order_acquire);
   const qsizetype start      = (head + offset) % m_capacity;
   const qsizetype firstChunk = std::min(size, m_capacity - start);
-  std::memcpy(result.data(), &m_buffer[start], firstChunk);
+  std::memcpy(out.data(), &m_buffer[start], firstChunk);
 
   if (size > firstChunk) [[unlikely]] {
     const qsizetype secondChunk = size - firstChunk;
-    std::memcpy(result.data() + firstChunk, &m_buffer[0], secondChunk);
+    std::memcpy(out.data() + firstChunk, &m_buffer[0], secondChunk);
   }
-
-  return result;
 }
 
 /**
@@ -414,6 +524,237 @@ int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T& pattern,
   return -1;
 }
 
+/**
+ * @brief Resumable variant of findPatternKMP().
+ *
+ * Continues the search where the previous call with the same @p state
+ * stopped instead of restarting at @p pos. When no match is found the state
+ * records the scanned length and the partial match, so the next call only
+ * examines bytes appended in between. When a match is found the state is
+ * parked on the match start, so repeating the search (e.g. while waiting for
+ * checksum bytes) returns the same index in O(m).
+ *
+ * **Thread Safety:** SPSC safe - call only from consumer thread.
+ * **Performance:** O(new bytes) amortized across calls.
+ *
+ * @param pattern The pattern to search for in the buffer.
+ * @param lps Precomputed KMP table for @p pattern (see buildKMPTable()).
+ * @param state Persisted search position, owned by the caller.
+ * @param pos Earliest logical offset at which a match may start.
+ *
+ * @return The logical index of the first match at or after @p pos, or -1.
+ */
+template<typename T, Concepts::ByteLike StorageType>
+int IO::CircularBuffer<T, StorageType>::findPatternKMP(const T& pattern,
+                                                       const std::vector<int>& lps,
+                                                       ScanState& state,
+                                                       const int pos)
+{
+  const qsizetype current_size = size();
+  const qsizetype m            = pattern.size();
+  if (m == 0) [[unlikely]]
+    return -1;
+
+  // Drop progress that could report a match before pos or past the data
+  if (state.cursor - state.matched < pos || state.cursor > current_size) [[unlikely]] {
+    state.cursor  = pos;
+    state.matched = 0;
+  }
+
+  const qsizetype head = m_head.load(std::memory_order_acquire);
+  qsizetype bufferIdx  = (head + state.cursor) % m_capacity;
+  qsizetype i          = state.cursor;
+  qsizetype j          = state.matched;
+
+  while (i < current_size) {
+    if (m_buffer[bufferIdx] == pattern[j]) {
+      ++i;
+      ++j;
+      if (++bufferIdx == m_capacity) [[unlikely]]
+        bufferIdx = 0;
+
+      if (j == m) [[unlikely]] {
+        state.cursor  = i - j;
+        state.matched = 0;
+        return static_cast<int>(i - j);
+      }
+    }
+
+    else if (j != 0) [[likely]]
+      j = lps[j - 1];
+
+    else {
+      ++i;
+      if (++bufferIdx == m_capacity) [[unlikely]]
+        bufferIdx = 0;
+    }
+  }
+
+  state.cursor  = i;
+  state.matched = j;
+  return -1;
+}
+
+/**
+ * @brief Resumable pattern search that picks the fastest algorithm.
+ *
+ * Patterns of up to kShortPatternLength bytes (the usual "\n", ";" or "\r\n"
+ * frame delimiters) are located with findShortPattern(), which lets memchr()
+ * skip to candidate positions. Longer patterns use the KMP search, whose
+ * worst case stays linear regardless of the data.
+ *
+ * **Thread Safety:** SPSC safe - call only from consumer thread.
+ *
+ * @param pattern The pattern to search for in the buffer.
+ * @param lps Precomputed KMP table for @p pattern, used for long patterns.
+ * @param state Persisted search position, owned by the caller.
+ * @param pos Earliest logical offset at which a match may start.
+ *
+ * @return The logical index of the first match at or after @p pos, or -1.
+ */
+template<typename T, Concepts::ByteLike StorageType>
+int IO::CircularBuffer<T, StorageType>::findPattern(const T& pattern,
+                                                    const std::vector<int>& lps,
+                                                    ScanState& state,
+                                                    const int pos)
+{
+  if (pattern.size() <= kShortPatternLength) [[likely]]
+    return findShortPattern(pattern, state, pos);
+
+  return findPatternKMP(pattern, lps, state, pos);
+}
+
+/**
+ * @brief Resumable search for short patterns using memchr().
+ *
+ * Each contiguous span of the ring is scanned with memchr() for the first
+ * pattern byte, and every candidate is verified against the remaining bytes.
+ * The state never carries a partial match: when nothing is found the cursor
+ * is parked at the last offset where a match could still complete once more
+ * data arrives.
+ *
+ * **Thread Safety:** SPSC safe - call only from consumer thread.
+ * **Performance:** O(new bytes) with vectorized skipping; verification is
+ * bounded by kShortPatternLength per candidate.
+ *
+ * @param pattern The pattern to search for in the buffer.
+ * @param state Persisted search position, owned by the caller.
+ * @param pos Earliest logical offset at which a match may start.
+ *
+ * @return The logical index of the first match at or after @p pos, or -1.
+ */
+template<typename T, Concepts::ByteLike StorageType>
+int IO::CircularBuffer<T, StorageType>::findShortPattern(const T& pattern,
+                                                         ScanState& state,
+                                                         const int pos)
+{
+  const qsizetype current_size = size();
+  const qsizetype m            = pattern.size();
+  if (m == 0) [[unlikely]]
+    return -1;
+
+  // Drop progress that could report a match before pos or past the data
+  if (state.cursor - state.matched < pos || state.cursor > current_size) [[unlikely]]
+    state.cursor = pos;
+
+  const auto first     = static_cast<unsigned char>(pattern[0]);
+  const qsizetype head = m_head.load(std::memory_order_acquire);
+  const qsizetype last = current_size - m;
+
+  qsizetype i = state.cursor - state.matched;
+  while (i <= last) {
+    // Find the next candidate within the contiguous span starting at i
+    const qsizetype start = (head + i) % m_capacity;
+    const qsizetype span  = std::min(last - i + 1, m_capacity - start);
+    const StorageType* p  = &m_buffer[start];
+    const auto* hit       = std::memchr(p, first, span);
+    if (!hit) {
+      i += span;
+      continue;
+    }
+
+    // Verify the rest of the pattern, which may wrap around the ring
+    const qsizetype candidate = i + (static_cast<const StorageType*>(hit) - p);
+    qsizetype idx             = (head + candidate + 1) % m_capacity;
+    qsizetype j               = 1;
+    for (; j < m; ++j) {
+      if (m_buffer[idx] != static_cast<StorageType>(pattern[j]))
+        break;
+
+      if (++idx == m_capacity) [[unlikely]]
+        idx = 0;
+    }
+
+    if (j == m) {
+      state.cursor  = candidate;
+      state.matched = 0;
+      return static_cast<int>(candidate);
+    }
+
+    i = candidate + 1;
+  }
+
+  state.cursor  = i;
+  state.matched = 0;
+  return -1;
+}
+
+/**
+ * @brief Finds the first byte that belongs to @p set, resuming from @p state.
+ *
+ * Used to search several single-byte delimiters (e.g. CR and LF) in one pass
+ * over the data instead of running one pattern search per delimiter. The
+ * ring is walked as its two contiguous spans and each span is searched with
+ * memchr(), which the C library vectorizes.
+ *
+ * **Thread Safety:** SPSC safe - call only from consumer thread.
+ * **Performance:** O(new bytes × set size) amortized across calls.
+ *
+ * @param set The candidate bytes.
+ * @param state Persisted search position, owned by the caller.
+ * @return Logical index of the first matching byte, or -1 if none.
+ */
+template<typename T, Concepts::ByteLike StorageType>
+int IO::CircularBuffer<T, StorageType>::findFirstOf(const T& set, ScanState& state)
+{
+  const qsizetype current_size = size();
+  if (set.isEmpty()) [[unlikely]]
+    return -1;
+
+  if (state.cursor > current_size) [[unlikely]]
+    state.reset();
+
+  const qsizetype head = m_head.load(std::memory_order_acquire);
+
+  qsizetype i = state.cursor;
+  while (i < current_size) {
+    // Walk the contiguous span that starts at logical offset i
+    const qsizetype start = (head + i) % m_capacity;
+    const qsizetype span  = std::min(current_size - i, m_capacity - start);
+    const StorageType* p  = &m_buffer[start];
+
+    // One memchr per candidate, each bounded by the earliest hit so far
+    qsizetype limit = span;
+    for (const auto c : set) {
+      const auto* hit = std::memchr(p, static_cast<unsigned char>(c), limit);
+      if (hit)
+        limit = static_cast<const StorageType*>(hit) - p;
+    }
+
+    if (limit < span) {
+      state.cursor  = i + limit;
+      state.matched = 0;
+      return static_cast<int>(i + limit);
+    }
+
+    i += span;
+  }
+
+  state.cursor  = current_size;
+  state.matched = 0;
+  return -1;
+}
+
 /**
  * @brief Computes the KMP table for a given p.
  *
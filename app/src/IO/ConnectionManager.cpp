@@ -504,8 +504,8 @@ void IO::ConnectionManager::setUiDriverProperty(const QString& key, const QVaria
 /**
  * @brief Feeds a pre-built payload directly into the frame processing pipeline.
  *
- * Used by file playback (CSV, MDF4) and MQTT to inject frames without going
- * through a physical driver. Forwards to Console, API server, and FrameBuilder.
+ * Used by MQTT to inject frames without going through a physical driver.
+ * Forwards to Console, API server, and FrameBuilder.
  *
  * @param payload The raw frame bytes to process.
  */
@@ -516,66 +516,40 @@ void IO::ConnectionManager::processPayload(const QByteArray& payload)
   if (payload.isEmpty())
     return;
 
-  // Forward to console, API server, and frame builder
-  static auto& console      = Console::Handler::instance();
-  static auto& server       = API::Server::instance();
   static auto& frameBuilder = DataModel::FrameBuilder::instance();
 
-  const auto data = makeByteArray(payload);
-  server.hotpathTxData(data);
-  console.hotpathRxData(data);
+  echoPayload(payload);
   frameBuilder.hotpathRxFrame(payload);
-
-#ifdef BUILD_COMMERCIAL
-  static auto& mqtt = MQTT::Client::instance();
-  mqtt.hotpathTxFrame(payload);
-#endif
-
-#ifdef ENABLE_GRPC
-  static auto& grpcServer = API::GRPC::GRPCServer::instance();
-  grpcServer.hotpathTxData(data);
-#endif
 }
 
 /**
- * @brief Injects per-source payloads for multi-source playback.
+ * @brief Forwards a pre-built payload to the raw-data consumers only.
  *
- * Sends the full payload to console and API (for display), then routes
- * each source's sub-payload through FrameBuilder's per-source path.
+ * Used by file playback, which hands typed values straight to FrameBuilder
+ * and only needs the text form for the console, API server, MQTT and gRPC.
  *
- * @param fullPayload Complete CSV row for console/API display.
- * @param sourcePayloads Map of sourceId → per-source CSV sub-row.
+ * @param payload The raw frame bytes to display and publish.
  */
-void IO::ConnectionManager::processMultiSourcePayload(const QByteArray& fullPayload,
-                                                      const QMap<int, QByteArray>& sourcePayloads)
+void IO::ConnectionManager::echoPayload(const QByteArray& payload)
 {
-  Q_ASSERT(!fullPayload.isEmpty());
-  Q_ASSERT(!sourcePayloads.isEmpty());
+  Q_ASSERT(!payload.isEmpty());
 
-  if (fullPayload.isEmpty())
+  if (payload.isEmpty())
     return;
 
-  // Cache singleton references for the hotpath
-  static auto& console      = Console::Handler::instance();
-  static auto& server       = API::Server::instance();
-  static auto& frameBuilder = DataModel::FrameBuilder::instance();
+  // Forward to console and API server
+  static auto& console = Console::Handler::instance();
+  static auto& server  = API::Server::instance();
 
-  // Console and API get the full payload for display
-  const auto data = makeByteArray(fullPayload);
+  const auto data = makeByteArray(payload);
   server.hotpathTxData(data);
   console.hotpathRxData(data);
 
-  // Route each source's data through per-source frame building
-  for (auto it = sourcePayloads.constBegin(); it != sourcePayloads.constEnd(); ++it)
-    frameBuilder.hotpathRxSourceFrame(it.key(), it.value());
-
-// Route data to MQTT
 #ifdef BUILD_COMMERCIAL
   static auto& mqtt = MQTT::Client::instance();
-  mqtt.hotpathTxFrame(fullPayload);
+  mqtt.hotpathTxFrame(payload);
 #endif
 
-// Route data to GRPC
 #ifdef ENABLE_GRPC
   static auto& grpcServer = API::GRPC::GRPCServer::instance();
   grpcServer.hotpathTxData(data);
@@ -946,7 +920,8 @@ void IO::ConnectionManager::setBusType(SerialStudio::BusType type)
     HAL_Driver* uiDriver = activeUiDriver();
     if (uiDriver)
       for (const auto& prop : uiDriver->driverProperties())
-        driver->setDriverProperty(prop.key, prop.value);
+        if (!prop.readOnly)
+          driver->setDriverProperty(prop.key, prop.value);
 
     // Re-evaluate configurationOk when the live driver changes
     connect(driver.get(),
@@ -1030,7 +1005,8 @@ void IO::ConnectionManager::syncUiDriverToLive()
     return;
 
   for (const auto& prop : uiDriver->driverProperties())
-    liveDriver->setDriverProperty(prop.key, prop.value);
+    if (!prop.readOnly)
+      liveDriver->setDriverProperty(prop.key, prop.value);
 }
 
 /**
@@ -1085,15 +1061,14 @@ void IO::ConnectionManager::wireDevice(DeviceManager* dm)
   Q_ASSERT(dm->driver());
 
   // DirectConnection — both DeviceManager and ConnectionManager live on
-  // the main thread, and FrameReader is no longer moved to a worker
-  // thread (see beeda4c0). A QueuedConnection between two same-thread
-  // objects only adds per-frame postEvent overhead: QMetaCallEvent
-  // alloc + event-queue lock + deferred dispatch. At high frame rates
-  // that extra work lets the FrameReader's lock-free queue fill faster
-  // than the consumer drains it, triggering "queue full" drops.
-  // Direct calls drain the whole batch in one pass on the caller's
-  // stack, and re-entrancy is not a concern because the frame path
-  // never re-triggers the driver's readyRead.
+  // the main thread. The FrameReader runs on the DeviceManager's ingest
+  // thread, but frames cross back through its SPSC queue and frameReady()
+  // is emitted from DeviceManager::onReadyRead() on the main thread. A
+  // QueuedConnection between two same-thread objects only adds per-frame
+  // postEvent overhead: QMetaCallEvent alloc + event-queue lock + deferred
+  // dispatch. Direct calls drain the whole batch in one pass on the
+  // caller's stack, and re-entrancy is not a concern because the frame
+  // path never re-triggers the driver's readyRead.
   connect(dm,
           &IO::DeviceManager::frameReady,
           this,
@@ -1143,7 +1118,8 @@ void IO::ConnectionManager::onUiDriverConfigurationChanged()
   // Snapshot driver properties into a JSON object
   QJsonObject settings;
   for (const auto& prop : uiDriver->driverProperties())
-    settings.insert(prop.key, QJsonValue::fromVariant(prop.value));
+    if (!prop.readOnly)
+      settings.insert(prop.key, QJsonValue::fromVariant(prop.value));
 
   // Append stable hardware identifiers for cross-platform device matching
   const auto deviceId = uiDriver->deviceIdentifier();
@@ -146,6 +146,7 @@ public:
   [[nodiscard]] const QByteArray& startSequence() const noexcept;
   [[nodiscard]] const QByteArray& finishSequence() const noexcept;
   [[nodiscard]] const QString& checksumAlgorithm() const noexcept;
+  [[nodiscard]] FrameConfig buildFrameConfig(int deviceId) const;
 
   // Bus type names for QML combo box
   [[nodiscard]] QStringList availableBuses() const;
@@ -198,8 +199,7 @@ public slots:
   void processPayload(const QByteArray& payload);
 
   // Data processing
-  void processMultiSourcePayload(const QByteArray& fullPayload,
-                                 const QMap<int, QByteArray>& sourcePayloads);
+  void echoPayload(const QByteArray& payload);
 
 private slots:
   void rebuildDevices();
@@ -214,7 +214,6 @@ private:
   void wireUiDriver(IO::HAL_Driver* driver);
 
   [[nodiscard]] bool projectConfigurationOk() const;
-  [[nodiscard]] FrameConfig buildFrameConfig(int deviceId) const;
   [[nodiscard]] std::unique_ptr<HAL_Driver> createDriver(SerialStudio::BusType type) const;
 
 private:
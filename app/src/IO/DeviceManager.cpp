@@ -29,10 +29,12 @@
  * @brief Constructs a DeviceManager that owns the given driver.
  *
  * Takes ownership of @p driver, stores the initial @p config, and connects the
- * driver's dataReceived() signal so raw bytes are forwarded to consumers.
+ * driver's dataReceived() and datagramsReceived() signals so raw bytes are
+ * forwarded to consumers.
  *
- * The FrameReader is created immediately and will be recreated each time
- * open() is called after a close().
+ * The per-device ingest thread is started here and lives as long as the
+ * DeviceManager. The FrameReader is created immediately and will be recreated
+ * each time open() is called after a close().
  *
  * @param deviceId Opaque identifier for this device (matches ProjectModel sourceId).
  * @param driver   Unique ownership of the HAL driver instance.
@@ -48,20 +50,33 @@ IO::DeviceManager::DeviceManager(int deviceId,
   Q_ASSERT(m_driver);
   Q_ASSERT(deviceId >= 0);
 
-  m_frameScratch.reserve(4096);
+  m_ingestThread.setObjectName(QStringLiteral("FrameReader #%1").arg(deviceId));
+  m_ingestThread.start(QThread::HighPriority);
 
   connect(
     m_driver.get(), &IO::HAL_Driver::dataReceived, this, &IO::DeviceManager::onRawDataReceived);
+  connect(m_driver.get(),
+          &IO::HAL_Driver::datagramsReceived,
+          this,
+          &IO::DeviceManager::onRawDatagramsReceived);
 
   startFrameReader(config);
 }
 
 /**
- * @brief Destructs the DeviceManager, closing the driver.
+ * @brief Destructs the DeviceManager, closing the driver and joining the
+ *        ingest thread.
+ *
+ * close() schedules the FrameReader for deletion on the ingest thread; Qt
+ * runs pending deferred deletes when the thread's event loop exits, so the
+ * reader is destroyed before wait() returns.
  */
 IO::DeviceManager::~DeviceManager()
 {
   close();
+
+  m_ingestThread.quit();
+  m_ingestThread.wait();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -185,6 +200,11 @@ void IO::DeviceManager::reconfigure(const FrameConfig& config)
 
 /**
  * @brief Dequeues all available frames from the FrameReader and emits frameReady().
+ *
+ * Runs on the main thread as the consumer side of the FrameReader's SPSC
+ * queue. The readyRead() notification is acknowledged before draining so
+ * that frames enqueued by the ingest thread while we drain re-arm it. Each
+ * frame buffer is handed back to the FrameReader once consumers returned.
  */
 void IO::DeviceManager::onReadyRead()
 {
@@ -193,9 +213,13 @@ void IO::DeviceManager::onReadyRead()
   if (!m_frameReader)
     return;
 
+  m_frameReader->acknowledgeReadyRead();
+
   auto& queue = m_frameReader->queue();
-  while (queue.try_dequeue(m_frameScratch))
+  while (queue.try_dequeue(m_frameScratch)) {
     Q_EMIT frameReady(m_deviceId, m_frameScratch);
+    m_frameReader->recycleFrame(m_frameScratch);
+  }
 }
 
 /**
@@ -207,6 +231,22 @@ void IO::DeviceManager::onRawDataReceived(const IO::ByteArrayPtr& data)
   Q_EMIT rawDataReceived(m_deviceId, data);
 }
 
+/**
+ * @brief Forwards a batch of raw datagrams to consumers via rawDataReceived().
+ *
+ * Consumers see the concatenated payloads. They get a copy of the used bytes
+ * rather than a share of the batch's slab: raw consumers may keep the bytes
+ * long after the driver wants to refill the batch, and a shared slab would be
+ * reallocated in full on the next refill.
+ *
+ * @param batch Incoming datagrams from the driver.
+ */
+void IO::DeviceManager::onRawDatagramsReceived(const IO::DatagramBatchPtr& batch)
+{
+  if (batch && !batch->data.isEmpty())
+    Q_EMIT rawDataReceived(m_deviceId, makeByteArray(batch->payload()));
+}
+
 //--------------------------------------------------------------------------------------------------
 // Private helpers
 //--------------------------------------------------------------------------------------------------
@@ -214,9 +254,12 @@ void IO::DeviceManager::onRawDataReceived(const IO::ByteArrayPtr& data)
 /**
  * @brief Creates and starts a new FrameReader configured with @p config.
  *
- * Uses AutoConnection so that Qt picks DirectConnection when sender and
- * receiver share a thread (zero-copy) and QueuedConnection when they
- * don't (e.g. HID/USB drivers that emit from their own read threads).
+ * The reader is fully configured on the main thread and only then moved to
+ * the ingest thread, which keeps the "configure once, never mutate" model
+ * described in FrameReader. Driver data reaches processData() and
+ * processDatagrams() through queued connections (the payloads are shared
+ * pointers, so the hop does not copy bytes), and readyRead() is delivered
+ * back to the main thread queued.
  *
  * @param config FrameReader parameters to apply.
  */
@@ -239,23 +282,44 @@ void IO::DeviceManager::startFrameReader(const FrameConfig& config)
   m_frameReader->setFinishSequence(config.finishSequence);
   m_frameReader->setOperationMode(config.operationMode);
   m_frameReader->setFrameDetectionMode(config.frameDetection);
-
-  connect(
-    m_driver.get(), &IO::HAL_Driver::dataReceived, m_frameReader, &IO::FrameReader::processData);
-
-  connect(m_frameReader, &IO::FrameReader::readyRead, this, &IO::DeviceManager::onReadyRead);
+  m_frameReader->moveToThread(&m_ingestThread);
+
+  connect(m_driver.get(),
+          &IO::HAL_Driver::dataReceived,
+          m_frameReader,
+          &IO::FrameReader::processData,
+          Qt::QueuedConnection);
+
+  connect(m_driver.get(),
+          &IO::HAL_Driver::datagramsReceived,
+          m_frameReader,
+          &IO::FrameReader::processDatagrams,
+          Qt::QueuedConnection);
+
+  connect(m_frameReader,
+          &IO::FrameReader::readyRead,
+          this,
+          &IO::DeviceManager::onReadyRead,
+          Qt::QueuedConnection);
 }
 
 /**
  * @brief Stops and destroys the FrameReader.
+ *
+ * The reader is disconnected first so no new chunks are queued to it, then
+ * deleted on its own thread. Chunks already posted to the ingest thread are
+ * discarded together with the object, matching the previous behaviour of
+ * dropping stale buffered data on close/reconfigure.
  */
 void IO::DeviceManager::killFrameReader()
 {
   if (m_frameReader.isNull())
     return;
 
-  if (m_driver)
+  if (m_driver) {
     disconnect(m_driver.get(), &IO::HAL_Driver::dataReceived, m_frameReader, nullptr);
+    disconnect(m_driver.get(), &IO::HAL_Driver::datagramsReceived, m_frameReader, nullptr);
+  }
 
   m_frameReader->deleteLater();
   m_frameReader.clear();
@@ -24,6 +24,7 @@
 #include <memory>
 #include <QObject>
 #include <QPointer>
+#include <QThread>
 
 #include "IO/FrameConfig.h"
 #include "IO/FrameReader.h"
@@ -38,9 +39,14 @@ namespace IO {
  * it owns the driver, configures and runs the FrameReader, and emits
  * frameReady() / rawDataReceived() for consumers.
  *
- * The FrameReader runs on the main thread (no worker QThread). HAL_Driver
- * implementations may emit dataReceived() from their own read thread; the
- * AutoConnection on FrameReader::processData resolves that correctly.
+ * The FrameReader runs on a dedicated ingest QThread owned by this class, so
+ * delimiting and checksum validation are independent of the GUI event loop.
+ * HAL_Driver implementations emit dataReceived() or datagramsReceived() from
+ * the main thread or from their own read thread; either way the connections
+ * to FrameReader::processData and FrameReader::processDatagrams are a queued
+ * hop onto the ingest thread. Extracted
+ * frames come back through the FrameReader's SPSC queue and are drained on
+ * the main thread in onReadyRead().
  *
  * Drivers must NEVER be singletons for connection purposes — each DeviceManager
  * holds an independent driver instance. Driver singletons (e.g. UART::instance())
@@ -81,6 +87,7 @@ public slots:
 private slots:
   void onReadyRead();
   void onRawDataReceived(const IO::ByteArrayPtr& data);
+  void onRawDatagramsReceived(const IO::DatagramBatchPtr& batch);
 
 private:
   void startFrameReader(const FrameConfig& config);
@@ -90,6 +97,7 @@ private:
   int m_deviceId;
   FrameConfig m_frameConfig;
   std::unique_ptr<HAL_Driver> m_driver;
+  QThread m_ingestThread;
   QPointer<FrameReader> m_frameReader;
   QByteArray m_frameScratch;
 };
@@ -21,9 +21,30 @@
 
 #include "IO/Drivers/Network.h"
 
+#include <cstring>
+#include <QMetaObject>
+
 #include "IO/ConnectionManager.h"
 #include "Misc/Utilities.h"
 
+#ifdef Q_OS_LINUX
+#  include <cerrno>
+#  include <poll.h>
+
+#  include <sys/socket.h>
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------
+
+constexpr int kBatchDatagrams  = 64;
+constexpr int kBatchPoolSize   = 8;
+constexpr int kDatagramSlot    = 9216;
+constexpr int kMaxDatagramSlot = 65536;
+constexpr int kReadTimeoutMs   = 100;
+constexpr int kMaxDatagramRead = 256;
+
 //--------------------------------------------------------------------------------------------------
 // Constructor & singleton access functions
 //--------------------------------------------------------------------------------------------------
@@ -31,7 +52,13 @@
 /**
  * Constructor function
  */
-IO::Drivers::Network::Network() : m_hostExists(false), m_udpMulticast(false), m_lookupActive(false)
+IO::Drivers::Network::Network()
+  : m_hostExists(false)
+  , m_udpMulticast(false)
+  , m_lookupActive(false)
+  , m_udpDescriptor(-1)
+  , m_running(false)
+  , m_udpDatagramFrames(false)
 {
   // Restore persisted settings
   // clang-format off
@@ -39,6 +66,7 @@ IO::Drivers::Network::Network() : m_hostExists(false), m_udpMulticast(false), m_
   auto remoteAddress = m_settings.value("NetworkDriver/address", "").toString();
   auto tcpPort = m_settings.value("NetworkDriver/tcpPort", defaultTcpPort()).toInt();
   auto udpMulticastEnabled = m_settings.value("NetworkDriver/udpMulticastEnabled", false).toBool();
+  auto udpDatagramFrames = m_settings.value("NetworkDriver/udpDatagramFrames", false).toBool();
   auto udpLocalPort = m_settings.value("NetworkDriver/udpLocalPort", defaultUdpLocalPort()).toInt();
   auto udpRemotePort = m_settings.value("NetworkDriver/udpRemotePort", defaultUdpRemotePort()).toInt();
   // clang-format on
@@ -49,6 +77,7 @@ IO::Drivers::Network::Network() : m_hostExists(false), m_udpMulticast(false), m_
   setUdpRemotePort(udpRemotePort);
   setRemoteAddress(remoteAddress);
   setUdpMulticast(udpMulticastEnabled);
+  setUdpDatagramFrames(udpDatagramFrames);
   setSocketType(static_cast<QAbstractSocket::SocketType>(socketType));
 
   // Propagate configuration changes
@@ -70,6 +99,17 @@ IO::Drivers::Network::Network() : m_hostExists(false), m_udpMulticast(false), m_
   // Handle socket errors
   connect(&m_tcpSocket, &QTcpSocket::errorOccurred, this, &IO::Drivers::Network::onErrorOccurred);
   connect(&m_udpSocket, &QUdpSocket::errorOccurred, this, &IO::Drivers::Network::onErrorOccurred);
+
+  // Drain UDP datagrams on the read thread
+  connect(&m_readThread, &QThread::started, this, &Network::readLoop, Qt::DirectConnection);
+}
+
+/**
+ * Destructor function, stops the UDP read thread before the sockets go away.
+ */
+IO::Drivers::Network::~Network()
+{
+  stopReadThread();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -82,6 +122,9 @@ IO::Drivers::Network::Network() : m_hostExists(false), m_udpMulticast(false), m_
  */
 void IO::Drivers::Network::close()
 {
+  // Stop reading datagrams before the socket descriptor is released
+  stopReadThread();
+
   // Disconnect data-ready signals
   if (socketType() == QAbstractSocket::TcpSocket)
     disconnect(&m_tcpSocket, &QTcpSocket::readyRead, this, &IO::Drivers::Network::onReadyRead);
@@ -95,6 +138,9 @@ void IO::Drivers::Network::close()
   m_udpSocket.close();
   m_tcpSocket.disconnectFromHost();
   m_udpSocket.disconnectFromHost();
+
+  // Release the datagram slabs
+  m_batchPool.clear();
 }
 
 /**
@@ -184,6 +230,10 @@ qint64 IO::Drivers::Network::write(const QByteArray& data)
  * type (TCP or UDP). For TCP, it connects to the remote host, while for UDP,
  * it binds to the specified local port and joins a multicast group if required.
  *
+ * On Linux, UDP datagrams are read by m_readThread with recvmmsg() instead of
+ * through QUdpSocket::readyRead(). QUdpSocket still owns the descriptor, so
+ * binding, multicast membership and writes work as before.
+ *
  * @param mode The mode in which to open the network connection.
  * @return `true` if the connection is successfully opened, `false` otherwise.
  */
@@ -219,6 +269,15 @@ bool IO::Drivers::Network::open(const QIODevice::OpenMode mode)
   // Open the socket and connect readyRead
   if (socket) {
     if (socket->open(mode)) {
+#ifdef Q_OS_LINUX
+      if (socket == &m_udpSocket && m_udpSocket.socketDescriptor() >= 0) {
+        m_udpDescriptor = m_udpSocket.socketDescriptor();
+        m_running       = true;
+        m_readThread.start();
+        return true;
+      }
+#endif
+
       connect(socket, &QIODevice::readyRead, this, &IO::Drivers::Network::onReadyRead);
       return true;
     }
@@ -266,6 +325,15 @@ bool IO::Drivers::Network::udpMulticast() const
   return m_udpMulticast;
 }
 
+/**
+ * Returns @c true if every UDP datagram is treated as exactly one frame, which
+ * lets the frame reader skip delimiter scanning.
+ */
+bool IO::Drivers::Network::udpDatagramFrames() const
+{
+  return m_udpDatagramFrames.load(std::memory_order_relaxed);
+}
+
 /**
  * Returns @c true if we are currently performing a DNS lookup
  */
@@ -424,6 +492,19 @@ void IO::Drivers::Network::setUdpMulticast(const bool enabled)
   Q_EMIT udpMulticastChanged();
 }
 
+/**
+ * Enables/Disables treating UDP datagram boundaries as frame boundaries.
+ */
+void IO::Drivers::Network::setUdpDatagramFrames(const bool enabled)
+{
+  if (udpDatagramFrames() == enabled)
+    return;
+
+  m_udpDatagramFrames.store(enabled, std::memory_order_relaxed);
+  m_settings.setValue("NetworkDriver/udpDatagramFrames", enabled);
+  Q_EMIT udpDatagramFramesChanged();
+}
+
 /**
  * Changes the current socket type given an index of the list returned by the
  * @c socketType() function.
@@ -461,17 +542,31 @@ void IO::Drivers::Network::setSocketType(const QAbstractSocket::SocketType type)
 
 /**
  * Reads incoming data from the UDP/TCP ports
+ *
+ * Pending UDP datagrams are packed into a single batch, so the frame reader
+ * receives one signal per wakeup instead of one per datagram.
  */
 void IO::Drivers::Network::onReadyRead()
 {
   // Read from UDP socket (bounded to prevent event loop starvation)
   if (socketType() == QAbstractSocket::UdpSocket) {
-    constexpr int kMaxDatagramsPerRead = 256;
-    for (int n = 0; n < kMaxDatagramsPerRead && udpSocket()->hasPendingDatagrams(); ++n) {
+    auto batch = acquireBatch();
+    auto& data = batch->data;
+    for (int n = 0; n < kMaxDatagramRead && udpSocket()->hasPendingDatagrams(); ++n) {
       const qint64 size = udpSocket()->pendingDatagramSize();
-      m_udpBuffer.resize(size);
-      udpSocket()->readDatagram(m_udpBuffer.data(), m_udpBuffer.size());
-      Q_EMIT dataReceived(makeByteArray(m_udpBuffer));
+      if (size < 0)
+        break;
+
+      const auto offset = data.size();
+      data.resize(offset + size);
+      const auto read = udpSocket()->readDatagram(data.data() + offset, size);
+      data.resize(offset + qMax<qint64>(read, 0));
+      batch->ends.push_back(data.size());
+    }
+
+    if (!batch->ends.empty()) {
+      batch->framed = udpDatagramFrames();
+      Q_EMIT datagramsReceived(batch);
     }
   }
 
@@ -480,6 +575,20 @@ void IO::Drivers::Network::onReadyRead()
     Q_EMIT dataReceived(makeByteArray(tcpSocket()->readAll()));
 }
 
+/**
+ * @brief Handles a fatal read error from the UDP read thread.
+ *
+ * Called on the main thread (via QueuedConnection from readLoop). Closes the
+ * connection and notifies the user.
+ */
+void IO::Drivers::Network::onReadError()
+{
+  ConnectionManager::instance().disconnectDevice();
+  Misc::Utilities::showMessageBox(tr("Network socket error"),
+                                  tr("Failed to read from the UDP socket."),
+                                  QMessageBox::Critical);
+}
+
 /**
  * Sets the host IP address when the lookup finishes.
  * If the lookup fails, the error code/string shall be shown to the user in a
@@ -587,6 +696,13 @@ QList<IO::DriverProperty> IO::Drivers::Network::driverProperties() const
     multicast.type  = IO::DriverProperty::CheckBox;
     multicast.value = m_udpMulticast;
     props.append(multicast);
+
+    IO::DriverProperty datagramFrames;
+    datagramFrames.key   = QStringLiteral("udpDatagramFrames");
+    datagramFrames.label = tr("Frame per Datagram");
+    datagramFrames.type  = IO::DriverProperty::CheckBox;
+    datagramFrames.value = udpDatagramFrames();
+    props.append(datagramFrames);
   }
 
   return props;
@@ -616,4 +732,170 @@ void IO::Drivers::Network::setDriverProperty(const QString& key, const QVariant&
 
   else if (key == QLatin1String("udpMulticast"))
     setUdpMulticast(value.toBool());
+
+  else if (key == QLatin1String("udpDatagramFrames"))
+    setUdpDatagramFrames(value.toBool());
+}
+
+//--------------------------------------------------------------------------------------------------
+// Private: datagram batching
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns an empty datagram batch, reusing a pooled one when possible.
+ *
+ * A pooled batch can be refilled once every consumer has released it, which
+ * keeps its slab allocation alive across wakeups. When all pooled batches are
+ * still in flight (e.g. the frame reader is backlogged), a new batch is
+ * allocated, and only kept if the pool has room for it.
+ *
+ * **Thread Safety:** Call only from the thread that reads the socket.
+ */
+std::shared_ptr<IO::DatagramBatch> IO::Drivers::Network::acquireBatch()
+{
+  for (const auto& batch : m_batchPool) {
+    if (batch.use_count() == 1) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      batch->data.resize(0);
+      batch->ends.clear();
+      return batch;
+    }
+  }
+
+  auto batch = std::make_shared<IO::DatagramBatch>();
+  if (m_batchPool.size() < kBatchPoolSize)
+    m_batchPool.push_back(batch);
+
+  return batch;
+}
+
+/**
+ * @brief Stops the UDP read thread, if running, and waits for it to exit.
+ */
+void IO::Drivers::Network::stopReadThread()
+{
+  m_running = false;
+
+  if (m_readThread.isRunning()) {
+    m_readThread.quit();
+    m_readThread.wait();
+  }
+
+  m_udpDescriptor = -1;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Private: read loop (runs on m_readThread)
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief UDP read loop executed on m_readThread (Linux only).
+ *
+ * Waits for the socket with a 100 ms timeout so the loop can check m_running
+ * periodically, then drains it with recvmmsg(). Every call receives up to
+ * kBatchDatagrams datagrams into fixed slots of a pooled slab; the payloads
+ * are then packed back to back and the batch is emitted as a whole.
+ *
+ * The slots start at kDatagramSlot bytes, enough for a jumbo Ethernet frame,
+ * which keeps a slab well below a megabyte. A datagram that does not fit is
+ * dropped, and the slots grow to hold it (up to kMaxDatagramSlot), so only
+ * the first oversized datagram of a stream is lost.
+ *
+ * QUdpSocket keeps its read notifier on the main thread, but since nothing is
+ * connected to readyRead() it disables itself after the first wakeup without
+ * reading from the descriptor. On a fatal error the main thread is notified
+ * via a queued invocation of onReadError().
+ */
+void IO::Drivers::Network::readLoop()
+{
+#ifdef Q_OS_LINUX
+  mmsghdr headers[kBatchDatagrams];
+  iovec vectors[kBatchDatagrams];
+
+  pollfd pfd{};
+  pfd.fd     = static_cast<int>(m_udpDescriptor);
+  pfd.events = POLLIN;
+
+  bool failed        = false;
+  qsizetype slotSize = kDatagramSlot;
+  while (m_running.load() && !failed) {
+    // Wait until a datagram arrives
+    const int ready = ::poll(&pfd, 1, kReadTimeoutMs);
+    if (ready == 0 || (ready < 0 && errno == EINTR))
+      continue;
+
+    if (ready < 0 || (pfd.revents & POLLNVAL)) {
+      failed = true;
+      break;
+    }
+
+    // Drain the socket, one batch per system call
+    while (m_running.load()) {
+      auto batch = acquireBatch();
+      auto& data = batch->data;
+      data.resize(kBatchDatagrams * slotSize);
+
+      char* slab = data.data();
+      std::memset(headers, 0, sizeof(headers));
+      for (int i = 0; i < kBatchDatagrams; ++i) {
+        vectors[i].iov_base           = slab + i * slotSize;
+        vectors[i].iov_len            = static_cast<size_t>(slotSize);
+        headers[i].msg_hdr.msg_iov    = &vectors[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      // MSG_TRUNC reports the full length of datagrams that did not fit
+      const int flags = MSG_DONTWAIT | MSG_TRUNC;
+      const int count = ::recvmmsg(pfd.fd, headers, kBatchDatagrams, flags, nullptr);
+      if (count < 0) {
+        if (errno == EINTR)
+          continue;
+
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNREFUSED) {
+          qWarning() << "[Network] recvmmsg() failed:" << std::strerror(errno);
+          failed = true;
+        }
+
+        break;
+      }
+
+      // Pack the payloads back to back, in arrival order
+      qsizetype size     = 0;
+      qsizetype oversize = 0;
+      for (int i = 0; i < count; ++i) {
+        const auto length = static_cast<qsizetype>(headers[i].msg_len);
+        if (length > slotSize) [[unlikely]] {
+          oversize = qMax(oversize, length);
+          continue;
+        }
+
+        const auto offset = i * slotSize;
+        if (length > 0 && offset != size)
+          std::memmove(slab + size, slab + offset, static_cast<size_t>(length));
+
+        size += length;
+        batch->ends.push_back(size);
+      }
+
+      // Grow the slots so that the next datagrams of this size fit
+      if (oversize > 0) [[unlikely]] {
+        qWarning() << "[Network] Dropped a truncated" << oversize << "byte datagram";
+        slotSize = qMin<qsizetype>(((oversize + 4095) / 4096) * 4096, kMaxDatagramSlot);
+      }
+
+      data.resize(size);
+      if (!batch->ends.empty()) {
+        batch->framed = udpDatagramFrames();
+        Q_EMIT datagramsReceived(batch);
+      }
+
+      // A partial batch means the socket is empty
+      if (count < kBatchDatagrams)
+        break;
+    }
+  }
+
+  if (failed)
+    QMetaObject::invokeMethod(this, "onReadError", Qt::QueuedConnection);
+#endif
 }
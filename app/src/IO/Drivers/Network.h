@@ -21,13 +21,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <QAbstractSocket>
 #include <QByteArray>
 #include <QHostAddress>
 #include <QHostInfo>
 #include <QSettings>
 #include <QTcpSocket>
+#include <QThread>
 #include <QUdpSocket>
+#include <vector>
 
 #include "IO/HAL_Driver.h"
 
@@ -37,6 +41,20 @@ namespace Drivers {
  * @brief The Network class
  *
  * Serial Studio "driver" class to interact with UDP/TCP network ports.
+ *
+ * TCP data is emitted through dataReceived(). UDP datagrams are collected into
+ * pooled IO::DatagramBatch objects and emitted through datagramsReceived(),
+ * one batch per wakeup instead of one signal per datagram:
+ *
+ *   Linux  : m_readThread drains the socket with recvmmsg(), receiving up to
+ *            64 datagrams per system call straight into the slab of a
+ *            pooled batch. The slots are sized for jumbo frames and only
+ *            grow if a larger datagram arrives.
+ *   Others : onReadyRead() reads the pending datagrams with QUdpSocket on the
+ *            main thread and packs them into a pooled batch.
+ *
+ * If udpDatagramFrames() is enabled, every datagram is marked as a complete
+ * frame, so the FrameReader does not need to scan for delimiters.
  */
 class Network : public HAL_Driver {
   // clang-format off
@@ -87,6 +105,10 @@ class Network : public HAL_Driver {
              READ udpMulticast
              WRITE setUdpMulticast
              NOTIFY udpMulticastChanged)
+  Q_PROPERTY(bool udpDatagramFrames
+             READ udpDatagramFrames
+             WRITE setUdpDatagramFrames
+             NOTIFY udpDatagramFramesChanged)
   // clang-format on
 
 signals:
@@ -95,9 +117,11 @@ signals:
   void socketTypeChanged();
   void udpMulticastChanged();
   void lookupActiveChanged();
+  void udpDatagramFramesChanged();
 
 public:
   explicit Network();
+  ~Network();
 
   Network(Network&&)                 = delete;
   Network(const Network&)            = delete;
@@ -119,6 +143,7 @@ public:
   [[nodiscard]] quint16 udpRemotePort() const;
 
   [[nodiscard]] bool udpMulticast() const;
+  [[nodiscard]] bool udpDatagramFrames() const;
   [[nodiscard]] bool lookupActive() const;
   [[nodiscard]] int socketTypeIndex() const;
   [[nodiscard]] QAbstractSocket::SocketType socketType() const;
@@ -150,6 +175,7 @@ public slots:
   void setTcpPort(const quint16 port);
   void setUdpLocalPort(const quint16 port);
   void setUdpMulticast(const bool enabled);
+  void setUdpDatagramFrames(const bool enabled);
   void setSocketTypeIndex(const int index);
   void setUdpRemotePort(const quint16 port);
   void setRemoteAddress(const QString& address);
@@ -157,9 +183,15 @@ public slots:
 
 private slots:
   void onReadyRead();
+  void onReadError();
   void lookupFinished(const QHostInfo& info);
   void onErrorOccurred(const QAbstractSocket::SocketError socketError);
 
+private:
+  void readLoop();
+  void stopReadThread();
+  [[nodiscard]] std::shared_ptr<IO::DatagramBatch> acquireBatch();
+
 private:
   QSettings m_settings;
 
@@ -174,7 +206,12 @@ private:
 
   QTcpSocket m_tcpSocket;
   QUdpSocket m_udpSocket;
-  QByteArray m_udpBuffer;
+
+  QThread m_readThread;
+  qintptr m_udpDescriptor;
+  std::atomic<bool> m_running;
+  std::atomic<bool> m_udpDatagramFrames;
+  std::vector<std::shared_ptr<IO::DatagramBatch>> m_batchPool;
 };
 }  // namespace Drivers
 }  // namespace IO
@@ -27,6 +27,7 @@
 #endif
 
 #include <QApplication>
+#include <QElapsedTimer>
 #include <QJsonObject>
 #include <QMessageBox>
 #include <QMetaObject>
@@ -38,9 +39,14 @@
 // Constants
 //--------------------------------------------------------------------------------------------------
 
-constexpr unsigned int kBulkReadTimeout  = 100;
 constexpr unsigned int kBulkWriteTimeout = 1000;
-constexpr int kBulkReadBufSize           = 65536;
+constexpr int kDefaultBulkTransfers      = 8;
+constexpr int kMaxBulkTransfers          = 64;
+constexpr int kDefaultBulkTransferSize   = 16384;
+constexpr int kMaxBulkTransferSize       = 1024 * 1024;
+constexpr int kMaxBulkErrorStreak        = 32;
+constexpr int kBulkStatsIntervalMs       = 1000;
+constexpr int kBulkDrainTimeoutMs        = 1000;
 constexpr int kDefaultIsoPacketSize      = 1024;
 constexpr int kIsoNumTransfers           = 8;
 constexpr int kIsoPacketsPerTransfer     = 8;
@@ -63,7 +69,7 @@ constexpr int kHotplugFallbackIntervalMs = 2000;
  *     re-scans the bus periodically.
  *
  * A permanent event thread runs libusb_handle_events_timeout() to service
- * both hotplug callbacks and isochronous transfer completions.
+ * hotplug callbacks as well as bulk and isochronous transfer completions.
  */
 IO::Drivers::USB::USB()
   : m_ctx(nullptr)
@@ -74,9 +80,18 @@ IO::Drivers::USB::USB()
   , m_outEndpointIndex(0)
   , m_claimedInterface(-1)
   , m_isoPacketSize(kDefaultIsoPacketSize)
+  , m_bulkTransferCount(kDefaultBulkTransfers)
+  , m_bulkTransferSize(kDefaultBulkTransferSize)
+  , m_bulkBufferSize(kDefaultBulkTransferSize)
+  , m_bulkErrorStreak(0)
   , m_transferMode(TransferMode::BulkStream)
   , m_running(false)
   , m_eventLoopRunning(false)
+  , m_bulkFailed(false)
+  , m_bulkInFlight(0)
+  , m_bulkBytes(0)
+  , m_bulkDrops(0)
+  , m_bulkThroughput(0)
   , m_activeInEp(0)
   , m_activeOutEp(0)
 {
@@ -91,6 +106,11 @@ IO::Drivers::USB::USB()
   m_isoPacketSize    = m_settings.value("USB/isoPacketSize", kDefaultIsoPacketSize).toInt();
   m_transferMode     = static_cast<TransferMode>(m_settings.value("USB/transferMode", 0).toInt());
 
+  const auto count    = m_settings.value("USB/bulkTransferCount", kDefaultBulkTransfers).toInt();
+  const auto size     = m_settings.value("USB/bulkTransferSize", kDefaultBulkTransferSize).toInt();
+  m_bulkTransferCount = qBound(1, count, kMaxBulkTransfers);
+  m_bulkTransferSize  = qBound(1, size, kMaxBulkTransferSize);
+
   // Run initial device enumeration
   enumerateDevices();
 
@@ -123,16 +143,16 @@ IO::Drivers::USB::USB()
 /**
  * @brief Destroys the USB driver.
  *
- * Cancels any in-flight isochronous transfers so the event thread can drain,
- * then stops both threads gracefully before freeing libusb resources. Each
- * thread is given 2 s to exit cleanly — the read loop and event loop both
- * check their atomic flags every ~100 ms, so this is always sufficient.
+ * Cancels any in-flight transfers and stops the read thread while the event
+ * thread is still running, so the cancellations complete, then stops the
+ * event thread before freeing libusb resources. Each thread is given 2 s to
+ * exit cleanly — the read loop and event loop both check their atomic flags
+ * every ~100 ms, so this is always sufficient.
  */
 IO::Drivers::USB::~USB()
 {
-  // Signal both threads to stop
-  m_running          = false;
-  m_eventLoopRunning = false;
+  // Stop the read loop first; it drains the bulk pool on its way out
+  m_running = false;
 
   // Deregister hotplug and cancel pending transfers
   if (m_ctx && m_hotplugHandle) {
@@ -150,6 +170,8 @@ IO::Drivers::USB::~USB()
     m_readThread.wait();
   }
 
+  // Stop the event loop once no transfer depends on it anymore
+  m_eventLoopRunning = false;
   if (m_eventThread.isRunning()) {
     if (!m_eventThread.wait(2000))
       m_eventThread.terminate();
@@ -160,6 +182,8 @@ IO::Drivers::USB::~USB()
   for (auto* t : std::as_const(m_isoTransfers))
     libusb_free_transfer(t);
 
+  freeBulkTransfers();
+
   for (auto* dev : std::as_const(m_devicePtrs))
     libusb_unref_device(dev);
 
@@ -189,8 +213,8 @@ IO::Drivers::USB::~USB()
  *      signals so the QML endpoint combos populate immediately.
  *   3. Verify that at least one IN endpoint was found.
  *   4. Claim the interface that owns the selected IN endpoint.
- *   5. Start either the synchronous bulk loop or the async isochronous loop
- *      on m_readThread.
+ *   5. Submit the bulk or isochronous transfer pool and start the matching
+ *      loop on m_readThread.
  *
  * Each failure step presents a descriptive error dialog via
  * Misc::Utilities::showMessageBox() so the user understands what went wrong.
@@ -288,8 +312,20 @@ bool IO::Drivers::USB::open(const QIODevice::OpenMode mode)
   if (m_transferMode == TransferMode::Isochronous) {
     allocateIsoTransfers();
     connect(&m_readThread, &QThread::started, this, &USB::isoReadLoop, Qt::DirectConnection);
-  } else {
+  } else if (allocateBulkTransfers(inEp.maxPacketSize)) {
     connect(&m_readThread, &QThread::started, this, &USB::readLoop, Qt::DirectConnection);
+  } else {
+    m_running = false;
+    freeBulkTransfers();
+    releaseInterface();
+    libusb_close(m_handle);
+    m_handle = nullptr;
+    Misc::Utilities::showMessageBox(tr("USB Device Error"),
+                                    tr("Could not start reading from the bulk IN endpoint.\n\n"
+                                       "Try a smaller transfer size or fewer concurrent "
+                                       "transfers."),
+                                    QMessageBox::Critical);
+    return false;
   }
 
   m_readThread.start();
@@ -304,9 +340,10 @@ bool IO::Drivers::USB::open(const QIODevice::OpenMode mode)
  *
  * The sequence is safe to call from any state (open or already closed):
  *   1. Set m_running to false so the read loop exits on its next iteration.
- *   2. Cancel any pending isochronous transfers so the event loop can drain.
+ *   2. Cancel any pending isochronous transfers so the event loop can drain;
+ *      the read loop cancels and drains the bulk pool itself.
  *   3. Wait up to two seconds for the read thread to finish.
- *   4. Free the isochronous transfer pool.
+ *   4. Free the isochronous and bulk transfer pools.
  *   5. Release the claimed USB interface and close the device handle.
  *   6. Emit configurationChanged() so the toolbar updates.
  */
@@ -335,6 +372,9 @@ void IO::Drivers::USB::close()
 
   m_isoTransfers.clear();
 
+  // Free the bulk transfer pool
+  freeBulkTransfers();
+
   // Detach thread-started connections for the next open() cycle
   disconnect(&m_readThread, &QThread::started, this, &USB::readLoop);
   disconnect(&m_readThread, &QThread::started, this, &USB::isoReadLoop);
@@ -571,6 +611,54 @@ int IO::Drivers::USB::isoPacketSize() const
   return m_isoPacketSize;
 }
 
+/**
+ * @brief Returns the number of bulk IN transfers kept in flight.
+ *
+ * More transfers keep the endpoint busy while completed buffers are being
+ * handed to the frame reader, at the cost of more pinned memory.
+ *
+ * @return m_bulkTransferCount.
+ */
+int IO::Drivers::USB::bulkTransferCount() const
+{
+  return m_bulkTransferCount;
+}
+
+/**
+ * @brief Returns the requested size of each bulk IN transfer in bytes.
+ *
+ * open() rounds this up to a multiple of the IN endpoint's wMaxPacketSize,
+ * since a short buffer would turn a full packet into an overflow error.
+ *
+ * @return m_bulkTransferSize.
+ */
+int IO::Drivers::USB::bulkTransferSize() const
+{
+  return m_bulkTransferSize;
+}
+
+/**
+ * @brief Returns the bulk IN throughput measured over the last second.
+ * @return Received bytes per second, or 0 when no bulk pool is running.
+ */
+qint64 IO::Drivers::USB::bulkThroughput() const
+{
+  return m_bulkThroughput.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of bulk IN transfers that failed since open().
+ *
+ * A dropped transfer is resubmitted, so its data is lost but the stream goes
+ * on. Fatal errors (device gone, stalled endpoint) close the device instead.
+ *
+ * @return Dropped transfer count.
+ */
+quint64 IO::Drivers::USB::droppedTransfers() const
+{
+  return m_bulkDrops.load(std::memory_order_relaxed);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public slots
 //--------------------------------------------------------------------------------------------------
@@ -731,6 +819,48 @@ void IO::Drivers::USB::setIsoPacketSize(const int size)
   Q_EMIT configurationChanged();
 }
 
+/**
+ * @brief Sets the number of bulk IN transfers kept in flight.
+ *
+ * Takes effect the next time the device is opened. The value is clamped to
+ * 1–64 and persisted to QSettings.
+ *
+ * @param count  Number of concurrent bulk IN transfers.
+ */
+void IO::Drivers::USB::setBulkTransferCount(const int count)
+{
+  const int clamped = qBound(1, count, kMaxBulkTransfers);
+  if (m_bulkTransferCount == clamped)
+    return;
+
+  m_bulkTransferCount = clamped;
+  m_settings.setValue("USB/bulkTransferCount", clamped);
+
+  Q_EMIT bulkTransferCountChanged();
+  Q_EMIT configurationChanged();
+}
+
+/**
+ * @brief Sets the size of each bulk IN transfer in bytes.
+ *
+ * Takes effect the next time the device is opened. The value is clamped to
+ * 1 B–1 MiB and persisted to QSettings.
+ *
+ * @param size  Transfer buffer size in bytes.
+ */
+void IO::Drivers::USB::setBulkTransferSize(const int size)
+{
+  const int clamped = qBound(1, size, kMaxBulkTransferSize);
+  if (m_bulkTransferSize == clamped)
+    return;
+
+  m_bulkTransferSize = clamped;
+  m_settings.setValue("USB/bulkTransferSize", clamped);
+
+  Q_EMIT bulkTransferSizeChanged();
+  Q_EMIT configurationChanged();
+}
+
 /**
  * @brief Connects the driver to application-level lifecycle signals.
  *
@@ -741,8 +871,7 @@ void IO::Drivers::USB::setIsoPacketSize(const int size)
 void IO::Drivers::USB::setupExternalConnections()
 {
   connect(qApp, &QApplication::aboutToQuit, this, [this] {
-    m_running          = false;
-    m_eventLoopRunning = false;
+    m_running = false;
 
     // Deregister hotplug first to wake the event loop out of its poll
     if (m_ctx && m_hotplugHandle) {
@@ -759,6 +888,8 @@ void IO::Drivers::USB::setupExternalConnections()
       m_readThread.wait();
     }
 
+    // Pending cancellations are delivered by the event loop, stop it last
+    m_eventLoopRunning = false;
     if (m_eventThread.isRunning()) {
       if (!m_eventThread.wait(2000))
         m_eventThread.terminate();
@@ -1071,9 +1202,9 @@ void IO::Drivers::USB::buildEndpointLists()
  * @brief Runs the libusb event loop on m_eventThread.
  *
  * Calls libusb_handle_events_timeout() with a 100 ms timeout in a tight loop
- * for as long as m_eventLoopRunning is true. This drives both hotplug
- * callbacks (device arrived/left) and isochronous transfer completions without
- * any polling from the main thread.
+ * for as long as m_eventLoopRunning is true. This drives hotplug callbacks
+ * (device arrived/left) as well as bulk and isochronous transfer completions
+ * without any polling from the main thread.
  */
 void IO::Drivers::USB::eventLoop()
 {
@@ -1156,37 +1287,165 @@ void IO::Drivers::USB::releaseInterface()
 }
 
 /**
- * @brief Synchronous bulk read loop for BulkStream and AdvancedControl modes.
- *
- * Runs entirely on m_readThread. libusb_bulk_transfer() is called with a
- * 100 ms timeout so the loop remains responsive to m_running being cleared
- * by close(). Successful reads are dispatched to the HAL layer via
- * dataReceived(). Any non-timeout error triggers onReadError() via a queued
- * invocation on the main thread, which calls close() to clean up.
+ * @brief Supervises the asynchronous bulk pool for BulkStream and
+ *        AdvancedControl modes.
+ *
+ * Runs on m_readThread. The transfers themselves are submitted by
+ * allocateBulkTransfers() and completed on m_eventThread, so this loop only
+ * updates the throughput figure once per second while m_running is set.
+ *
+ * When close() clears m_running, every transfer still in flight is cancelled
+ * and the loop waits (bounded) for the event thread to deliver the
+ * cancellations, so close() can free the pool safely afterwards. The cancel
+ * pass is repeated while transfers remain, since a callback that read
+ * m_running just before it was cleared may resubmit after a pass.
  */
 void IO::Drivers::USB::readLoop()
 {
-  unsigned char buf[kBulkReadBufSize];
+  QElapsedTimer clock;
+  clock.start();
 
+  quint64 lastBytes = 0;
   while (m_running.load(std::memory_order_relaxed)) {
-    int transferred = 0;
-    const int rc    = libusb_bulk_transfer(
-      m_handle, m_activeInEp, buf, kBulkReadBufSize, &transferred, kBulkReadTimeout);
+    QThread::msleep(10);
 
-    if (rc == LIBUSB_ERROR_TIMEOUT)
+    const qint64 elapsed = clock.elapsed();
+    if (elapsed < kBulkStatsIntervalMs)
       continue;
 
-    if (rc == 0 && transferred > 0) {
-      Q_EMIT dataReceived(
-        IO::makeByteArray(QByteArray(reinterpret_cast<const char*>(buf), transferred)));
-      continue;
-    }
+    const quint64 bytes = m_bulkBytes.load(std::memory_order_relaxed);
+    m_bulkThroughput.store(static_cast<qint64>(bytes - lastBytes) * 1000 / elapsed,
+                           std::memory_order_relaxed);
+
+    lastBytes = bytes;
+    clock.restart();
+  }
 
-    if (rc != 0) {
-      QMetaObject::invokeMethod(this, "onReadError", Qt::QueuedConnection);
+  // Cancel the pool until the event thread has delivered every cancellation
+  clock.restart();
+  while (m_bulkInFlight.load(std::memory_order_acquire) > 0
+         && clock.elapsed() < kBulkDrainTimeoutMs) {
+    for (const auto& slot : m_bulkSlots)
+      libusb_cancel_transfer(slot->transfer);
+
+    QThread::msleep(1);
+  }
+
+  m_bulkThroughput.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Allocates and submits the bulk IN transfer pool on the main thread.
+ *
+ * Called from open() before m_readThread starts. The transfer size is
+ * rounded up to a multiple of @p maxPacketSize, then bulkTransferCount()
+ * transfers are created and all of them submitted, so the host controller
+ * always has a buffer queued for the endpoint. Completions are serviced by
+ * bulkTransferCallback() on m_eventThread.
+ *
+ * @param maxPacketSize  wMaxPacketSize of the selected IN endpoint.
+ * @return true if at least one transfer is in flight.
+ */
+bool IO::Drivers::USB::allocateBulkTransfers(int maxPacketSize)
+{
+  // Reset the statistics of the previous session
+  m_bulkErrorStreak = 0;
+  m_bulkFailed.store(false, std::memory_order_relaxed);
+  m_bulkBytes.store(0, std::memory_order_relaxed);
+  m_bulkDrops.store(0, std::memory_order_relaxed);
+  m_bulkThroughput.store(0, std::memory_order_relaxed);
+
+  // Round the buffer up to whole packets to avoid overflow errors
+  const int packet = qMax(1, maxPacketSize & 0x07FF);
+  m_bulkBufferSize = ((m_bulkTransferSize + packet - 1) / packet) * packet;
+
+  for (int i = 0; i < m_bulkTransferCount; ++i) {
+    libusb_transfer* t = libusb_alloc_transfer(0);
+    if (!t)
       break;
+
+    auto slot      = std::make_unique<BulkSlot>();
+    slot->driver   = this;
+    slot->transfer = t;
+    slot->buffer   = acquireBulkBuffer();
+
+    libusb_fill_bulk_transfer(t,
+                              m_handle,
+                              m_activeInEp,
+                              reinterpret_cast<unsigned char*>(slot->buffer->data()),
+                              m_bulkBufferSize,
+                              &USB::bulkTransferCallback,
+                              slot.get(),
+                              0);
+
+    m_bulkSlots.push_back(std::move(slot));
+  }
+
+  // Submit only once every slot exists, callbacks may start right away
+  for (const auto& slot : m_bulkSlots) {
+    m_bulkInFlight.fetch_add(1, std::memory_order_relaxed);
+    if (libusb_submit_transfer(slot->transfer) < 0)
+      m_bulkInFlight.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  return m_bulkInFlight.load(std::memory_order_relaxed) > 0;
+}
+
+/**
+ * @brief Frees the bulk IN transfer pool and its buffers.
+ *
+ * Must only be called after readLoop() has drained the pool. If a transfer
+ * is somehow still owned by libusb, the pool is leaked instead of freed,
+ * since the event thread could still touch it.
+ */
+void IO::Drivers::USB::freeBulkTransfers()
+{
+  if (m_bulkInFlight.load(std::memory_order_acquire) > 0) {
+    qWarning() << "USB: bulk transfers still pending, leaking the transfer pool";
+    for (auto& slot : m_bulkSlots)
+      (void)slot.release();
+
+    m_bulkSlots.clear();
+    m_bulkBuffers.clear();
+    m_bulkInFlight.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  for (const auto& slot : m_bulkSlots)
+    libusb_free_transfer(slot->transfer);
+
+  m_bulkSlots.clear();
+  m_bulkBuffers.clear();
+}
+
+/**
+ * @brief Returns a bulk buffer that no consumer references anymore.
+ *
+ * Completed buffers are emitted as they are, so the pool keeps the ones that
+ * are still referenced by the frame reader or other consumers and hands out
+ * the first one whose only owner is the pool. A new buffer is allocated when
+ * all of them are busy; the pool stops growing at four buffers per transfer.
+ *
+ * Runs on the main thread while the pool is allocated, and on m_eventThread
+ * afterwards.
+ *
+ * @return A buffer resized to the active transfer size.
+ */
+std::shared_ptr<QByteArray> IO::Drivers::USB::acquireBulkBuffer()
+{
+  for (const auto& buffer : m_bulkBuffers) {
+    if (buffer.use_count() == 1) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      buffer->resize(m_bulkBufferSize);
+      return buffer;
     }
   }
+
+  auto buffer = std::make_shared<QByteArray>(m_bulkBufferSize, Qt::Uninitialized);
+  if (m_bulkBuffers.size() < static_cast<size_t>(m_bulkTransferCount) * 4)
+    m_bulkBuffers.push_back(buffer);
+
+  return buffer;
 }
 
 /**
@@ -1305,6 +1564,78 @@ void LIBUSB_CALL IO::Drivers::USB::isoTransferCallback(libusb_transfer* transfer
     delete[] transfer->buffer;
 }
 
+/**
+ * @brief Static libusb callback invoked for each completed bulk IN transfer.
+ *
+ * Runs on m_eventThread. A completed buffer is shrunk to the received length
+ * and emitted through dataReceived() without copying; the slot then takes a
+ * free buffer from the pool and is resubmitted right away.
+ *
+ * Transient errors (timeout, overflow, transfer error) count as dropped
+ * transfers and are resubmitted, unless they keep failing. A missing device,
+ * a stalled endpoint or a failed resubmission closes the device through
+ * onReadError() on the main thread. Transfers that are not resubmitted leave
+ * the in-flight count so readLoop() can tell when the pool has drained.
+ *
+ * @param transfer  Completed libusb_transfer. user_data points to its
+ *                  BulkSlot.
+ */
+void LIBUSB_CALL IO::Drivers::USB::bulkTransferCallback(libusb_transfer* transfer)
+{
+  auto* slot = static_cast<BulkSlot*>(transfer->user_data);
+  auto* self = slot->driver;
+
+  bool fatal    = false;
+  bool resubmit = true;
+  switch (transfer->status) {
+    case LIBUSB_TRANSFER_COMPLETED:
+      self->m_bulkErrorStreak = 0;
+      if (transfer->actual_length > 0) {
+        self->m_bulkBytes.fetch_add(transfer->actual_length, std::memory_order_relaxed);
+
+        auto received = std::move(slot->buffer);
+        received->resize(transfer->actual_length);
+        slot->buffer     = self->acquireBulkBuffer();
+        transfer->buffer = reinterpret_cast<unsigned char*>(slot->buffer->data());
+
+        Q_EMIT self->dataReceived(received);
+      }
+      break;
+    case LIBUSB_TRANSFER_CANCELLED:
+      resubmit = false;
+      break;
+    case LIBUSB_TRANSFER_NO_DEVICE:
+    case LIBUSB_TRANSFER_STALL:
+      fatal = true;
+      break;
+    default:
+      self->m_bulkDrops.fetch_add(1, std::memory_order_relaxed);
+      fatal = ++self->m_bulkErrorStreak > kMaxBulkErrorStreak;
+      break;
+  }
+
+  // Keep the pool in flight while the device is open
+  const bool running = self->m_running.load();
+  if (!fatal && resubmit && running) {
+    if (libusb_submit_transfer(transfer) == 0) {
+      // close() may have cancelled the pool between the check and the submit
+      if (!self->m_running.load())
+        libusb_cancel_transfer(transfer);
+
+      return;
+    }
+
+    self->m_bulkDrops.fetch_add(1, std::memory_order_relaxed);
+    fatal = true;
+  }
+
+  // Request a single close() for unexpected failures
+  if (fatal && running && !self->m_bulkFailed.exchange(true))
+    QMetaObject::invokeMethod(self, "onReadError", Qt::QueuedConnection);
+
+  self->m_bulkInFlight.fetch_sub(1, std::memory_order_release);
+}
+
 /**
  * @brief Issues a USB control transfer (AdvancedControl mode only).
  *
@@ -1450,6 +1781,10 @@ bool IO::Drivers::USB::selectByIdentifier(const QJsonObject& id)
 
 /**
  * @brief Returns the USB configuration as a flat list of editable properties.
+ *
+ * The bulk throughput and dropped transfer entries are read-only status
+ * values of the current session.
+ *
  * @return List of DriverProperty descriptors with current values.
  */
 QList<IO::DriverProperty> IO::Drivers::USB::driverProperties() const
@@ -1497,6 +1832,40 @@ QList<IO::DriverProperty> IO::Drivers::USB::driverProperties() const
   iso.max   = 65535;
   props.append(iso);
 
+  IO::DriverProperty count;
+  count.key   = QStringLiteral("bulkTransferCount");
+  count.label = tr("Bulk Transfers");
+  count.type  = IO::DriverProperty::IntField;
+  count.value = m_bulkTransferCount;
+  count.min   = 1;
+  count.max   = kMaxBulkTransfers;
+  props.append(count);
+
+  IO::DriverProperty size;
+  size.key   = QStringLiteral("bulkTransferSize");
+  size.label = tr("Bulk Transfer Size");
+  size.type  = IO::DriverProperty::IntField;
+  size.value = m_bulkTransferSize;
+  size.min   = 1;
+  size.max   = kMaxBulkTransferSize;
+  props.append(size);
+
+  IO::DriverProperty rate;
+  rate.key      = QStringLiteral("bulkThroughput");
+  rate.label    = tr("Bulk Throughput");
+  rate.type     = IO::DriverProperty::Text;
+  rate.value    = tr("%1 MB/s").arg(bulkThroughput() / 1e6, 0, 'f', 2);
+  rate.readOnly = true;
+  props.append(rate);
+
+  IO::DriverProperty drops;
+  drops.key      = QStringLiteral("droppedTransfers");
+  drops.label    = tr("Dropped Transfers");
+  drops.type     = IO::DriverProperty::Text;
+  drops.value    = QString::number(droppedTransfers());
+  drops.readOnly = true;
+  props.append(drops);
+
   return props;
 }
 
@@ -1521,4 +1890,10 @@ void IO::Drivers::USB::setDriverProperty(const QString& key, const QVariant& val
 
   else if (key == QLatin1String("isoPacketSize"))
     setIsoPacketSize(value.toInt());
+
+  else if (key == QLatin1String("bulkTransferCount"))
+    setBulkTransferCount(value.toInt());
+
+  else if (key == QLatin1String("bulkTransferSize"))
+    setBulkTransferSize(value.toInt());
 }
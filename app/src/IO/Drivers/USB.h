@@ -30,12 +30,15 @@
 #include <libusb.h>
 
 #include <atomic>
+#include <memory>
+#include <QByteArray>
 #include <QList>
 #include <QObject>
 #include <QSettings>
 #include <QString>
 #include <QStringList>
 #include <QThread>
+#include <vector>
 
 #include "IO/HAL_Driver.h"
 
@@ -52,16 +55,21 @@ namespace Drivers {
  * platforms where hotplug is unavailable a 2-second QTimer fallback is used.
  *
  * Three transfer modes:
- *   BulkStream      — synchronous bulk IN/OUT (default).
+ *   BulkStream      — async bulk IN, synchronous bulk OUT (default).
  *   AdvancedControl — bulk + control transfers; requires user confirmation.
  *   Isochronous     — async isochronous transfers using the event thread.
  *
  * Threading:
  *   m_eventThread runs libusb_handle_events_timeout() at all times.
- *   BulkStream / AdvancedControl: blocking libusb_bulk_transfer loop on
- *     m_readThread.
+ *   BulkStream / AdvancedControl: a pool of bulkTransferCount() IN transfers
+ *     of bulkTransferSize() bytes each is kept in flight, so the endpoint is
+ *     never idle between reads. Completions are driven by m_eventThread;
+ *     m_readThread only samples the throughput and drains the pool on close.
  *   Isochronous: submitted transfers are driven by m_eventThread; callbacks
  *     resubmit completed transfers.
+ *
+ * Received bulk buffers are emitted as they are (no copy) and recycled once
+ * every consumer has released them.
  */
 class USB : public HAL_Driver {
   // clang-format off
@@ -96,6 +104,14 @@ class USB : public HAL_Driver {
              READ  isoPacketSize
              WRITE setIsoPacketSize
              NOTIFY isoPacketSizeChanged)
+  Q_PROPERTY(int bulkTransferCount
+             READ  bulkTransferCount
+             WRITE setBulkTransferCount
+             NOTIFY bulkTransferCountChanged)
+  Q_PROPERTY(int bulkTransferSize
+             READ  bulkTransferSize
+             WRITE setBulkTransferSize
+             NOTIFY bulkTransferSizeChanged)
   Q_PROPERTY(bool advancedModeEnabled
              READ  advancedModeEnabled
              NOTIFY transferModeChanged)
@@ -112,13 +128,15 @@ signals:
   void inEndpointIndexChanged();
   void outEndpointIndexChanged();
   void isoPacketSizeChanged();
+  void bulkTransferCountChanged();
+  void bulkTransferSizeChanged();
 
 public:
   /**
    * @brief USB transfer mode.
    */
   enum class TransferMode {
-    BulkStream      = 0, /**< Synchronous bulk IN/OUT (default). */
+    BulkStream      = 0, /**< Async bulk IN, synchronous bulk OUT (default). */
     AdvancedControl = 1, /**< Bulk + control transfers. */
     Isochronous     = 2, /**< Async isochronous transfers. */
   };
@@ -158,6 +176,11 @@ public:
   [[nodiscard]] int outEndpointIndex() const;
 
   [[nodiscard]] int isoPacketSize() const;
+  [[nodiscard]] int bulkTransferCount() const;
+  [[nodiscard]] int bulkTransferSize() const;
+
+  [[nodiscard]] qint64 bulkThroughput() const;
+  [[nodiscard]] quint64 droppedTransfers() const;
 
 public slots:
   void setDriverProperty(const QString& key, const QVariant& value) override;
@@ -166,6 +189,8 @@ public slots:
   void setInEndpointIndex(const int index);
   void setOutEndpointIndex(const int index);
   void setIsoPacketSize(const int size);
+  void setBulkTransferCount(const int count);
+  void setBulkTransferSize(const int size);
   void setupExternalConnections();
 
 private slots:
@@ -181,9 +206,17 @@ private:
     QString label;
   };
 
+  struct BulkSlot {
+    USB* driver;
+    libusb_transfer* transfer;
+    std::shared_ptr<QByteArray> buffer;
+  };
+
   void buildEndpointLists();
   void clearEndpointLists();
   void allocateIsoTransfers();
+  [[nodiscard]] bool allocateBulkTransfers(int maxPacketSize);
+  void freeBulkTransfers();
   void collectEndpoint(const libusb_endpoint_descriptor& ep, int ifNum, bool wantIso);
   void eventLoop();
 
@@ -192,6 +225,8 @@ private:
   void readLoop();
   void isoReadLoop();
 
+  [[nodiscard]] std::shared_ptr<QByteArray> acquireBulkBuffer();
+
   bool claimInterface(int ifaceNum);
   void releaseInterface();
 
@@ -203,6 +238,7 @@ private:
                                            unsigned int timeout_ms);
 
   static void LIBUSB_CALL isoTransferCallback(libusb_transfer* transfer);
+  static void LIBUSB_CALL bulkTransferCallback(libusb_transfer* transfer);
   static int LIBUSB_CALL hotplugCallback(libusb_context* ctx,
                                          libusb_device* device,
                                          libusb_hotplug_event event,
@@ -218,11 +254,20 @@ private:
   int m_outEndpointIndex;
   int m_claimedInterface;
   int m_isoPacketSize;
+  int m_bulkTransferCount;
+  int m_bulkTransferSize;
+  int m_bulkBufferSize;
+  int m_bulkErrorStreak;
 
   TransferMode m_transferMode;
 
   std::atomic<bool> m_running;
   std::atomic<bool> m_eventLoopRunning;
+  std::atomic<bool> m_bulkFailed;
+  std::atomic<int> m_bulkInFlight;
+  std::atomic<quint64> m_bulkBytes;
+  std::atomic<quint64> m_bulkDrops;
+  std::atomic<qint64> m_bulkThroughput;
 
   QThread m_readThread;
   QThread m_eventThread;
@@ -240,6 +285,9 @@ private:
   uint8_t m_activeOutEp;
 
   QList<libusb_transfer*> m_isoTransfers;
+
+  std::vector<std::unique_ptr<BulkSlot>> m_bulkSlots;
+  std::vector<std::shared_ptr<QByteArray>> m_bulkBuffers;
 };
 
 }  // namespace Drivers
@@ -21,6 +21,8 @@
 
 #include "FrameReader.h"
 
+#include <cstring>
+
 #include "IO/Checksum.h"
 
 //--------------------------------------------------------------------------------------------------
@@ -31,26 +33,46 @@
  * @brief Constructs a FrameReader object.
  *
  * Initializes the FrameReader with default settings, including frame detection
- * mode, operation mode, and buffer settings. Runs on the main thread; see
- * the class-level docstring for the threading rationale.
+ * mode, operation mode, and buffer settings. The instance is created on the
+ * main thread and then moved to the owning DeviceManager's ingest thread;
+ * see the class-level docstring for the threading rationale.
  *
  * @param parent The parent QObject (optional).
  */
 IO::FrameReader::FrameReader(QObject* parent)
   : QObject(parent)
   , m_checksumLength(0)
+  , m_quickPlotLineEndings("\r\n")
   , m_operationMode(SerialStudio::QuickPlot)
   , m_frameDetectionMode(SerialStudio::EndDelimiterOnly)
   , m_circularBuffer(1024 * 1024)
+  , m_readyReadPending(false)
+{}
+
+//--------------------------------------------------------------------------------------------------
+// Frame buffer recycling
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns a consumed frame buffer to the pool for reuse.
+ *
+ * Called by the queue consumer after it is done with a dequeued frame. The
+ * buffer is only pooled if nobody else holds a reference to it (so reusing
+ * it cannot alter data seen elsewhere) and if it is not unusually large.
+ * Otherwise, or when the pool is full, the buffer is simply released.
+ *
+ * **Thread Safety:** Call only from the queue consumer thread; the pool is
+ * the reverse SPSC channel of queue().
+ *
+ * @param frame Frame previously obtained from queue(); left empty on return.
+ */
+void IO::FrameReader::recycleFrame(QByteArray& frame)
 {
-  m_quickPlotEndSequences.append(QByteArray("\n"));
-  m_quickPlotEndSequences.append(QByteArray("\r"));
-  m_quickPlotEndSequences.append(QByteArray("\r\n"));
-
-  m_quickPlotEndSequenceLps.clear();
-  m_quickPlotEndSequenceLps.reserve(m_quickPlotEndSequences.size());
-  for (const auto& delimiter : std::as_const(m_quickPlotEndSequences))
-    m_quickPlotEndSequenceLps.append(m_circularBuffer.buildKMPTable(delimiter));
+  constexpr qsizetype kMaxPooledFrameSize = 64 * 1024;
+  if (frame.isDetached() && frame.capacity() <= kMaxPooledFrameSize)
+    (void)m_framePool.try_enqueue(std::move(frame));
+
+  frame = QByteArray();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -68,8 +90,8 @@ IO::FrameReader::FrameReader(QObject* parent)
  *   according to the configured delimiters.
  *
  * Parsed frames are enqueued for later processing. No signals are emitted
- * per frame to avoid UI flooding. Instead, a single `readyRead()` signal
- * notifies the consumer that new frames are available for reading.
+ * per frame to avoid UI flooding. Instead, a single coalesced `readyRead()`
+ * signal notifies the consumer that new frames are available for reading.
  *
  * **Performance:** Lock-free, optimized for 256 KHz+ data rates.
  *
@@ -77,71 +99,139 @@ IO::FrameReader::FrameReader(QObject* parent)
  */
 void IO::FrameReader::processData(const ByteArrayPtr& data)
 {
-  Q_ASSERT(m_operationMode >= SerialStudio::ProjectFile
-           && m_operationMode <= SerialStudio::QuickPlot);
-  Q_ASSERT(m_checksumLength >= 0);
-
   // Validate input
   if (!data || data->isEmpty())
     return;
 
-  // Variable to detect if a frame has been detected
-  bool framesEnqueued = false;
-
-  // Direct processing (no frame delimiters)
-  if (m_operationMode == SerialStudio::ProjectFile
-      && m_frameDetectionMode == SerialStudio::NoDelimiters)
-    framesEnqueued = m_queue.try_enqueue(*data);
+  // Always notify the consumer when frames were enqueued so it can drain
+  // the queue. Even if all frames were dropped due to a full queue, notify
+  // so the consumer processes whatever is already queued and makes room
+  // for the next processData() call.
+  const bool framesEnqueued = ingest(*data);
+  if (framesEnqueued || m_queue.size_approx() > 0)
+    notifyReadyRead();
+}
 
-  // Delimiter based processing
-  else {
-    // Detect data loss from buffer overflow
-    m_circularBuffer.append(*data);
-    const auto overflow = m_circularBuffer.overflowCount();
-    if (overflow > 0) [[unlikely]] {
-      qWarning() << "[FrameReader] Buffer overflow:" << overflow
-                 << "bytes lost — data rate exceeds processing capacity";
-      m_circularBuffer.resetOverflowCount();
-    }
+/**
+ * @brief Processes a batch of datagrams received in a single driver wakeup.
+ *
+ * If the batch is framed, or if the project uses no delimiters, every
+ * datagram becomes one frame and no delimiter scanning takes place (see
+ * enqueueDatagram()). Otherwise the datagrams are just pieces of a byte
+ * stream, and the whole payload goes through the circular buffer at once.
+ *
+ * In both cases the consumer is notified once per batch instead of once per
+ * datagram.
+ *
+ * @param batch Datagrams delivered by the driver.
+ */
+void IO::FrameReader::processDatagrams(const DatagramBatchPtr& batch)
+{
+  // Validate input
+  if (!batch || batch->data.isEmpty())
+    return;
 
-    // Read frames
+  // Split the batch at datagram boundaries
+  bool framesEnqueued    = false;
+  const bool passthrough = m_operationMode == SerialStudio::ProjectFile
+                        && m_frameDetectionMode == SerialStudio::NoDelimiters;
+  if (batch->framed || passthrough) {
+    qsizetype begin        = 0;
     const auto initialSize = m_queue.size_approx();
-    switch (m_operationMode) {
-      case SerialStudio::QuickPlot:
-        readEndDelimitedFrames();
-        break;
-      case SerialStudio::DeviceSendsJSON:
-        readStartEndDelimitedFrames();
-        break;
-      case SerialStudio::ProjectFile:
-        switch (m_frameDetectionMode) {
-          case SerialStudio::EndDelimiterOnly:
-            readEndDelimitedFrames();
-            break;
-          case SerialStudio::StartDelimiterOnly:
-            readStartDelimitedFrames();
-            break;
-          case SerialStudio::StartAndEndDelimiter:
-            readStartEndDelimitedFrames();
-            break;
-          default:
-            break;
-        }
-        break;
-      default:
-        break;
+    for (const auto end : batch->ends) {
+      enqueueDatagram(batch->data.constData() + begin, end - begin);
+      begin = end;
     }
 
-    // Detect if we parsed any frame (approximate count is sufficient here
-    // because both the enqueue and this check happen on the same thread)
     framesEnqueued = (m_queue.size_approx() > initialSize);
   }
 
-  // Always notify the consumer when frames were enqueued so it can drain
-  // the queue. Even if all frames were dropped due to a full queue, emit
-  // readyRead so the consumer processes whatever is already queued and
-  // makes room for the next processData() call.
+  // Stream the payloads through the delimiter scanner
+  else
+    framesEnqueued = ingest(batch->data);
+
+  // Notify the consumer once for the whole batch
   if (framesEnqueued || m_queue.size_approx() > 0)
+    notifyReadyRead();
+}
+
+/**
+ * @brief Runs a chunk of the byte stream through the frame extractor.
+ *
+ * Shared by processData() and processDatagrams(), neither of which notifies
+ * the consumer until the whole input has been handled.
+ *
+ * @param data Bytes to append to the stream.
+ * @return @c true if at least one frame was enqueued.
+ */
+bool IO::FrameReader::ingest(const QByteArray& data)
+{
+  Q_ASSERT(m_operationMode >= SerialStudio::ProjectFile
+           && m_operationMode <= SerialStudio::QuickPlot);
+  Q_ASSERT(m_checksumLength >= 0);
+
+  // Direct processing (no frame delimiters)
+  if (m_operationMode == SerialStudio::ProjectFile
+      && m_frameDetectionMode == SerialStudio::NoDelimiters)
+    return m_queue.try_enqueue(data);
+
+  // Detect data loss from buffer overflow
+  m_circularBuffer.append(data);
+  const auto overflow = m_circularBuffer.overflowCount();
+  if (overflow > 0) [[unlikely]] {
+    qWarning() << "[FrameReader] Buffer overflow:" << overflow
+               << "bytes lost — data rate exceeds processing capacity";
+    m_circularBuffer.resetOverflowCount();
+    resetScanStates();
+  }
+
+  // Read frames
+  const auto initialSize = m_queue.size_approx();
+  switch (m_operationMode) {
+    case SerialStudio::QuickPlot:
+      readEndDelimitedFrames();
+      break;
+    case SerialStudio::DeviceSendsJSON:
+      readStartEndDelimitedFrames();
+      break;
+    case SerialStudio::ProjectFile:
+      switch (m_frameDetectionMode) {
+        case SerialStudio::EndDelimiterOnly:
+          readEndDelimitedFrames();
+          break;
+        case SerialStudio::StartDelimiterOnly:
+          readStartDelimitedFrames();
+          break;
+        case SerialStudio::StartAndEndDelimiter:
+          readStartEndDelimitedFrames();
+          break;
+        default:
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+
+  // Detect if we parsed any frame (approximate count is sufficient here
+  // because both the enqueue and this check happen on the same thread)
+  return m_queue.size_approx() > initialSize;
+}
+
+/**
+ * @brief Emits readyRead() unless a notification is already in flight.
+ *
+ * The consumer lives on the main thread, so every emission becomes a queued
+ * event. While the GUI is busy, processData() keeps running on the ingest
+ * thread; without coalescing each call would post another event and the
+ * main thread would later wake up once per chunk just to find an empty
+ * queue. The flag is cleared by acknowledgeReadyRead() before the consumer
+ * starts draining, so frames enqueued during the drain trigger a new
+ * notification.
+ */
+void IO::FrameReader::notifyReadyRead()
+{
+  if (!m_readyReadPending.exchange(true, std::memory_order_acq_rel))
     Q_EMIT readyRead();
 }
 
@@ -156,36 +246,55 @@ void IO::FrameReader::processData(const ByteArrayPtr& data)
  */
 void IO::FrameReader::setChecksum(const QString& checksum)
 {
-  // Compute output length from algorithm name
+  // Resolve the algorithm once, and compute its output length
   m_checksum      = checksum;
   const auto& map = IO::checksumFunctionMap();
   const auto it   = map.find(m_checksum);
-  if (it != map.end())
-    m_checksumLength = it.value()("", 0).size();
-  else
+  if (it != map.end()) {
+    m_checksumFunc   = it.value();
+    m_checksumLength = m_checksumFunc("", 0).size();
+  } else {
+    m_checksumFunc   = nullptr;
     m_checksumLength = 0;
+  }
 }
 
 /**
  * @brief Sets the start sequence used for frame detection.
  *
+ * Sequences of up to CircularBuffer::kShortPatternLength bytes are searched
+ * with memchr(); only longer ones need a KMP table.
+ *
  * @param start The new start sequence as a QByteArray.
  */
 void IO::FrameReader::setStartSequence(const QByteArray& start)
 {
-  m_startSequence    = start;
-  m_startSequenceLps = m_circularBuffer.buildKMPTable(m_startSequence);
+  m_startSequence = start;
+  if (m_startSequence.size() > CircularBuffer<QByteArray, char>::kShortPatternLength)
+    m_startSequenceLps = m_circularBuffer.buildKMPTable(m_startSequence);
+  else
+    m_startSequenceLps.clear();
+
+  resetScanStates();
 }
 
 /**
  * @brief Sets the finish sequence used for frame detection.
  *
+ * Sequences of up to CircularBuffer::kShortPatternLength bytes are searched
+ * with memchr(); only longer ones need a KMP table.
+ *
  * @param finish The new finish sequence as a QByteArray.
  */
 void IO::FrameReader::setFinishSequence(const QByteArray& finish)
 {
-  m_finishSequence    = finish;
-  m_finishSequenceLps = m_circularBuffer.buildKMPTable(m_finishSequence);
+  m_finishSequence = finish;
+  if (m_finishSequence.size() > CircularBuffer<QByteArray, char>::kShortPatternLength)
+    m_finishSequenceLps = m_circularBuffer.buildKMPTable(m_finishSequence);
+  else
+    m_finishSequenceLps.clear();
+
+  resetScanStates();
 }
 
 /**
@@ -201,6 +310,7 @@ void IO::FrameReader::setOperationMode(const SerialStudio::OperationMode mode)
   m_operationMode = mode;
   if (m_operationMode != SerialStudio::ProjectFile) {
     m_checksumLength = 0;
+    m_checksumFunc   = nullptr;
     m_checksum       = QLatin1String("");
   }
 }
@@ -231,9 +341,13 @@ void IO::FrameReader::setFrameDetectionMode(const SerialStudio::FrameDetection m
  * before the delimiter, validates the trailing checksum, and emits the frame
  * if valid.
  *
- * - In Quick Plot: searches for the first matching end delimiter from a list.
+ * - In Quick Plot: finds the first CR or LF in a single pass; a CR directly
+ *   followed by LF is treated as one CRLF delimiter.
  * - In Project mode: uses a single configured delimiter.
  *
+ * Both searches resume from the position reached by the previous call, so a
+ * frame that arrives in many small chunks is only scanned once.
+ *
  * The checksum is expected immediately after the delimiter.
  */
 void IO::FrameReader::readEndDelimitedFrames()
@@ -247,25 +361,22 @@ void IO::FrameReader::readEndDelimitedFrames()
   while (iterations < kMaxFramesPerCall) {
     ++iterations;
 
-    int endIndex = -1;
-    QByteArray delimiter;
+    int endIndex            = -1;
+    qsizetype delimiterSize = 0;
 
     if (m_operationMode == SerialStudio::QuickPlot) {
-      for (int i = 0; i < m_quickPlotEndSequences.size(); ++i) {
-        const auto& d   = m_quickPlotEndSequences[i];
-        const auto& lps = m_quickPlotEndSequenceLps[i];
-        int index       = m_circularBuffer.findPatternKMP(d, lps);
-        if (index != -1 && (endIndex == -1 || index < endIndex)) {
-          endIndex  = index;
-          delimiter = d;
-          break;
-        }
+      endIndex = m_circularBuffer.findFirstOf(m_quickPlotLineEndings, m_lineScan);
+      if (endIndex != -1) {
+        delimiterSize = 1;
+        if (m_circularBuffer[endIndex] == '\r' && endIndex + 1 < m_circularBuffer.size()
+            && m_circularBuffer[endIndex + 1] == '\n')
+          delimiterSize = 2;
       }
     }
 
     else if (m_frameDetectionMode == SerialStudio::EndDelimiterOnly) {
-      delimiter = m_finishSequence;
-      endIndex  = m_circularBuffer.findPatternKMP(delimiter, m_finishSequenceLps);
+      delimiterSize = m_finishSequence.size();
+      endIndex = m_circularBuffer.findPattern(m_finishSequence, m_finishSequenceLps, m_finishScan);
     }
 
     // No frame found
@@ -273,18 +384,16 @@ void IO::FrameReader::readEndDelimitedFrames()
       break;
 
     // Extract frame data
-    const auto frame       = m_circularBuffer.peek(endIndex);
-    const auto crcPosition = endIndex + delimiter.size();
+    const auto crcPosition = endIndex + delimiterSize;
     const auto frameEndPos = crcPosition + m_checksumLength;
+    m_circularBuffer.peekInto(0, endIndex, m_frame);
 
     // Validate checksum and enqueue if valid
-    if (!frame.isEmpty()) {
-      auto result = checksum(frame, crcPosition);
+    if (!m_frame.isEmpty()) {
+      auto result = checksum(m_frame, crcPosition);
       if (result == ValidationStatus::FrameOk) {
-        if (!m_queue.try_enqueue(std::move(frame))) [[unlikely]]
-          qWarning() << "[FrameReader] Frame queue full — frame dropped";
-
-        (void)m_circularBuffer.read(frameEndPos);
+        enqueueFrame();
+        consume(frameEndPos);
       }
 
       // Incomplete data to calculate checksum
@@ -293,12 +402,12 @@ void IO::FrameReader::readEndDelimitedFrames()
 
       // Incorrect checksum
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        consume(frameEndPos);
     }
 
     // Invalid frame
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
   }
 
   if (iterations >= kMaxFramesPerCall) [[unlikely]]
@@ -313,9 +422,10 @@ void IO::FrameReader::readEndDelimitedFrames()
  * is inferred from the gap between two consecutive start delimiters.
  *
  * Data is buffered until a second start delimiter arrives, ensuring that slow
- * byte-by-byte streams do not produce truncated frames. A checksum, if
- * configured, is expected at the end of each frame and is excluded from the
- * emitted data.
+ * byte-by-byte streams do not produce truncated frames. The search for the
+ * second delimiter keeps its own scan state, so waiting for it does not
+ * rescan the partial frame on every call. A checksum, if configured, is
+ * expected at the end of each frame and is excluded from the emitted data.
  */
 void IO::FrameReader::readStartDelimitedFrames()
 {
@@ -327,17 +437,17 @@ void IO::FrameReader::readStartDelimitedFrames()
   while (iterations < kMaxFramesPerCall) {
     ++iterations;
 
-    int startIndex = m_circularBuffer.findPatternKMP(m_startSequence, m_startSequenceLps);
+    int startIndex = m_circularBuffer.findPattern(m_startSequence, m_startSequenceLps, m_startScan);
     if (startIndex == -1)
       break;
 
     // Discard any bytes before the first start delimiter
     if (startIndex > 0)
-      (void)m_circularBuffer.read(startIndex);
+      consume(startIndex);
 
     // Locate the next start delimiter to determine frame boundary
-    int nextStartIndex =
-      m_circularBuffer.findPatternKMP(m_startSequence, m_startSequenceLps, m_startSequence.size());
+    int nextStartIndex = m_circularBuffer.findPattern(
+      m_startSequence, m_startSequenceLps, m_nextStartScan, m_startSequence.size());
 
     // No second start delimiter found — wait for more data
     if (nextStartIndex == -1)
@@ -350,27 +460,26 @@ void IO::FrameReader::readStartDelimitedFrames()
 
     // Empty frame, discard and advance to the next start delimiter
     if (frameLength <= 0) {
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
       continue;
     }
 
     // Compute the position of the checksum, and sanity check it
     const auto crcPosition = frameEndPos - m_checksumLength;
     if (crcPosition < frameStart) {
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
       continue;
     }
 
     // Extract payload excluding checksum bytes
-    const auto frame = m_circularBuffer.peekRange(frameStart, frameLength - m_checksumLength);
+    m_circularBuffer.peekInto(frameStart, frameLength - m_checksumLength, m_frame);
 
     // Validate checksum and enqueue if valid
-    if (!frame.isEmpty()) {
-      const auto result = checksum(frame, crcPosition);
+    if (!m_frame.isEmpty()) {
+      const auto result = checksum(m_frame, crcPosition);
       if (result == ValidationStatus::FrameOk) {
-        if (!m_queue.try_enqueue(std::move(frame))) [[unlikely]]
-          qWarning() << "[FrameReader] Frame queue full — frame dropped";
-        (void)m_circularBuffer.read(frameEndPos);
+        enqueueFrame();
+        consume(frameEndPos);
       }
 
       // Not enough bytes yet to compute checksum, wait for more
@@ -379,12 +488,12 @@ void IO::FrameReader::readStartDelimitedFrames()
 
       // Invalid checksum...discard and move on
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        consume(frameEndPos);
     }
 
     // Empty frame or invalid data, discard...
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
   }
 
   if (iterations >= kMaxFramesPerCall) [[unlikely]]
@@ -411,34 +520,34 @@ void IO::FrameReader::readStartEndDelimitedFrames()
   while (iterations < kMaxFramesPerCall) {
     ++iterations;
 
-    int finishIndex = m_circularBuffer.findPatternKMP(m_finishSequence, m_finishSequenceLps);
+    int finishIndex =
+      m_circularBuffer.findPattern(m_finishSequence, m_finishSequenceLps, m_finishScan);
     if (finishIndex == -1)
       break;
 
-    int startIndex = m_circularBuffer.findPatternKMP(m_startSequence, m_startSequenceLps);
+    int startIndex = m_circularBuffer.findPattern(m_startSequence, m_startSequenceLps, m_startScan);
     if (startIndex == -1 || startIndex >= finishIndex) {
-      (void)m_circularBuffer.read(finishIndex + m_finishSequence.size());
+      consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
     qsizetype frameStart  = startIndex + m_startSequence.size();
     qsizetype frameLength = finishIndex - frameStart;
     if (frameLength <= 0) {
-      (void)m_circularBuffer.read(finishIndex + m_finishSequence.size());
+      consume(finishIndex + m_finishSequence.size());
       continue;
     }
 
     const auto crcPosition = finishIndex + m_finishSequence.size();
     const auto frameEndPos = crcPosition + m_checksumLength;
-    const auto frame       = m_circularBuffer.peekRange(frameStart, frameLength);
+    m_circularBuffer.peekInto(frameStart, frameLength, m_frame);
 
     // Validate checksum and enqueue if valid
-    if (!frame.isEmpty()) {
-      auto result = checksum(frame, crcPosition);
+    if (!m_frame.isEmpty()) {
+      auto result = checksum(m_frame, crcPosition);
       if (result == ValidationStatus::FrameOk) {
-        if (!m_queue.try_enqueue(std::move(frame))) [[unlikely]]
-          qWarning() << "[FrameReader] Frame queue full — frame dropped";
-        (void)m_circularBuffer.read(frameEndPos);
+        enqueueFrame();
+        consume(frameEndPos);
       }
 
       // Incomplete data to calculate checksum
@@ -447,18 +556,152 @@ void IO::FrameReader::readStartEndDelimitedFrames()
 
       // Incorrect checksum
       else
-        (void)m_circularBuffer.read(frameEndPos);
+        consume(frameEndPos);
     }
 
     // Invalid frame
     else
-      (void)m_circularBuffer.read(frameEndPos);
+      consume(frameEndPos);
   }
 
   if (iterations >= kMaxFramesPerCall) [[unlikely]]
     qWarning() << "[FrameReader] Loop iteration limit reached in readStartEndDelimitedFrames";
 }
 
+/**
+ * @brief Enqueues a datagram that carries exactly one frame.
+ *
+ * The datagram is laid out like a frame in the byte stream: an optional start
+ * sequence, the payload, an optional finish sequence and the checksum (if one
+ * is configured). The checksum is always taken from the last bytes of the
+ * datagram; the delimiters are stripped when present, but are not required,
+ * since the datagram boundary already marks the frame.
+ *
+ * In passthrough mode (no delimiters) the datagram is enqueued unchanged.
+ *
+ * @param data Pointer to the first byte of the datagram.
+ * @param size Length of the datagram in bytes.
+ */
+void IO::FrameReader::enqueueDatagram(const char* data, qsizetype size)
+{
+  Q_ASSERT(size >= 0);
+  Q_ASSERT(data != nullptr || size == 0);
+
+  // Passthrough mode, the datagram is the frame
+  if (m_operationMode == SerialStudio::ProjectFile
+      && m_frameDetectionMode == SerialStudio::NoDelimiters) {
+    if (size > 0) {
+      m_frame.resize(size);
+      std::memcpy(m_frame.data(), data, static_cast<size_t>(size));
+      enqueueFrame();
+    }
+
+    return;
+  }
+
+  // Split off the trailing checksum
+  if (size <= m_checksumLength)
+    return;
+
+  QByteArrayView payload(data, size - m_checksumLength);
+  const QByteArrayView received(data + payload.size(), m_checksumLength);
+
+  // Strip line endings in Quick Plot mode
+  if (m_operationMode == SerialStudio::QuickPlot) {
+    while (!payload.isEmpty() && (payload.back() == '\r' || payload.back() == '\n'))
+      payload.chop(1);
+  }
+
+  // Strip the start and finish sequences used by the current mode
+  else {
+    const bool json      = m_operationMode == SerialStudio::DeviceSendsJSON;
+    const bool hasStart  = json || m_frameDetectionMode == SerialStudio::StartDelimiterOnly
+                        || m_frameDetectionMode == SerialStudio::StartAndEndDelimiter;
+    const bool hasFinish = json || m_frameDetectionMode == SerialStudio::EndDelimiterOnly
+                        || m_frameDetectionMode == SerialStudio::StartAndEndDelimiter;
+
+    if (hasStart && !m_startSequence.isEmpty() && payload.startsWith(m_startSequence))
+      payload = payload.sliced(m_startSequence.size());
+
+    if (hasFinish && !m_finishSequence.isEmpty() && payload.endsWith(m_finishSequence))
+      payload.chop(m_finishSequence.size());
+  }
+
+  // Nothing left to parse
+  if (payload.isEmpty())
+    return;
+
+  // Validate checksum
+  if (m_checksumLength > 0 && m_checksumFunc) {
+    const auto calculated = m_checksumFunc(payload.data(), static_cast<int>(payload.size()));
+    if (QByteArrayView(calculated) != received) {
+      reportChecksumError(payload.toByteArray(), received.toByteArray(), calculated);
+      return;
+    }
+  }
+
+  // Copy the payload into the pooled frame buffer and enqueue it
+  m_frame.resize(payload.size());
+  std::memcpy(m_frame.data(), payload.data(), static_cast<size_t>(payload.size()));
+  enqueueFrame();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Scan state bookkeeping
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Discards the progress of all incremental delimiter searches.
+ *
+ * Called when the delimiters change or when the circular buffer overwrote
+ * unread data, since logical offsets no longer refer to the same bytes.
+ */
+void IO::FrameReader::resetScanStates()
+{
+  m_lineScan.reset();
+  m_startScan.reset();
+  m_finishScan.reset();
+  m_nextStartScan.reset();
+}
+
+/**
+ * @brief Hands the working frame buffer to the consumer queue.
+ *
+ * The buffer is moved (not copied) into the queue and replaced by a recycled
+ * one from the frame pool, so steady-state extraction does not allocate.
+ * If the pool is empty, the next peekInto() allocates a fresh buffer.
+ */
+void IO::FrameReader::enqueueFrame()
+{
+  if (!m_queue.try_enqueue(std::move(m_frame))) [[unlikely]] {
+    qWarning() << "[FrameReader] Frame queue full — frame dropped";
+    return;
+  }
+
+  if (!m_framePool.try_dequeue(m_frame))
+    m_frame = QByteArray();
+}
+
+/**
+ * @brief Removes @p bytes from the buffer head and shifts all scan states.
+ *
+ * Every head advance must go through this function so the persisted search
+ * cursors keep pointing at the same bytes.
+ *
+ * @param bytes Number of bytes to remove.
+ */
+void IO::FrameReader::consume(qsizetype bytes)
+{
+  Q_ASSERT(bytes >= 0);
+
+  m_circularBuffer.skip(bytes);
+
+  m_lineScan.consume(bytes);
+  m_startScan.consume(bytes);
+  m_finishScan.consume(bytes);
+  m_nextStartScan.consume(bytes);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Checksum validation function
 //--------------------------------------------------------------------------------------------------
@@ -483,7 +726,7 @@ IO::ValidationStatus IO::FrameReader::checksum(const QByteArray& frame, qsizetyp
   Q_ASSERT(crcPosition >= 0);
 
   // No checksum configured, always valid
-  if (m_checksumLength == 0)
+  if (m_checksumLength == 0 || !m_checksumFunc)
     return ValidationStatus::FrameOk;
 
   // Not enough data to read checksum bytes yet
@@ -491,11 +734,26 @@ IO::ValidationStatus IO::FrameReader::checksum(const QByteArray& frame, qsizetyp
   if (bufferSize < crcPosition + m_checksumLength)
     return ValidationStatus::ChecksumIncomplete;
 
-  const auto calculated     = IO::checksum(m_checksum, frame);
+  const auto calculated     = m_checksumFunc(frame.constData(), static_cast<int>(frame.size()));
   const QByteArray received = m_circularBuffer.peekRange(crcPosition, m_checksumLength);
   if (calculated == received)
     return ValidationStatus::FrameOk;
 
+  reportChecksumError(frame, received, calculated);
+  return ValidationStatus::ChecksumError;
+}
+
+/**
+ * @brief Logs a checksum mismatch, truncating long frames.
+ *
+ * @param frame The frame payload that failed validation.
+ * @param received The checksum bytes sent by the device.
+ * @param calculated The checksum computed over @p frame.
+ */
+void IO::FrameReader::reportChecksumError(const QByteArray& frame,
+                                          const QByteArray& received,
+                                          const QByteArray& calculated) const
+{
   static constexpr qsizetype kMaxLogBytes = 128;
   qWarning() << "\n"
              << m_checksum << "failed:\n"
@@ -503,6 +761,4 @@ IO::ValidationStatus IO::FrameReader::checksum(const QByteArray& frame, qsizetyp
              << "\t- Calculated:" << calculated.toHex(' ') << "\n"
              << "\t- Frame:" << frame.left(kMaxLogBytes).toHex(' ')
              << (frame.size() > kMaxLogBytes ? "...(truncated)" : "");
-
-  return ValidationStatus::ChecksumError;
 }
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <QByteArray>
 #include <QObject>
@@ -28,6 +29,7 @@
 #include <vector>
 
 #include "HAL_Driver.h"
+#include "IO/Checksum.h"
 #include "IO/CircularBuffer.h"
 #include "SerialStudio.h"
 #include "ThirdParty/readerwriterqueue.h"
@@ -48,11 +50,32 @@ enum class ValidationStatus {
  * handling, such as quick plotting, JSON extraction, and project-specific
  * parsing.
  *
- * **Runs on the main thread.** Historically this class was moved to a
- * worker thread via m_threadedExtraction; that path was removed (see
- * beeda4c0). HAL drivers may still emit dataReceived() from their own
- * read threads — the AutoConnection on processData() resolves to a
- * queued hop when that happens.
+ * **Runs on a dedicated ingest thread.** DeviceManager owns one QThread per
+ * device and moves the FrameReader onto it, so delimiter scanning and
+ * checksum validation keep draining the circular buffer even when the GUI
+ * event loop is stalled by QML layout or a heavy repaint. HAL drivers emit
+ * dataReceived() from the main thread or from their own read threads;
+ * DeviceManager connects them to processData() with Qt::QueuedConnection, so
+ * every chunk hops onto the ingest thread.
+ *
+ * Only frame extraction runs on the ingest thread. Frame parsing, dataset
+ * transforms and the hand-off to the CSV/MDF4 export workers still run on the
+ * main thread, so a stalled GUI delays them; extracted frames wait in the
+ * queue meanwhile.
+ *
+ * Message-oriented drivers deliver whole batches of datagrams through
+ * processDatagrams(). Unless the batch is marked as framed, its payloads are
+ * treated as one contiguous chunk of the stream. Framed batches carry exactly
+ * one frame per datagram, so delimiter scanning is skipped altogether.
+ *
+ * Extracted frames are handed to the main thread through the SPSC queue().
+ * Frame buffers travel back through a second SPSC queue (recycleFrame()), so
+ * steady-state extraction reuses the same allocations.
+ * readyRead() is coalesced: it is emitted once when the queue goes from
+ * "drained" to "has data", and re-armed by the consumer through
+ * acknowledgeReadyRead() right before it drains the queue. A stalled GUI
+ * therefore receives a single queued notification instead of one per
+ * processData() call.
  *
  * **Thread Safety Model:**
  * This class achieves thread safety through immutability rather than locks.
@@ -61,11 +84,12 @@ enum class ValidationStatus {
  * DeviceManager::reconfigure()). This ensures:
  *
  * - Configuration is set ONCE on the FrameReader via setters before any
- *   data is routed through it
+ *   data is routed through it (and before it is moved to its thread)
  * - No configuration changes occur during the FrameReader's lifetime
  * - processData() can safely read member variables without synchronization
  *
- * DO NOT add mutexes or atomic operations to this class. If configuration
+ * DO NOT add mutexes to this class. The only cross-thread state is the
+ * SPSC frame queue, its recycling pool and the readyRead() coalescing flag. If configuration
  * needs to change, destroy this instance and create a new one with updated
  * settings via ConnectionManager::resetFrameReader().
  *
@@ -85,12 +109,17 @@ public:
 
   inline void resetOverflowCount() { m_circularBuffer.resetOverflowCount(); }
 
+  inline void acknowledgeReadyRead() { m_readyReadPending.store(false, std::memory_order_release); }
+
   inline moodycamel::ReaderWriterQueue<QByteArray>& queue() { return m_queue; }
 
+  void recycleFrame(QByteArray& frame);
+
   inline qsizetype overflowCount() const { return m_circularBuffer.overflowCount(); }
 
 public slots:
   void processData(const IO::ByteArrayPtr& data);
+  void processDatagrams(const IO::DatagramBatchPtr& batch);
 
   void setChecksum(const QString& checksum);
   void setStartSequence(const QByteArray& start);
@@ -99,24 +128,42 @@ public slots:
   void setFrameDetectionMode(const SerialStudio::FrameDetection mode);
 
 private:
+  bool ingest(const QByteArray& data);
+  void enqueueDatagram(const char* data, qsizetype size);
+
   void readEndDelimitedFrames();
   void readStartDelimitedFrames();
   void readStartEndDelimitedFrames();
 
+  void enqueueFrame();
+  void notifyReadyRead();
+  void resetScanStates();
+  void consume(qsizetype bytes);
+
   ValidationStatus checksum(const QByteArray& frame, qsizetype crcPosition);
+  void reportChecksumError(const QByteArray& frame,
+                           const QByteArray& received,
+                           const QByteArray& calculated) const;
 
 private:
   QString m_checksum;
+  ChecksumFunc m_checksumFunc;
   qsizetype m_checksumLength;
   QByteArray m_startSequence;
   QByteArray m_finishSequence;
-  QVector<QByteArray> m_quickPlotEndSequences;
+  QByteArray m_quickPlotLineEndings;
   std::vector<int> m_startSequenceLps;
   std::vector<int> m_finishSequenceLps;
-  QVector<std::vector<int>> m_quickPlotEndSequenceLps;
+  ScanState m_lineScan;
+  ScanState m_startScan;
+  ScanState m_finishScan;
+  ScanState m_nextStartScan;
   SerialStudio::OperationMode m_operationMode;
   SerialStudio::FrameDetection m_frameDetectionMode;
   CircularBuffer<QByteArray, char> m_circularBuffer;
-  moodycamel::ReaderWriterQueue<QByteArray> m_queue{4096};
+  std::atomic<bool> m_readyReadPending;
+  QByteArray m_frame;
+  moodycamel::ReaderWriterQueue<QByteArray> m_queue{16384};
+  moodycamel::ReaderWriterQueue<QByteArray> m_framePool{1024};
 };
 }  // namespace IO
@@ -28,6 +28,7 @@
 #include <QObject>
 #include <QString>
 #include <QVariant>
+#include <vector>
 
 namespace IO {
 
@@ -36,6 +37,9 @@ namespace IO {
  *
  * Drivers return a flat list of these from driverProperties() so that the
  * ProjectEditor can build a generic form model without knowing the bus type.
+ *
+ * Read-only entries report live driver status (e.g. throughput counters). They
+ * are displayed but never persisted to the project or applied to a driver.
  */
 struct DriverProperty {
   enum Type {
@@ -55,6 +59,7 @@ struct DriverProperty {
   QStringList options;
   QVariant min;
   QVariant max;
+  bool readOnly = false;
 };
 
 /**
@@ -121,6 +126,43 @@ typedef std::shared_ptr<const QByteArray> ByteArrayPtr;
   return std::make_shared<const QByteArray>(std::move(data));
 }
 
+/**
+ * @brief A group of datagrams received in a single wakeup.
+ *
+ * Message-oriented drivers (such as UDP sockets) can drain many datagrams at
+ * once. Instead of emitting one signal per datagram, the payloads are packed
+ * back-to-back into a single byte array and delivered together.
+ *
+ * - `data` holds the concatenated payloads.
+ * - `ends` holds the end offset of every datagram within `data`, so datagram
+ *   `i` spans `[ends[i - 1], ends[i])` (with an implicit start of 0).
+ * - `framed` is set when every datagram carries exactly one frame, which lets
+ *   the frame reader skip delimiter scanning.
+ *
+ * Batches are immutable once emitted and may be recycled by the driver as soon
+ * as every consumer has released its reference. Consumers that keep the bytes
+ * beyond that point must take payload(), never a copy of `data`: an implicit
+ * share would make the driver reallocate the whole slab when it refills it.
+ */
+struct DatagramBatch {
+  QByteArray data;
+  std::vector<qsizetype> ends;
+  bool framed = false;
+
+  /**
+   * @brief Returns a deep copy of the packed payloads, without slab capacity.
+   */
+  [[nodiscard]] QByteArray payload() const
+  {
+    return QByteArray(data.constData(), data.size());
+  }
+};
+
+/**
+ * @brief Type alias for shared datagram batches, see IO::ByteArrayPtr.
+ */
+typedef std::shared_ptr<const DatagramBatch> DatagramBatchPtr;
+
 /**
  * @class HAL_Driver
  * @brief Abstract base class for hardware abstraction layer drivers.
@@ -191,6 +233,16 @@ signals:
    */
   void dataReceived(const IO::ByteArrayPtr& data);
 
+  /**
+   * @brief Emitted when a batch of datagrams is ready.
+   *
+   * Drivers deliver every received chunk through exactly one of
+   * dataReceived() or datagramsReceived(), never both.
+   *
+   * @param batch The received datagrams (shared pointer for zero-copy distribution).
+   */
+  void datagramsReceived(const IO::DatagramBatchPtr& batch);
+
 public:
   /**
    * @brief Constructor.
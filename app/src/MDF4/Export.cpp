@@ -23,6 +23,7 @@
 
 #include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 #include <QTimer>
 
 #include "Misc/Utilities.h"
@@ -39,6 +40,7 @@
 #  include "AppState.h"
 #  include "CSV/Player.h"
 #  include "DataModel/FrameBuilder.h"
+#  include "DataModel/Reprocessor.h"
 #  include "IO/ConnectionManager.h"
 #  include "Licensing/CommercialToken.h"
 #  include "Licensing/LemonSqueezy.h"
@@ -59,8 +61,18 @@
 MDF4::ExportWorker::ExportWorker(
   moodycamel::ReaderWriterQueue<DataModel::TimestampedFramePtr>* queue,
   std::atomic<bool>* enabled,
-  std::atomic<size_t>* queueSize)
-  : FrameConsumerWorker(queue, enabled, queueSize), m_fileOpen(false)
+  std::atomic<size_t>* queueSize,
+  const std::atomic<bool>* compress)
+  : FrameConsumerWorker(queue, enabled, queueSize)
+  , m_fileOpen(false)
+  , m_compress(compress)
+  , m_compressed(false)
+  , m_framesWritten(0)
+  , m_samplesWritten(0)
+  , m_rawBytes(0)
+  , m_fileBytes(0)
+  , m_writeNs(0)
+  , m_openMs(0)
 {}
 
 /**
@@ -76,26 +88,59 @@ bool MDF4::ExportWorker::isResourceOpen() const
   return m_fileOpen;
 }
 
+/**
+ * @brief Returns the write counters of the current (or last) file.
+ *
+ * Safe to call from any thread. @c rawBytes counts the uncompressed record
+ * bytes handed to the writer, @c writeThroughput is that amount divided by the
+ * time spent in the write path, and @c dataRate divides it by the time
+ * the file has been open. The file size lags behind the raw counter, since
+ * mdflib writes its sample queue to disk from its own thread.
+ */
+QJsonObject MDF4::ExportWorker::writeStats() const
+{
+  const auto rawBytes  = m_rawBytes.load(std::memory_order_relaxed);
+  const auto fileBytes = m_fileBytes.load(std::memory_order_relaxed);
+  const auto writeNs   = m_writeNs.load(std::memory_order_relaxed);
+  const auto openMs    = m_openMs.load(std::memory_order_relaxed);
+
+  constexpr double kMiB = 1024.0 * 1024.0;
+  const double rawMiB   = static_cast<double>(rawBytes) / kMiB;
+
+  QJsonObject result;
+  result[QStringLiteral("compressed")]     = m_compressed.load(std::memory_order_relaxed);
+  result[QStringLiteral("framesWritten")]  = static_cast<qint64>(m_framesWritten.load());
+  result[QStringLiteral("samplesWritten")] = static_cast<qint64>(m_samplesWritten.load());
+  result[QStringLiteral("rawBytes")]       = static_cast<qint64>(rawBytes);
+  result[QStringLiteral("fileBytes")]      = static_cast<qint64>(fileBytes);
+  result[QStringLiteral("compressionRatio")] =
+    fileBytes > 0 ? static_cast<double>(rawBytes) / static_cast<double>(fileBytes) : 0.0;
+  result[QStringLiteral("writeThroughput")] = writeNs > 0 ? rawMiB * 1e9 / writeNs : 0.0;
+  result[QStringLiteral("dataRate")]        = openMs > 0 ? rawMiB * 1e3 / openMs : 0.0;
+  return result;
+}
+
 /**
  * @brief Processes a batch of MDF4 frames
  *
- * Writes frames to MDF4 file using the mdflib writer.
+ * Writes one record per channel group and frame straight to the measurement.
  * If no file is open, a new file is created before writing.
  *
  * @param items Vector of timestamped frames to process.
  */
 void MDF4::ExportWorker::processItems(const std::vector<DataModel::TimestampedFramePtr>& items)
 {
-  // Skip empty batches or when disconnected
+  // Skip empty batches or when disconnected (batch reprocessing has no device)
   if (items.empty())
     return;
 
-  if (!IO::ConnectionManager::instance().isConnected())
+  if (!IO::ConnectionManager::instance().isConnected()
+      && !DataModel::Reprocessor::instance().isRunning())
     return;
 
   // Create the output file on first batch
   if (!isResourceOpen() && !items.empty()) {
-    createFile(items.front()->data);
+    createFile(*items.front()->schema);
     m_steadyBaseline = items.front()->timestamp;
     m_systemBaseline = std::chrono::system_clock::now();
   }
@@ -103,45 +148,87 @@ void MDF4::ExportWorker::processItems(const std::vector<DataModel::TimestampedFr
   if (!isResourceOpen() || !m_writer)
     return;
 
-  auto writeDatasets = [](const DataModel::Group& group, ChannelGroupInfo& info) {
-    for (size_t i = 0; i < group.datasets.size(); ++i) {
-      const auto& dataset = group.datasets.at(i);
-      auto* channel       = info.channels[i];
-      if (info.isNumeric[i])
-        channel->SetChannelValue(dataset.numericValue);
-      else
-        channel->SetChannelValue(dataset.value.toStdString());
-    }
-  };
+  QElapsedTimer timer;
+  timer.start();
 
   // Guard mdflib calls against exceptions propagating through Qt's event loop
+  quint64 samples  = 0;
+  quint64 rawBytes = 0;
   try {
     for (const auto& frame : items) {
+      if (frame->schema != m_slotSchema) [[unlikely]]
+        resolveSlots(frame->schema);
+
       const auto steadyOffset = frame->timestamp - m_steadyBaseline;
       const auto systemTime   = m_systemBaseline + steadyOffset;
       const auto timestamp_ns =
         std::chrono::duration_cast<std::chrono::nanoseconds>(systemTime.time_since_epoch()).count();
-      const double timestamp_s = static_cast<double>(timestamp_ns) / 1'000'000'000.0;
 
-      for (const auto& group : frame->data.groups) {
-        auto it = m_groupMap.find(group.groupId);
-        if (it == m_groupMap.end())
-          continue;
+      // Write one record per channel group
+      const auto time_ns = static_cast<uint64_t>(timestamp_ns);
 
-        auto& info = it->second;
-        if (group.datasets.size() != info.channels.size())
+      for (const auto& slot : m_slots) {
+        auto* info = slot.info;
+        if (!info || slot.first + info->channels.size() > frame->values.size()) [[unlikely]]
           continue;
 
-        if (info.timeChannel)
-          info.timeChannel->SetChannelValue(timestamp_s);
+        if (info->timeChannel)
+          info->timeChannel->SetChannelValue(static_cast<double>(time_ns) / 1'000'000'000.0);
+
+        const auto* values = frame->values.data() + slot.first;
+        for (size_t i = 0; i < info->channels.size(); ++i) {
+          if (info->isNumeric[i])
+            info->channels[i]->SetChannelValue(values[i].numericValue);
+          else
+            info->channels[i]->SetChannelValue(DataModel::dataset_text(values[i]).toStdString());
+        }
 
-        writeDatasets(group, info);
-        m_writer->SaveSample(*info.channelGroup, static_cast<uint64_t>(timestamp_ns));
+        m_writer->SaveSample(*info->channelGroup, time_ns);
+
+        ++samples;
+        rawBytes += info->recordBytes;
       }
     }
   } catch (const std::exception& e) {
     qWarning() << "[MDF4] Exception in processItems:" << e.what();
   }
+
+  m_writeNs.fetch_add(timer.nsecsElapsed(), std::memory_order_relaxed);
+  m_framesWritten.fetch_add(items.size(), std::memory_order_relaxed);
+  m_samplesWritten.fetch_add(samples, std::memory_order_relaxed);
+  m_rawBytes.fetch_add(rawBytes, std::memory_order_relaxed);
+  m_fileBytes.store(static_cast<quint64>(QFileInfo(m_filePath).size()), std::memory_order_relaxed);
+  m_openMs.store(m_openTime.elapsed(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Maps the groups of a frame schema to their channel groups.
+ *
+ * Values are stored flat, in schema order, so each slot records the offset of
+ * its group's first value. Groups without a channel group (e.g. image groups),
+ * or whose dataset count differs from the file layout, get a null slot. The
+ * schema only changes when the project does, so this replaces a map lookup
+ * per group and frame.
+ */
+void MDF4::ExportWorker::resolveSlots(const DataModel::FrameSchemaPtr& schema)
+{
+  m_slots.clear();
+  m_slotSchema = schema;
+  if (!schema)
+    return;
+
+  size_t offset = 0;
+  m_slots.reserve(schema->groups.size());
+  for (const auto& group : schema->groups) {
+    GroupSlot slot{nullptr, offset};
+    offset += group.datasets.size();
+
+    auto it = m_groupMap.find(group.groupId);
+    if (it != m_groupMap.end() && it->second.channels.size() == group.datasets.size())
+      slot.info = &it->second;
+
+    m_slots.push_back(slot);
+  }
 }
 
 /**
@@ -167,7 +254,11 @@ void MDF4::ExportWorker::closeResources()
     // Release writer and clear state
     m_fileOpen = false;
     m_writer.reset();
+    m_slots.clear();
+    m_slotSchema.reset();
     m_groupMap.clear();
+    m_fileBytes.store(static_cast<quint64>(QFileInfo(m_filePath).size()),
+                      std::memory_order_relaxed);
     DataModel::clear_frame(m_templateFrame);
   }
 }
@@ -212,6 +303,10 @@ void MDF4::ExportWorker::createFile(const DataModel::Frame& frame)
 
     m_writer->Init(m_filePath.toStdString());
 
+    // Store the data as deflate-compressed DZ blocks instead of a DT block
+    const bool compress = m_compress->load(std::memory_order_relaxed);
+    m_writer->CompressData(compress);
+
     auto* header = m_writer->Header();
     if (!header)
       return;
@@ -254,6 +349,7 @@ void MDF4::ExportWorker::createFile(const DataModel::Frame& frame)
       ChannelGroupInfo info;
       info.channelGroup = channelGroup;
       info.timeChannel  = nullptr;
+      info.recordBytes  = 8;
 
       // Add per-group master time channel for multi-source recordings
       auto* timeChannel = channelGroup->CreateChannel();
@@ -285,11 +381,13 @@ void MDF4::ExportWorker::createFile(const DataModel::Frame& frame)
         if (isNum) {
           channel->DataType(mdf::ChannelDataType::FloatLe);
           channel->DataBytes(8);
+          info.recordBytes += 8;
         }
 
         else {
           channel->DataType(mdf::ChannelDataType::StringAscii);
           channel->DataBytes(256);
+          info.recordBytes += 256;
         }
 
         info.channels.push_back(channel);
@@ -302,6 +400,16 @@ void MDF4::ExportWorker::createFile(const DataModel::Frame& frame)
     m_writer->InitMeasurement();
     m_writer->StartMeasurement(dateTime.toMSecsSinceEpoch() * 1000000);
 
+    // Reset the write counters for the new file
+    m_compressed.store(compress, std::memory_order_relaxed);
+    m_framesWritten.store(0, std::memory_order_relaxed);
+    m_samplesWritten.store(0, std::memory_order_relaxed);
+    m_rawBytes.store(0, std::memory_order_relaxed);
+    m_fileBytes.store(0, std::memory_order_relaxed);
+    m_writeNs.store(0, std::memory_order_relaxed);
+    m_openMs.store(0, std::memory_order_relaxed);
+    m_openTime.start();
+
     m_fileOpen = true;
     Q_EMIT resourceOpenChanged();
   }
@@ -332,10 +440,16 @@ MDF4::Export::Export()
       {.queueCapacity = 8192, .flushThreshold = 1024, .timerIntervalMs = 1000})
   , m_isOpen(false)
   , m_exportEnabled(false)
+  , m_compressionEnabled(true)
 #else
-  : m_isOpen(false), m_exportEnabled(false)
+  : m_isOpen(false)
+  , m_exportEnabled(false)
+  , m_compressionEnabled(true)
 #endif
 {
+  // Restore the writer options before the worker reads them
+  m_compressionEnabled.store(m_settings.value("MDF4Compression", true).toBool());
+
 #ifdef BUILD_COMMERCIAL
   // Wire worker file-state and license-revocation signals
   initializeWorker();
@@ -372,7 +486,7 @@ MDF4::Export::~Export() = default;
  */
 DataModel::FrameConsumerWorkerBase* MDF4::Export::createWorker()
 {
-  return new ExportWorker(&m_pendingQueue, &m_consumerEnabled, &m_queueSize);
+  return new ExportWorker(&m_pendingQueue, &m_consumerEnabled, &m_queueSize, &m_compressionEnabled);
 }
 #endif
 
@@ -409,6 +523,27 @@ bool MDF4::Export::exportEnabled() const
 #endif
 }
 
+/**
+ * Returns true if new MDF4 files store their data in compressed DZ blocks.
+ */
+bool MDF4::Export::compressionEnabled() const
+{
+  return m_compressionEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the write counters of the current (or last) MDF4 file: frames,
+ * samples, raw and on-disk bytes, compression ratio and throughput in MiB/s.
+ */
+QJsonObject MDF4::Export::writeStats() const
+{
+#ifdef BUILD_COMMERCIAL
+  return static_cast<const ExportWorker*>(m_worker)->writeStats();
+#else
+  return QJsonObject();
+#endif
+}
+
 /**
  * Write all remaining data & close the output file.
  *
@@ -423,6 +558,22 @@ void MDF4::Export::closeFile()
 #endif
 }
 
+/**
+ * Caches the project frame used to create the MDF4 channel groups. Called when
+ * a device connects and when batch reprocessing starts; the template is only
+ * valid in ProjectFile mode.
+ */
+void MDF4::Export::cacheTemplateFrame()
+{
+#ifdef BUILD_COMMERCIAL
+  auto* worker = static_cast<ExportWorker*>(m_worker);
+  if (AppState::instance().operationMode() == SerialStudio::ProjectFile)
+    worker->m_templateFrame = DataModel::FrameBuilder::instance().frame();
+  else
+    DataModel::clear_frame(worker->m_templateFrame);
+#endif
+}
+
 /**
  * Configures the signal/slot connections with the modules of the application
  * that this module depends upon.
@@ -432,14 +583,8 @@ void MDF4::Export::setupExternalConnections()
 #ifdef BUILD_COMMERCIAL
   connect(
     &IO::ConnectionManager::instance(), &IO::ConnectionManager::connectedChanged, this, [this] {
-      if (IO::ConnectionManager::instance().isConnected()) {
-        // Cache project frame for file creation (only valid in ProjectFile mode)
-        auto* worker = static_cast<ExportWorker*>(m_worker);
-        if (AppState::instance().operationMode() == SerialStudio::ProjectFile)
-          worker->m_templateFrame = DataModel::FrameBuilder::instance().frame();
-        else
-          DataModel::clear_frame(worker->m_templateFrame);
-      }
+      if (IO::ConnectionManager::instance().isConnected())
+        cacheTemplateFrame();
 
       else {
         closeFile();
@@ -452,6 +597,20 @@ void MDF4::Export::setupExternalConnections()
 #endif
 }
 
+/**
+ * Enables or disables DZ block compression. Since the storage layout of a
+ * measurement cannot change while it is being written, the setting applies to
+ * the next file.
+ */
+void MDF4::Export::setCompressionEnabled(const bool enabled)
+{
+  if (compressionEnabled() != enabled) {
+    m_compressionEnabled.store(enabled, std::memory_order_relaxed);
+    m_settings.setValue("MDF4Compression", enabled);
+    Q_EMIT compressionEnabledChanged();
+  }
+}
+
 /**
  * Enables or disables data export.
  */
@@ -23,6 +23,8 @@
 
 #include <map>
 #include <memory>
+#include <QElapsedTimer>
+#include <QJsonObject>
 #include <QObject>
 #include <QSettings>
 #include <vector>
@@ -42,6 +44,11 @@ class Export;
 #ifdef BUILD_COMMERCIAL
 /**
  * @brief Worker that handles MDF4 export file I/O on background thread
+ *
+ * Each batch drained from the queue is written to the measurement as it
+ * arrives, one record per channel group and frame. mdflib packs the records
+ * into DT blocks, or deflate-compressed DZ blocks when compression is
+ * enabled, and writes them to disk from its own thread.
  */
 class ExportWorker : public DataModel::FrameConsumerWorker<DataModel::TimestampedFramePtr> {
   Q_OBJECT
@@ -49,16 +56,20 @@ class ExportWorker : public DataModel::FrameConsumerWorker<DataModel::Timestampe
 public:
   ExportWorker(moodycamel::ReaderWriterQueue<DataModel::TimestampedFramePtr>* queue,
                std::atomic<bool>* enabled,
-               std::atomic<size_t>* queueSize);
+               std::atomic<size_t>* queueSize,
+               const std::atomic<bool>* compress);
   ~ExportWorker() override;
 
   void closeResources() override;
   bool isResourceOpen() const override;
 
+  [[nodiscard]] QJsonObject writeStats() const;
+
 protected:
   void processItems(const std::vector<DataModel::TimestampedFramePtr>& items) override;
 
 private:
+  void resolveSlots(const DataModel::FrameSchemaPtr& schema);
   void createFile(const DataModel::Frame& frame);
 
 private:
@@ -67,6 +78,12 @@ private:
     mdf::IChannel* timeChannel;
     std::vector<mdf::IChannel*> channels;
     std::vector<bool> isNumeric;
+    quint64 recordBytes = 0;
+  };
+
+  struct GroupSlot {
+    ChannelGroupInfo* info;
+    size_t first;
   };
 
 public:
@@ -78,6 +95,20 @@ private:
   std::unique_ptr<mdf::MdfWriter> m_writer;
   std::map<int, ChannelGroupInfo> m_groupMap;
 
+  std::vector<GroupSlot> m_slots;
+  DataModel::FrameSchemaPtr m_slotSchema;
+
+  const std::atomic<bool>* m_compress;
+  QElapsedTimer m_openTime;
+
+  std::atomic<bool> m_compressed;
+  std::atomic<quint64> m_framesWritten;
+  std::atomic<quint64> m_samplesWritten;
+  std::atomic<quint64> m_rawBytes;
+  std::atomic<quint64> m_fileBytes;
+  std::atomic<qint64> m_writeNs;
+  std::atomic<qint64> m_openMs;
+
   DataModel::TimestampedFrame::SteadyTimePoint m_steadyBaseline;
   std::chrono::system_clock::time_point m_systemBaseline;
 };
@@ -99,6 +130,7 @@ private:
  * - **Tool Compatibility**: Compatible with Vector CANape, ETAS INCA, etc.
  * - **Buffered Writing**: Buffers frames and writes periodically to reduce
  *   disk I/O
+ * - **Compression**: Data blocks are optionally stored as DZ (deflate) blocks
  * - **Pro Feature**: Available only in commercial builds with valid license
  * - **Singleton Pattern**: Single instance ensures consistent file handling
  *   across the application
@@ -127,11 +159,16 @@ class Export
              READ exportEnabled
              WRITE setExportEnabled
              NOTIFY enabledChanged)
+  Q_PROPERTY(bool compressionEnabled
+             READ compressionEnabled
+             WRITE setCompressionEnabled
+             NOTIFY compressionEnabledChanged)
   // clang-format on
 
 signals:
   void openChanged();
   void enabledChanged();
+  void compressionEnabledChanged();
 
 private:
   explicit Export();
@@ -147,11 +184,15 @@ public:
 
   [[nodiscard]] bool isOpen() const;
   [[nodiscard]] bool exportEnabled() const;
+  [[nodiscard]] bool compressionEnabled() const;
+  [[nodiscard]] QJsonObject writeStats() const;
 
 public slots:
   void closeFile();
+  void cacheTemplateFrame();
   void setupExternalConnections();
   void setExportEnabled(const bool enabled);
+  void setCompressionEnabled(const bool enabled);
   void hotpathTxFrame(const DataModel::TimestampedFramePtr& frame);
 
 protected:
@@ -168,5 +209,6 @@ private:
   QSettings m_settings;
   std::atomic<bool> m_isOpen;
   std::atomic<bool> m_exportEnabled;
+  std::atomic<bool> m_compressionEnabled;
 };
 }  // namespace MDF4
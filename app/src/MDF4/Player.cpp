@@ -22,6 +22,9 @@
 #include "Player.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <mdf/ichannel.h>
 #include <mdf/ichannelgroup.h>
@@ -45,120 +48,164 @@
 #include "UI/Dashboard.h"
 
 //--------------------------------------------------------------------------------------------------
-// Helper observer classes
+// Helper classes
 //--------------------------------------------------------------------------------------------------
 
 /**
- * @class SampleCacheObserver
- * @brief Observer class that caches channel values during MDF4 data reading
- *
- * This observer is attached to data groups during ReadData() operations.
- * It extracts channel values from incoming sample records and stores them
- * in a cache for efficient random-access playback.
- *
- * When a per-group master time channel is present, the observer reads the
- * timestamp from each record and uses it (quantised to nanoseconds) as the
- * cache key. This allows records from independent channel groups that share
- * the same wall-clock time to be merged correctly — which is essential for
- * multi-source MDF4 files where each source writes its own channel groups.
+ * @brief Number of records between two time-key checkpoints of a channel group.
+ */
+static constexpr uint64_t kCheckpointInterval = 1024;
+
+/**
+ * @brief Quantises a timestamp (in seconds) to the nanosecond key used to
+ *        merge records from independent channel groups into one frame.
+ */
+static inline uint64_t timeKey(const double timestamp)
+{
+  return static_cast<uint64_t>(timestamp * 1'000'000'000.0);
+}
+
+/**
+ * @class MappedFileBuffer
+ * @brief Read-only stream buffer over a memory-mapped file
  *
- * When no per-group time channel is available, the raw sample index is
- * used as the key (backward-compatible with old single-time-channel files).
+ * mdflib reads and skips records through a std::streambuf. With a regular
+ * std::filebuf, every skipped record costs a seek system call, which makes
+ * partial reads deep into a large data group very slow. Serving the reads
+ * from a mapping turns seeks into pointer arithmetic, and leaves caching of
+ * the file contents to the operating system.
  */
-class SampleCacheObserver : public mdf::ISampleObserver {
+class MappedFileBuffer : public std::streambuf {
 public:
-  SampleCacheObserver(const mdf::IDataGroup& dataGroup,
-                      std::map<uint64_t, std::vector<double>>& cache,
-                      std::map<uint64_t, double>& timestampCache,
-                      std::map<uint64_t, std::vector<bool>>& activeChannels,
-                      const std::vector<mdf::IChannel*>& allChannels,
-                      const std::vector<mdf::IChannel*>& groupChannels,
-                      mdf::IChannel* groupTimeChannel,
-                      uint64_t recordId)
-    : mdf::ISampleObserver(dataGroup)
-    , m_cache(cache)
-    , m_timestampCache(timestampCache)
-    , m_activeChannels(activeChannels)
-    , m_allChannels(allChannels)
-    , m_groupChannels(groupChannels)
-    , m_groupTimeChannel(groupTimeChannel)
-    , m_recordId(recordId)
+  MappedFileBuffer(const uchar* data, const qint64 size)
   {
-    for (size_t i = 0; i < m_allChannels.size(); ++i) {
-      for (auto* ch : m_groupChannels) {
-        if (m_allChannels[i] == ch) {
-          m_channelIndexMap[ch] = i;
-          break;
-        }
-      }
-    }
+    auto* begin = reinterpret_cast<char*>(const_cast<uchar*>(data));
+    setg(begin, begin, begin + size);
   }
 
-  bool OnSample(uint64_t sample, uint64_t record_id, const std::vector<uint8_t>& record) override
+protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
   {
-    // Only process records from our own channel group
-    if (record_id != m_recordId)
-      return true;
+    if (!(which & std::ios_base::in))
+      return pos_type(off_type(-1));
 
-    // Use timestamp (ns) as cache key when available, else raw sample index
-    uint64_t cacheKey = sample;
-    if (m_groupTimeChannel) {
-      double ts          = 0.0;
-      const bool success = GetEngValue(*m_groupTimeChannel, record_id, record, ts);
-      if (!success)
-        GetChannelValue(*m_groupTimeChannel, record_id, record, ts);
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+      base = gptr() - eback();
+    else if (dir == std::ios_base::end)
+      base = egptr() - eback();
 
-      cacheKey                   = static_cast<uint64_t>(ts * 1'000'000'000.0);
-      m_timestampCache[cacheKey] = ts;
-    }
+    const off_type pos = base + off;
+    if (pos < 0 || pos > egptr() - eback())
+      return pos_type(off_type(-1));
 
-    // Merge into existing entry so multi-group files accumulate all channels
-    auto cacheIt = m_cache.find(cacheKey);
-    if (cacheIt == m_cache.end())
-      cacheIt = m_cache.emplace(cacheKey, std::vector<double>(m_allChannels.size(), 0.0)).first;
+    setg(eback(), eback() + pos, egptr());
+    return pos_type(pos);
+  }
 
-    // Track which channels have actual data (not just default zeros)
-    auto activeIt = m_activeChannels.find(cacheKey);
-    if (activeIt == m_activeChannels.end())
-      activeIt =
-        m_activeChannels.emplace(cacheKey, std::vector<bool>(m_allChannels.size(), false)).first;
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
 
-    auto& values = cacheIt->second;
-    auto& active = activeIt->second;
+  std::streamsize xsgetn(char* s, std::streamsize n) override
+  {
+    const auto count = std::min<std::streamsize>(n, egptr() - gptr());
+    if (count <= 0)
+      return 0;
 
-    for (auto* channel : m_groupChannels) {
-      if (!channel)
-        continue;
+    std::memcpy(s, gptr(), static_cast<size_t>(count));
+    setg(eback(), gptr() + count, egptr());
+    return count;
+  }
+};
 
-      auto it = m_channelIndexMap.find(channel);
-      if (it == m_channelIndexMap.end())
-        continue;
+/**
+ * @class RecordObserver
+ * @brief Base observer that maps record IDs to their channel groups
+ *
+ * The observer subscribes to every channel group of the data group it is
+ * constructed with, and is detached automatically when destroyed.
+ */
+class RecordObserver : public mdf::ISampleObserver {
+public:
+  RecordObserver(const mdf::IDataGroup& dataGroup) : mdf::ISampleObserver(dataGroup) {}
+
+protected:
+  /**
+   * @brief Reads the engineering value of @p channel, falling back to the raw
+   *        channel value (or zero) when no conversion can be applied.
+   */
+  double readValue(const mdf::IChannel& channel,
+                   const uint64_t sample,
+                   const std::vector<uint8_t>& record)
+  {
+    double value = 0.0;
+    if (!GetEngValue(channel, sample, record, value))
+      if (!GetChannelValue(channel, sample, record, value))
+        value = 0.0;
 
-      double value       = 0.0;
-      const bool success = GetEngValue(*channel, record_id, record, value);
+    return value;
+  }
+};
 
-      if (!success) {
-        const bool channelSuccess = GetChannelValue(*channel, record_id, record, value);
-        if (!channelSuccess)
-          value = 0.0;
+/**
+ * @class FrameIndexObserver
+ * @brief Builds the frame timestamp array of files with per-group time channels
+ *
+ * Records from independent channel groups that share the same timestamp
+ * (quantised to nanoseconds) belong to the same frame. The observer appends
+ * a timestamp whenever the key changes, which already collapses the records a
+ * frame writes back-to-back; the caller sorts and deduplicates the result.
+ *
+ * Only channel groups with a time channel are subscribed. Every
+ * kCheckpointInterval records, the key of the record is stored in its
+ * channel group so that decodeBlock() can limit partial reads to the samples
+ * that cover the requested frames.
+ */
+class FrameIndexObserver : public RecordObserver {
+public:
+  FrameIndexObserver(const mdf::IDataGroup& dataGroup,
+                     std::vector<MDF4::RecordGroup>& groups,
+                     std::vector<double>& frameTimes)
+    : RecordObserver(dataGroup), m_frameTimes(frameTimes)
+  {
+    record_id_list_.clear();
+    for (auto& group : groups) {
+      if (group.dataGroup == &dataGroup && group.timeChannel) {
+        m_groups[group.recordId] = &group;
+        record_id_list_.insert(group.recordId);
       }
-
-      values[it->second] = value;
-      active[it->second] = true;
     }
+  }
+
+  bool OnSample(uint64_t sample, uint64_t record_id, const std::vector<uint8_t>& record) override
+  {
+    auto it = m_groups.find(record_id);
+    if (it == m_groups.end())
+      return true;
+
+    auto* group      = it->second;
+    const double ts  = readValue(*group->timeChannel, sample, record);
+    const uint64_t k = timeKey(ts);
+
+    if (sample % kCheckpointInterval == 0)
+      group->checkpoints.push_back(k);
+
+    if (k < group->lastKey)
+      group->monotonic = false;
+
+    group->lastKey = k;
+
+    if (m_frameTimes.empty() || timeKey(m_frameTimes.back()) != k)
+      m_frameTimes.push_back(ts);
 
     return true;
   }
 
 private:
-  std::map<uint64_t, std::vector<double>>& m_cache;
-  std::map<uint64_t, double>& m_timestampCache;
-  std::map<uint64_t, std::vector<bool>>& m_activeChannels;
-  const std::vector<mdf::IChannel*>& m_allChannels;
-  const std::vector<mdf::IChannel*>& m_groupChannels;
-  mdf::IChannel* m_groupTimeChannel;
-  uint64_t m_recordId;
-  std::map<mdf::IChannel*, size_t> m_channelIndexMap;
+  std::vector<double>& m_frameTimes;
+  std::map<uint64_t, MDF4::RecordGroup*> m_groups;
 };
 
 /**
@@ -166,48 +213,132 @@ private:
  * @brief Reads timestamp values from a single master time channel
  *
  * Used for legacy Serial Studio MDF4 files that have only one master
- * time channel in the first channel group. Populates the timestamp
- * cache keyed by raw sample index so the frame index builder can
- * resolve wall-clock times.
+ * time channel in the first channel group. Frames of these files are keyed
+ * by sample index, so the timestamp of sample N is stored in frame N.
  */
-class LegacyTimestampObserver : public mdf::ISampleObserver {
+class LegacyTimestampObserver : public RecordObserver {
 public:
   LegacyTimestampObserver(const mdf::IDataGroup& dataGroup,
-                          std::map<uint64_t, double>& timestampCache,
+                          std::vector<double>& frameTimes,
                           mdf::IChannel* masterTimeChannel,
                           uint64_t recordId)
-    : mdf::ISampleObserver(dataGroup)
-    , m_timestampCache(timestampCache)
+    : RecordObserver(dataGroup)
+    , m_frameTimes(frameTimes)
     , m_masterTimeChannel(masterTimeChannel)
     , m_recordId(recordId)
   {}
 
   bool OnSample(uint64_t sample, uint64_t record_id, const std::vector<uint8_t>& record) override
   {
-    if (record_id != m_recordId)
+    if (record_id != m_recordId || !m_masterTimeChannel)
+      return true;
+
+    if (sample < m_frameTimes.size())
+      m_frameTimes[sample] = readValue(*m_masterTimeChannel, sample, record);
+
+    return true;
+  }
+
+private:
+  std::vector<double>& m_frameTimes;
+  mdf::IChannel* m_masterTimeChannel;
+  uint64_t m_recordId;
+};
+
+/**
+ * @class BlockDecodeObserver
+ * @brief Decodes the records of one data group into a run of DecodedBlocks
+ *
+ * The observer only subscribes to the channel groups added with addTarget(),
+ * so mdflib skips the records of every other group, and only samples inside
+ * the range registered for each group are decoded. Each record is placed in
+ * the row of the frame it belongs to, found by sample index or, for
+ * time-keyed files, by a binary search of the record's time key within the
+ * run's slice of the frame timestamp array.
+ */
+class BlockDecodeObserver : public RecordObserver {
+public:
+  struct Target {
+    const MDF4::RecordGroup* group;
+    uint64_t firstSample;
+    uint64_t lastSample;
+  };
+
+  BlockDecodeObserver(const mdf::IDataGroup& dataGroup,
+                      const std::vector<MDF4::DecodedBlock*>& blocks,
+                      const std::vector<double>& frameTimes,
+                      const size_t channelCount,
+                      const size_t blockFrames,
+                      const size_t lastFrame,
+                      const bool timeKeyed)
+    : RecordObserver(dataGroup)
+    , m_blocks(blocks)
+    , m_frameTimes(frameTimes)
+    , m_channelCount(channelCount)
+    , m_blockFrames(blockFrames)
+    , m_firstFrame(static_cast<size_t>(blocks.front()->index) * blockFrames)
+    , m_lastFrame(lastFrame)
+    , m_timeKeyed(timeKeyed)
+  {
+    record_id_list_.clear();
+  }
+
+  void addTarget(const Target& target)
+  {
+    m_targets[target.group->recordId] = target;
+    record_id_list_.insert(target.group->recordId);
+  }
+
+  bool OnSample(uint64_t sample, uint64_t record_id, const std::vector<uint8_t>& record) override
+  {
+    auto it = m_targets.find(record_id);
+    if (it == m_targets.end())
       return true;
 
-    if (!m_masterTimeChannel || m_timestampCache.find(sample) != m_timestampCache.end())
+    const auto& target = it->second;
+    if (sample < target.firstSample || sample > target.lastSample)
       return true;
 
-    double timestamp   = 0.0;
-    const bool success = GetEngValue(*m_masterTimeChannel, record_id, record, timestamp);
+    // Resolve the frame this record belongs to
+    const auto* group = target.group;
+    size_t frame      = sample;
+    if (m_timeKeyed) {
+      const uint64_t k = timeKey(readValue(*group->timeChannel, sample, record));
+      const auto begin = m_frameTimes.begin() + m_firstFrame;
+      const auto end   = m_frameTimes.begin() + m_lastFrame + 1;
+      const auto fit   = std::lower_bound(
+        begin, end, k, [](const double ts, const uint64_t key) { return timeKey(ts) < key; });
+
+      if (fit == end || timeKey(*fit) != k)
+        return true;
+
+      frame = static_cast<size_t>(fit - m_frameTimes.begin());
+    }
+
+    if (frame < m_firstFrame || frame > m_lastFrame)
+      return true;
 
-    if (!success) {
-      const bool channelSuccess =
-        GetChannelValue(*m_masterTimeChannel, record_id, record, timestamp);
-      if (!channelSuccess)
-        timestamp = 0.0;
+    // Store the channel values in the frame's row of its block
+    auto* block      = m_blocks[(frame - m_firstFrame) / m_blockFrames];
+    const size_t row = (frame % m_blockFrames) * m_channelCount;
+    for (size_t i = 0; i < group->channels.size(); ++i) {
+      const size_t column   = row + group->columns[i];
+      block->values[column] = readValue(*group->channels[i], sample, record);
+      block->active[column] = 1;
     }
 
-    m_timestampCache[sample] = timestamp;
     return true;
   }
 
 private:
-  std::map<uint64_t, double>& m_timestampCache;
-  mdf::IChannel* m_masterTimeChannel;
-  uint64_t m_recordId;
+  const std::vector<MDF4::DecodedBlock*>& m_blocks;
+  const std::vector<double>& m_frameTimes;
+  const size_t m_channelCount;
+  const size_t m_blockFrames;
+  const size_t m_firstFrame;
+  const size_t m_lastFrame;
+  const bool m_timeKeyed;
+  std::map<uint64_t, Target> m_targets;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -222,7 +353,9 @@ private:
  */
 MDF4::Player::Player()
   : m_framePos(0)
+  , m_blockFrames(kMinBlockFrames)
   , m_playing(false)
+  , m_timeKeyed(false)
   , m_multiSource(false)
   , m_isSerialStudioFile(false)
   , m_timestamp("")
@@ -273,11 +406,11 @@ bool MDF4::Player::isPlaying() const
 
 /**
  * @brief Returns the total number of frames in the file
- * @return Frame count (size of frame index)
+ * @return Frame count (size of the frame timestamp array)
  */
 int MDF4::Player::frameCount() const
 {
-  return static_cast<int>(m_frameIndex.size());
+  return static_cast<int>(m_frameTimes.size());
 }
 
 /**
@@ -344,7 +477,7 @@ void MDF4::Player::play()
     m_framePos = 0;
 
   // Capture start time for real-time synchronization
-  m_startTimestamp = m_frameIndex[m_framePos].timestamp;
+  m_startTimestamp = m_frameTimes[m_framePos];
   m_elapsedTimer.start();
 
   m_playing = true;
@@ -410,10 +543,10 @@ void MDF4::Player::openFile()
  *
  * Performs the following operations:
  * 1. Disconnects from device if currently connected
- * 2. Opens the file using mdflib's MdfReader
+ * 2. Memory-maps the file and opens it using mdflib's MdfReader
  * 3. Validates file structure
- * 4. Builds frame index and reads measurement data
- * 5. Extracts file metadata (author, project, subject)
+ * 4. Extracts file metadata (author, project, subject)
+ * 5. Builds the frame timestamp array (sample data is decoded on demand)
  */
 void MDF4::Player::openFile(const QString& filePath)
 {
@@ -434,8 +567,18 @@ void MDF4::Player::openFile(const QString& filePath)
 
   closeFile();
 
-  // Open and validate the MDF4 file
-  m_reader = std::make_unique<mdf::MdfReader>(filePath.toStdString());
+  // Map the file so that mdflib reads and skips records without system calls
+  m_file.setFileName(filePath);
+  const uchar* data = nullptr;
+  if (m_file.open(QIODevice::ReadOnly))
+    data = m_file.map(0, m_file.size());
+
+  // Open and validate the MDF4 file, using a regular file stream if mapping failed
+  if (data)
+    m_reader = std::make_unique<mdf::MdfReader>(
+      std::make_shared<MappedFileBuffer>(data, m_file.size()));
+  else
+    m_reader = std::make_unique<mdf::MdfReader>(filePath.toStdString());
 
   if (!m_reader->IsOk()) {
     Misc::Utilities::showMessageBox(tr("Cannot open MDF4 file"),
@@ -460,10 +603,10 @@ void MDF4::Player::openFile(const QString& filePath)
     m_isSerialStudioFile = (author == "Serial Studio");
   }
 
-  // Build the frame index from channel data
+  // Build the frame timestamp array from the channel groups
   buildFrameIndex();
 
-  if (m_frameIndex.empty()) {
+  if (m_frameTimes.empty()) {
     Misc::Utilities::showMessageBox(tr("No data in file"),
                                     tr("The MDF4 file contains no measurement data."),
                                     QMessageBox::Critical);
@@ -484,28 +627,39 @@ void MDF4::Player::openFile(const QString& filePath)
  * @brief Closes the currently open file and releases resources
  *
  * Stops playback if active, closes the file, and clears all cached data
- * including the frame index, channel list, and sample cache.
+ * including the frame timestamps, channel list, and decoded blocks.
  */
 void MDF4::Player::closeFile()
 {
-  if (!isOpen())
+  // Release a reader that failed validation, along with its mapping
+  if (!isOpen()) {
+    m_reader.reset();
+    m_file.close();
     return;
+  }
 
-  // Clear all cached data and reset state
+  // Release the reader before unmapping the file it reads from
   m_framePos = 0;
   m_reader.reset();
+  m_file.close();
+
+  // Clear all cached data and reset state
   m_filePath.clear();
   m_channels.clear();
   m_timestamp.clear();
-  m_frameIndex.clear();
-  m_sampleCache.clear();
-  m_timestampCache.clear();
-  m_activeChannels.clear();
+  m_groups.clear();
+  m_blocks.clear();
+  m_frameTimes.clear();
+  m_frameTimes.shrink_to_fit();
+  m_timeKeyed          = false;
   m_multiSource        = false;
   m_isSerialStudioFile = false;
   m_masterTimeChannel  = nullptr;
   m_channelToSource.clear();
   m_sourceChannelCount.clear();
+  m_frameValues.clear();
+  m_sourceValues.clear();
+  m_activeSources.clear();
 
   DataModel::FrameBuilder::instance().registerQuickPlotHeaders(QStringList());
 
@@ -631,7 +785,7 @@ void MDF4::Player::updateData()
     return;
 
   if (m_framePos >= 0 && m_framePos < frameCount()) {
-    m_timestamp = formatTimestamp(m_frameIndex[m_framePos].timestamp);
+    m_timestamp = formatTimestamp(m_frameTimes[m_framePos]);
     Q_EMIT timestampChanged();
   }
 
@@ -646,7 +800,7 @@ void MDF4::Player::updateData()
     const qint64 elapsedMs  = m_elapsedTimer.elapsed();
     const double targetTime = m_startTimestamp + (elapsedMs / 1000.0);
 
-    const double nextTime = m_frameIndex[framePosition() + 1].timestamp;
+    const double nextTime = m_frameTimes[framePosition() + 1];
 
     if (nextTime <= targetTime) {
       constexpr int kMaxBatchSize = 100;
@@ -663,13 +817,13 @@ void MDF4::Player::updateData()
         if (m_framePos >= frameCount() - 1)
           break;
 
-        const double nextFrameTime = m_frameIndex[m_framePos + 1].timestamp;
+        const double nextFrameTime = m_frameTimes[m_framePos + 1];
         if (nextFrameTime > targetTime)
           break;
       }
 
-      if (isOpen() && static_cast<size_t>(m_framePos) < m_frameIndex.size()) {
-        m_timestamp = formatTimestamp(m_frameIndex[m_framePos].timestamp);
+      if (isOpen() && static_cast<size_t>(m_framePos) < m_frameTimes.size()) {
+        m_timestamp = formatTimestamp(m_frameTimes[m_framePos]);
         Q_EMIT timestampChanged();
       }
 
@@ -695,31 +849,30 @@ void MDF4::Player::updateData()
 //--------------------------------------------------------------------------------------------------
 
 /**
- * @brief Builds a sparse frame index for efficient streaming playback
- *
- * Iterates through all data groups and channel groups in the MDF4 file,
- * creating a lightweight index by sampling every Nth record. This allows
- * handling large (multi-GB) files without loading all data into memory.
+ * @brief Builds the frame timestamp array used for seeking and playback timing
  *
- * The index stores:
- * - Timestamp (derived from sample index)
- * - Record index within the channel group
- * - Pointer to the channel group for data access
+ * Collects the data channels of every channel group and assigns each one a
+ * column in the decoded frame rows. How records map to frames depends on the
+ * file:
  *
- * After building the index, ReadData() is called on each data group to
- * load the actual measurement data that can be accessed during playback.
+ * - Serial Studio files with a master time channel per group are keyed by
+ *   time. One pass over each data group reads only the time channels, and
+ *   records that share a timestamp (quantised to nanoseconds) form a frame.
+ * - Legacy Serial Studio files with a single master channel are keyed by
+ *   sample index, with timestamps read from the master channel group.
+ * - Other files are keyed by sample index with a synthetic 1 ms spacing, and
+ *   no sample data is read at all until playback.
  *
- * @note Sample interval (kSampleInterval) controls index granularity.
- *       Higher values = less memory, coarser seek resolution.
+ * Channel values are not read here; see decodeBlock().
  */
 void MDF4::Player::buildFrameIndex()
 {
   // Reset all cached data before rebuilding
-  m_frameIndex.clear();
+  m_groups.clear();
+  m_blocks.clear();
   m_channels.clear();
-  m_sampleCache.clear();
-  m_timestampCache.clear();
-  m_activeChannels.clear();
+  m_frameTimes.clear();
+  m_timeKeyed         = false;
   m_masterTimeChannel = nullptr;
 
   if (!m_reader || !m_reader->IsOk())
@@ -735,8 +888,6 @@ void MDF4::Player::buildFrameIndex()
   if (dataGroups.empty())
     return;
 
-  std::vector<mdf::IChannel*> allChannels;
-
   // Collect per-group time channels (new files: per-CG master; old: single master)
   std::map<mdf::IChannelGroup*, mdf::IChannel*> groupTimeChannels;
   int masterChannelCount = 0;
@@ -760,8 +911,8 @@ void MDF4::Player::buildFrameIndex()
           continue;
         }
 
-        if (std::find(allChannels.begin(), allChannels.end(), ch) == allChannels.end())
-          allChannels.push_back(ch);
+        if (std::find(m_channels.begin(), m_channels.end(), ch) == m_channels.end())
+          m_channels.push_back(ch);
       }
 
       if (groupMaster)
@@ -770,7 +921,7 @@ void MDF4::Player::buildFrameIndex()
   }
 
   // Fall back to legacy single-master path for old MDF4 files
-  const bool perGroupTime  = (masterChannelCount > 1);
+  m_timeKeyed              = (masterChannelCount > 1);
   uint64_t legacyTimeRecId = 0;
   if (masterChannelCount == 1) {
     auto it             = groupTimeChannels.begin();
@@ -779,134 +930,260 @@ void MDF4::Player::buildFrameIndex()
     groupTimeChannels.clear();
   }
 
-  m_channels = allChannels;
-
-  // Attach one observer per CG and read once per DG to avoid duplicate records
+  // Register every channel group that holds samples, with its row columns
+  uint64_t maxSamples = 0;
   for (auto* dg : dataGroups) {
     if (!dg)
       continue;
 
-    auto channelGroups = dg->ChannelGroups();
-    if (channelGroups.empty())
-      continue;
-
-    // Build per-CG data-channel lists and time-channel pointers
-    struct CgInfo {
-      mdf::IChannelGroup* cg;
-      mdf::IChannel* timeCh;
-      std::vector<mdf::IChannel*> dataChs;
-    };
-
-    std::vector<CgInfo> cgInfos;
-    for (auto* cg : channelGroups) {
-      if (!cg)
-        continue;
-
-      auto cgChannels      = cg->Channels();
-      uint64_t recordCount = cg->NofSamples();
-      if (cgChannels.empty() || recordCount == 0)
+    for (auto* cg : dg->ChannelGroups()) {
+      if (!cg || cg->Channels().empty() || cg->NofSamples() == 0)
         continue;
 
-      CgInfo ci;
-      ci.cg     = cg;
-      ci.timeCh = nullptr;
+      RecordGroup group;
+      group.dataGroup    = dg;
+      group.channelGroup = cg;
+      group.recordId     = cg->RecordId();
+      group.sampleCount  = cg->NofSamples();
 
-      if (perGroupTime) {
+      if (m_timeKeyed) {
         auto tit = groupTimeChannels.find(cg);
-        if (tit != groupTimeChannels.end())
-          ci.timeCh = tit->second;
+        if (tit == groupTimeChannels.end())
+          continue;
+
+        group.timeChannel = tit->second;
       }
 
-      for (auto* ch : cgChannels)
-        if (ch && ch->Type() != mdf::ChannelType::Master)
-          ci.dataChs.push_back(ch);
+      for (auto* ch : cg->Channels()) {
+        if (!ch || ch->Type() == mdf::ChannelType::Master)
+          continue;
 
-      cgInfos.push_back(std::move(ci));
-    }
+        const auto column = std::find(m_channels.begin(), m_channels.end(), ch);
+        group.channels.push_back(ch);
+        group.columns.push_back(static_cast<size_t>(column - m_channels.begin()));
+      }
 
-    // Create and attach all observers before reading
-    std::vector<std::unique_ptr<SampleCacheObserver>> observers;
-    observers.reserve(cgInfos.size());
-    for (auto& ci : cgInfos) {
-      auto obs = std::make_unique<SampleCacheObserver>(*dg,
-                                                       m_sampleCache,
-                                                       m_timestampCache,
-                                                       m_activeChannels,
-                                                       m_channels,
-                                                       ci.dataChs,
-                                                       ci.timeCh,
-                                                       ci.cg->RecordId());
-      obs->AttachObserver();
-      observers.push_back(std::move(obs));
+      maxSamples = std::max(maxSamples, group.sampleCount);
+      m_groups.push_back(std::move(group));
     }
+  }
+
+  if (m_groups.empty())
+    return;
 
-    m_reader->ReadData(*dg);
+  // Size decoded blocks so that each one holds a bounded number of values
+  const int channelCount = std::max<int>(1, static_cast<int>(m_channels.size()));
+  m_blockFrames = std::clamp(kBlockValues / channelCount, kMinBlockFrames, kMaxBlockFrames);
 
-    // Detach all observers
-    for (auto& obs : observers)
-      obs->DetachObserver();
+  // Time-keyed files: one pass over the time channels of each data group
+  if (m_timeKeyed) {
+    for (auto* dg : dataGroups) {
+      const auto inGroup = [dg](const RecordGroup& g) { return g.dataGroup == dg; };
+      if (!dg || std::none_of(m_groups.begin(), m_groups.end(), inGroup))
+        continue;
+
+      FrameIndexObserver observer(*dg, m_groups, m_frameTimes);
+      m_reader->ReadData(*dg);
+      observer.DetachObserver();
+    }
+
+    sortFrameTimes();
+    return;
   }
 
-  // Legacy path: read timestamps keyed by sample index for wall-clock lookup
-  if (m_isSerialStudioFile && !perGroupTime && m_masterTimeChannel) {
+  // Sample-keyed files: frame N holds sample N of every channel group
+  m_frameTimes.resize(maxSamples);
+  for (uint64_t i = 0; i < maxSamples; ++i)
+    m_frameTimes[i] = static_cast<double>(i) * 0.001;
+
+  // Legacy path: read timestamps from the single master channel group
+  if (m_isSerialStudioFile && m_masterTimeChannel) {
     for (auto* dg : dataGroups) {
       if (!dg)
         continue;
 
-      LegacyTimestampObserver tsObs(*dg, m_timestampCache, m_masterTimeChannel, legacyTimeRecId);
-      tsObs.AttachObserver();
+      LegacyTimestampObserver tsObs(*dg, m_frameTimes, m_masterTimeChannel, legacyTimeRecId);
       m_reader->ReadData(*dg);
       tsObs.DetachObserver();
       break;
     }
   }
+}
+
+/**
+ * @brief Sorts the frame timestamps of a time-keyed file and merges
+ *        entries that share the same time key.
+ *
+ * Channel groups are usually written in time order, so the array is almost
+ * sorted already and the sort is cheap. The capacity left over from the
+ * deduplication is released, since the array lives as long as the file.
+ */
+void MDF4::Player::sortFrameTimes()
+{
+  const auto byKey = [](const double a, const double b) { return timeKey(a) < timeKey(b); };
+  if (!std::is_sorted(m_frameTimes.begin(), m_frameTimes.end(), byKey))
+    std::stable_sort(m_frameTimes.begin(), m_frameTimes.end(), byKey);
+
+  const auto last = std::unique(m_frameTimes.begin(), m_frameTimes.end(), [](double a, double b) {
+    return timeKey(a) == timeKey(b);
+  });
 
-  // Build the frame index from the populated sample cache
-  buildFrameIndexFromCache();
+  m_frameTimes.erase(last, m_frameTimes.end());
+  m_frameTimes.shrink_to_fit();
 }
 
+//--------------------------------------------------------------------------------------------------
+// Block decoding
+//--------------------------------------------------------------------------------------------------
+
 /**
- * @brief Builds the frame index from the sample cache populated during
- * observer-based data reading.
+ * @brief Returns the decoded block that contains frame @p frameIndex
  *
- * Each entry in m_sampleCache becomes one frame. Timestamps are resolved
- * from m_timestampCache when available, otherwise a synthetic 1 ms
- * increment is used. The resulting index is sorted by record ID.
+ * Decoded blocks are kept in a small LRU list, most recently used first.
+ * Playback and plot-history reloads touch frames close to the playhead, so
+ * they almost always hit the first one or two blocks.
+ *
+ * On a miss, the requested block and the uncached blocks that follow it (up
+ * to kReadAheadBlocks) are decoded in a single pass, recycling the least
+ * recently used blocks and their allocations.
+ *
+ * @param frameIndex Valid frame index.
+ * @return Reference to the block, valid until the next call.
  */
-void MDF4::Player::buildFrameIndexFromCache()
+const MDF4::DecodedBlock& MDF4::Player::decodedBlock(int frameIndex)
 {
-  if (m_sampleCache.empty())
+  const int index = frameIndex / m_blockFrames;
+  const auto find = [this](int i) {
+    return std::find_if(
+      m_blocks.begin(), m_blocks.end(), [i](const DecodedBlock& b) { return b.index == i; });
+  };
+
+  // Move cache hits to the front of the list
+  auto it = find(index);
+  if (it != m_blocks.end()) {
+    if (it != m_blocks.begin())
+      m_blocks.splice(m_blocks.begin(), m_blocks, it);
+
+    return m_blocks.front();
+  }
+
+  // Collect the run of uncached blocks that starts at the requested one
+  const int blockCount = (frameCount() + m_blockFrames - 1) / m_blockFrames;
+  const int runEnd     = std::min(blockCount, index + kReadAheadBlocks);
+
+  std::vector<DecodedBlock*> run;
+  for (int i = index; i < runEnd; ++i) {
+    if (i != index && find(i) != m_blocks.end())
+      break;
+
+    if (static_cast<int>(m_blocks.size()) >= kMaxCachedBlocks)
+      m_blocks.splice(m_blocks.begin(), m_blocks, std::prev(m_blocks.end()));
+    else
+      m_blocks.emplace_front();
+
+    m_blocks.front().index = i;
+    run.push_back(&m_blocks.front());
+  }
+
+  decodeBlocks(run);
+
+  // Keep the requested block as the most recently used one
+  m_blocks.splice(m_blocks.begin(), m_blocks, find(index));
+  return m_blocks.front();
+}
+
+/**
+ * @brief Decodes the channel values of a run of consecutive blocks
+ *
+ * For every data group, the sample range that covers the run's frames is
+ * read with mdflib's ReadPartialData(), which skips the records before and
+ * stops after the range. Sample-keyed files read the frame range directly.
+ * Time-keyed files derive each channel group's range from its checkpoints,
+ * or read the whole group if its timestamps are not monotonic.
+ *
+ * Channels that no record wrote stay at zero and are flagged as inactive.
+ *
+ * @param blocks Blocks with consecutive indexes, in ascending order.
+ */
+void MDF4::Player::decodeBlocks(const std::vector<DecodedBlock*>& blocks)
+{
+  if (blocks.empty())
     return;
 
-  uint64_t sampleIndex = 0;
-  m_frameIndex.reserve(m_sampleCache.size());
-
-  for (const auto& cachePair : m_sampleCache) {
-    FrameIndex frameIdx;
-
-    // Resolve timestamp from cache or fall back to synthetic timing
-    if (m_isSerialStudioFile && !m_timestampCache.empty()) {
-      auto timeIt = m_timestampCache.find(cachePair.first);
-      if (timeIt != m_timestampCache.end())
-        frameIdx.timestamp = timeIt->second;
-      else
-        frameIdx.timestamp = static_cast<double>(sampleIndex) * 0.001;
-    } else {
-      frameIdx.timestamp = static_cast<double>(sampleIndex) * 0.001;
+  // Frame range of the run
+  const size_t channelCount = m_channels.size();
+  const size_t blockFrames  = static_cast<size_t>(m_blockFrames);
+  const size_t firstFrame   = static_cast<size_t>(blocks.front()->index) * blockFrames;
+  const size_t lastFrame =
+    std::min((static_cast<size_t>(blocks.back()->index) + 1) * blockFrames, m_frameTimes.size())
+    - 1;
+
+  // Reset the rows of every block in the run
+  for (auto* block : blocks) {
+    const size_t first = static_cast<size_t>(block->index) * blockFrames;
+    const size_t count = (std::min(first + blockFrames - 1, lastFrame) - first + 1) * channelCount;
+    block->values.assign(count, 0.0);
+    block->active.assign(count, 0);
+  }
+
+  // Time keys of the first and last frame in the run
+  const uint64_t firstKey = timeKey(m_frameTimes[firstFrame]);
+  const uint64_t lastKey  = timeKey(m_frameTimes[lastFrame]);
+
+  // Read the data groups one at a time, restricted to the run's samples
+  std::vector<mdf::IDataGroup*> dataGroups;
+  for (const auto& group : m_groups)
+    if (std::find(dataGroups.begin(), dataGroups.end(), group.dataGroup) == dataGroups.end())
+      dataGroups.push_back(group.dataGroup);
+
+  for (auto* dg : dataGroups) {
+    BlockDecodeObserver observer(
+      *dg, blocks, m_frameTimes, channelCount, blockFrames, lastFrame, m_timeKeyed);
+
+    bool used          = false;
+    uint64_t minSample = std::numeric_limits<uint64_t>::max();
+    uint64_t maxSample = 0;
+    for (const auto& group : m_groups) {
+      if (group.dataGroup != dg)
+        continue;
+
+      // Sample range of this channel group that covers the run
+      uint64_t first = firstFrame;
+      uint64_t last  = lastFrame;
+      if (m_timeKeyed) {
+        first = 0;
+        last  = group.sampleCount - 1;
+        if (group.monotonic && !group.checkpoints.empty()) {
+          const auto& cp = group.checkpoints;
+          const auto lo  = std::lower_bound(cp.begin(), cp.end(), firstKey);
+          const auto hi  = std::upper_bound(cp.begin(), cp.end(), lastKey);
+          if (hi == cp.begin())
+            continue;
+
+          if (lo != cp.begin())
+            first = static_cast<uint64_t>(lo - cp.begin() - 1) * kCheckpointInterval;
+
+          if (hi != cp.end())
+            last = static_cast<uint64_t>(hi - cp.begin()) * kCheckpointInterval - 1;
+        }
+      }
+
+      if (first >= group.sampleCount)
+        continue;
+
+      last = std::min(last, group.sampleCount - 1);
+      observer.addTarget({&group, first, last});
+      minSample = std::min(minSample, first);
+      maxSample = std::max(maxSample, last);
+      used      = true;
     }
 
-    frameIdx.recordIndex  = cachePair.first;
-    frameIdx.channelGroup = nullptr;
+    // mdflib treats the range as 1-based, the observer filters exact samples
+    if (used)
+      m_reader->ReadPartialData(*dg, minSample, maxSample + 1);
 
-    m_frameIndex.push_back(frameIdx);
-    ++sampleIndex;
+    observer.DetachObserver();
   }
-
-  // Sort by record ID so binary lookups and sequential playback work
-  std::sort(m_frameIndex.begin(), m_frameIndex.end(),
-            [](const FrameIndex& a, const FrameIndex& b) {
-              return a.recordIndex < b.recordIndex;
-            });
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -929,19 +1206,18 @@ void MDF4::Player::processFrameBatch(int startFrame, int endFrame)
 }
 
 /**
- * @brief Sends a single frame to the IO manager for processing
+ * @brief Sends a single frame to the frame pipeline for processing
  * @param frameIndex Index of the frame to send
  *
- * Extracts frame data using getFrame() and sends it through the normal
- * IO::ConnectionManager pipeline for console display, FrameBuilder processing,
- * and dashboard visualization.
+ * Hands the decoded channel values to FrameBuilder for dashboard visualization
+ * and echoes the formatted row to the console (see injectFrame()).
  */
 void MDF4::Player::sendFrame(int frameIndex)
 {
   if (!isOpen() || frameIndex < 0 || frameIndex >= frameCount())
     return;
 
-  injectFrame(getFrame(frameIndex), frameIndex);
+  injectFrame(frameIndex);
 }
 
 /**
@@ -1006,15 +1282,15 @@ QString MDF4::Player::formatTimestamp(double timestamp) const
 
 /**
  * @brief Extracts a frame of data at the specified index
- * @param index The frame index in the frame index vector
+ * @param index The frame index
  * @return QByteArray containing comma-separated channel values
  *
  * Creates a CSV-format line with values for all channels at the specified
- * frame index. Values are retrieved from the sample cache that was populated
- * during ReadData() using the SampleCacheObserver.
+ * frame index. Values are read from the decoded block that holds the frame
+ * (see decodedBlock()).
  *
- * The output is sent through IO::ConnectionManager::processPayload() for display in
- * the console and processing by the FrameBuilder.
+ * The output is only used for display in the console and by the other
+ * raw-data consumers; FrameBuilder receives the values directly.
  *
  * @note Values are engineering values (post-conversion) extracted using
  *       mdflib's GetEngValue() method which applies channel conversions.
@@ -1024,27 +1300,21 @@ QByteArray MDF4::Player::getFrame(const int index)
   if (!isOpen() || index < 0 || index >= frameCount())
     return QByteArray();
 
-  // Build CSV row from cached channel values
-  const auto& frameIdx = m_frameIndex[index];
-  QByteArray frame;
-
-  auto it = m_sampleCache.find(frameIdx.recordIndex);
-  if (it != m_sampleCache.end()) {
-    const auto& values = it->second;
-    for (size_t i = 0; i < values.size(); ++i) {
-      frame.append(QString::number(values[i], 'g', 10).toUtf8());
+  // Locate the frame's row in its decoded block
+  const auto& block   = decodedBlock(index);
+  const size_t count  = m_channels.size();
+  const size_t offset = static_cast<size_t>(index - block.index * m_blockFrames) * count;
 
-      if (i < values.size() - 1)
-        frame.append(',');
-    }
-  }
-
-  else {
-    for (size_t i = 0; i < m_channels.size(); ++i) {
-      frame.append("0");
-      if (i < m_channels.size() - 1)
-        frame.append(',');
-    }
+  // Build CSV row from the decoded channel values
+  QByteArray frame;
+  char buffer[32];
+  for (size_t i = 0; i < count; ++i) {
+    const auto result = std::to_chars(
+      buffer, buffer + sizeof(buffer), block.values[offset + i], std::chars_format::general, 10);
+    frame.append(buffer, result.ptr - buffer);
+
+    if (i < count - 1)
+      frame.append(',');
   }
 
   frame.append('\n');
@@ -1090,72 +1360,58 @@ void MDF4::Player::buildMultiSourceMapping()
 }
 
 /**
- * @brief Injects an MDF4 frame through the appropriate pipeline path.
+ * @brief Injects frame @p frameIndex into the frame pipeline.
  *
- * For single-source or non-project mode, delegates to processPayload().
- * For multi-source project mode, splits the CSV row by source and calls
- * processMultiSourcePayload(), only including sources that actually have
- * channel data in this particular sample.
+ * The decoded channel values are handed straight to FrameBuilder, so they are
+ * never formatted to text and parsed back. In multi-source project mode the
+ * values are split by source, and only sources that have at least one active
+ * channel in this sample are updated. The formatted row is only built for the
+ * console and the other raw-data consumers.
  *
- * @param frame CSV-formatted byte array with channel values.
- * @param frameIndex Index into m_frameIndex (used to check active channels).
+ * @param frameIndex Index into m_frameTimes.
  */
-void MDF4::Player::injectFrame(const QByteArray& frame, int frameIndex)
+void MDF4::Player::injectFrame(int frameIndex)
 {
   // Ignore empty frames
+  const auto frame = getFrame(frameIndex);
   if (frame.isEmpty())
     return;
 
-  // Single-source: use standard path
+  static auto& frameBuilder = DataModel::FrameBuilder::instance();
+  IO::ConnectionManager::instance().echoPayload(frame);
+
+  // Copy the frame's row out of its decoded block
+  const auto& block   = decodedBlock(frameIndex);
+  const size_t count  = m_channels.size();
+  const size_t offset = static_cast<size_t>(frameIndex - block.index * m_blockFrames) * count;
+  const auto* values  = block.values.data() + offset;
+  const auto* active  = block.active.data() + offset;
+  m_frameValues.assign(values, values + count);
+
+  // Single-source: the whole record feeds the frame
   if (!m_multiSource) {
-    IO::ConnectionManager::instance().processPayload(frame);
+    frameBuilder.hotpathRxPlaybackFrame(m_frameValues);
     return;
   }
 
-  // Look up which channels are active for this sample
-  const std::vector<bool>* active = nullptr;
-  if (frameIndex >= 0 && frameIndex < static_cast<int>(m_frameIndex.size())) {
-    auto ait = m_activeChannels.find(m_frameIndex[frameIndex].recordIndex);
-    if (ait != m_activeChannels.end())
-      active = &ait->second;
-  }
-
-  // Multi-source: split CSV columns by source, skipping inactive sources
-  const auto fields = QString::fromUtf8(frame).trimmed().split(',');
+  // Multi-source: split channels by source, tracking sources with fresh data
+  for (auto& list : m_sourceValues)
+    list.clear();
 
-  QMap<int, QStringList> sourceFields;
-  for (int ch = 0; ch < fields.size(); ++ch) {
-    auto it = m_channelToSource.find(ch);
-    if (it == m_channelToSource.end())
+  m_activeSources.clear();
+  for (int ch = 0; ch < static_cast<int>(count); ++ch) {
+    auto cit = m_channelToSource.find(ch);
+    if (cit == m_channelToSource.end())
       continue;
 
-    sourceFields[it.value()].append(fields[ch]);
-  }
-
-  // Only include sources that have at least one active channel
-  QMap<int, QByteArray> sourcePayloads;
-  for (auto it = sourceFields.constBegin(); it != sourceFields.constEnd(); ++it) {
-    if (active) {
-      bool hasData = false;
-      for (int ch = 0; ch < fields.size(); ++ch) {
-        auto cit = m_channelToSource.find(ch);
-        if (cit != m_channelToSource.end() && cit.value() == it.key()) {
-          if (ch < static_cast<int>(active->size()) && (*active)[ch]) {
-            hasData = true;
-            break;
-          }
-        }
-      }
-
-      if (!hasData)
-        continue;
-    }
-
-    sourcePayloads[it.key()] = it.value().join(',').toUtf8() + '\n';
+    m_sourceValues[cit.value()].push_back(values[ch]);
+    if (active[ch])
+      m_activeSources.insert(cit.value());
   }
 
-  if (!sourcePayloads.isEmpty())
-    IO::ConnectionManager::instance().processMultiSourcePayload(frame, sourcePayloads);
+  for (auto sit = m_sourceValues.constBegin(); sit != m_sourceValues.constEnd(); ++sit)
+    if (!sit.value().empty() && m_activeSources.contains(sit.key()))
+      frameBuilder.hotpathRxPlaybackFrame(sit.key(), sit.value());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -21,49 +21,89 @@
 
 #pragma once
 
-#include <map>
+#include <list>
 #include <memory>
 #include <QByteArray>
 #include <QElapsedTimer>
+#include <QFile>
 #include <QKeyEvent>
 #include <QMap>
 #include <QObject>
+#include <QSet>
 #include <QString>
 #include <vector>
 
 namespace mdf {
 class MdfReader;
 class IChannel;
+class IDataGroup;
 class IChannelGroup;
 }  // namespace mdf
 
 namespace MDF4 {
+/**
+ * @brief Channel group metadata used to decode its records on demand.
+ *
+ * For files with a time channel per group, every Nth record's time key is
+ * kept as a checkpoint, so the sample range that covers a span of frames can
+ * be found without keeping the timestamps of every record.
+ */
+struct RecordGroup {
+  mdf::IDataGroup* dataGroup       = nullptr;
+  mdf::IChannelGroup* channelGroup = nullptr;
+  mdf::IChannel* timeChannel       = nullptr;
+  uint64_t recordId                = 0;
+  uint64_t sampleCount             = 0;
+  uint64_t lastKey                 = 0;
+  bool monotonic                   = true;
+  std::vector<uint64_t> checkpoints;
+  std::vector<mdf::IChannel*> channels;
+  std::vector<size_t> columns;
+};
+
+/**
+ * @brief Channel values of a range of consecutive frames.
+ *
+ * Values are stored row-major (one row of channel values per frame), with a
+ * parallel mask that flags the channels a record actually wrote.
+ */
+struct DecodedBlock {
+  int index = -1;
+  std::vector<double> values;
+  std::vector<uint8_t> active;
+};
+
 /**
  * @class Player
  * @brief MDF4 file player for Serial Studio
  *
  * The MDF4::Player class provides playback functionality for MDF4/MF4 binary
  * measurement files. Unlike the CSV player, this implementation uses a
- * streaming architecture with sparse frame indexing to efficiently handle
- * large files (multi-GB) without loading everything into memory.
+ * streaming architecture that decodes records on demand, so large files
+ * (multi-GB) play back without loading everything into memory.
  *
  * ## Features
  * - Supports all MDF4 measurement types (CAN, LIN, FlexRay, analog, etc.)
- * - Memory-efficient streaming with sparse sampling
+ * - Memory-efficient streaming with a bounded cache of decoded frames
  * - Real-time playback with timestamp synchronization
  * - Manual frame navigation (next/previous)
  * - Seek/scrub support via progress slider
  * - Keyboard shortcuts (Space = play/pause, Arrow keys = next/prev frame)
  *
  * ## Architecture
- * The player builds a sparse frame index on file open, sampling every Nth
- * record to create a lightweight lookup table. During playback, frames are
- * streamed on-demand and sent through the standard IO::ConnectionManager pipeline for
- * processing, visualization, and export.
+ * The file is memory-mapped and handed to mdflib as a stream buffer. On open,
+ * the player only builds a sorted array with one timestamp per frame (plus a
+ * few checkpoints per channel group). During playback, frames are decoded in
+ * blocks with mdflib's partial reads, and the most recently used blocks around
+ * the playhead are kept in a small LRU cache (about 75 MB at most). A cache
+ * miss decodes a run of consecutive blocks in one pass, since every partial
+ * read re-scans the data group's record headers from the start. Memory use
+ * therefore grows with the frame count (8 bytes per frame), not with the
+ * amount of sample data.
  *
  * ## Data Flow
- * MDF4 File → buildFrameIndex() → getFrame() → IO::ConnectionManager::processPayload()
- * → FrameBuilder → Dashboard
+ * MDF4 File → buildFrameIndex() → decodedBlock() → injectFrame() → FrameBuilder
+ * (getFrame() formats each row as text for the console only)
  *
  * ## Usage Example
  * @code
@@ -142,11 +182,13 @@ private slots:
   void processFrameBatch(int startFrame, int endFrame);
 
 private:
-  void buildFrameIndexFromCache();
+  void sortFrameTimes();
+  const DecodedBlock& decodedBlock(int frameIndex);
+  void decodeBlocks(const std::vector<DecodedBlock*>& blocks);
 
   void sendHeaderFrame();
   void buildMultiSourceMapping();
-  void injectFrame(const QByteArray& frame, int frameIndex = -1);
+  void injectFrame(int frameIndex);
   QByteArray getFrame(const int index);
   QString formatTimestamp(double timestamp) const;
 
@@ -155,14 +197,16 @@ protected:
   bool eventFilter(QObject* obj, QEvent* event) override;
 
 private:
-  struct FrameIndex {
-    double timestamp;
-    uint64_t recordIndex;
-    mdf::IChannelGroup* channelGroup;
-  };
+  static constexpr int kMaxCachedBlocks = 8;
+  static constexpr int kReadAheadBlocks = 4;
+  static constexpr int kMinBlockFrames  = 256;
+  static constexpr int kMaxBlockFrames  = 1 << 16;
+  static constexpr int kBlockValues     = 1 << 20;
 
   int m_framePos;
+  int m_blockFrames;
   bool m_playing;
+  bool m_timeKeyed;
   bool m_multiSource;
   bool m_isSerialStudioFile;
   QString m_filePath;
@@ -170,15 +214,21 @@ private:
   double m_startTimestamp;
   QElapsedTimer m_elapsedTimer;
   mdf::IChannel* m_masterTimeChannel;
-  std::vector<FrameIndex> m_frameIndex;
+
+  QFile m_file;
+  std::vector<double> m_frameTimes;
+  std::vector<RecordGroup> m_groups;
+  std::list<DecodedBlock> m_blocks;
   std::vector<mdf::IChannel*> m_channels;
   std::unique_ptr<mdf::MdfReader> m_reader;
-  std::map<uint64_t, double> m_timestampCache;
-  std::map<uint64_t, std::vector<double>> m_sampleCache;
-  std::map<uint64_t, std::vector<bool>> m_activeChannels;
 
   // Multi-source playback mapping: channel index → sourceId
   QMap<int, int> m_channelToSource;
   QMap<int, int> m_sourceChannelCount;
+
+  // Reused per-frame buffers for typed playback
+  std::vector<double> m_frameValues;
+  QSet<int> m_activeSources;
+  QMap<int, std::vector<double>> m_sourceValues;
 };
 }  // namespace MDF4
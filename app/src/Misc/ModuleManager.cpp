@@ -39,6 +39,7 @@
 #include "DataModel/OutputCodeEditor.h"
 #include "DataModel/ProjectEditor.h"
 #include "DataModel/ProjectModel.h"
+#include "DataModel/Reprocessor.h"
 #include "IO/ConnectionManager.h"
 #include "IO/FileTransmission.h"
 #include "MDF4/Export.h"
@@ -243,6 +244,7 @@ void Misc::ModuleManager::onQuit()
   Misc::ExtensionManager::instance().stopAllPlugins();
   Misc::TimerEvents::instance().stopTimers();
 
+  DataModel::Reprocessor::instance().cancel();
   CSV::Export::instance().closeFile();
   CSV::Player::instance().closeFile();
   MDF4::Export::instance().closeFile();
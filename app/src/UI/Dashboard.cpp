@@ -36,6 +36,7 @@
 #  include "MQTT/Client.h"
 #endif
 
+#include <algorithm>
 #include <QTimer>
 
 //--------------------------------------------------------------------------------------------------
@@ -44,6 +45,40 @@
 
 constexpr int kDefaultPlotPoints = 100;
 
+//--------------------------------------------------------------------------------------------------
+// Helper functions
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Builds the subscription key of a widget from its type and relative
+ *        index.
+ */
+static quint64 widgetKey(const SerialStudio::DashboardWidget widget, const int index)
+{
+  return (static_cast<quint64>(static_cast<quint32>(widget)) << 32) | static_cast<quint32>(index);
+}
+
+/**
+ * @brief Returns @c true if the widget keeps a history or a display filter, so
+ *        it must be refreshed on every frame of its source instead of only when
+ *        one of its datasets changes.
+ */
+static bool refreshesEveryFrame(const SerialStudio::DashboardWidget widget)
+{
+  switch (widget) {
+    case SerialStudio::DashboardFFT:
+    case SerialStudio::DashboardGPS:
+    case SerialStudio::DashboardPlot:
+    case SerialStudio::DashboardPlot3D:
+    case SerialStudio::DashboardGyroscope:
+    case SerialStudio::DashboardMultiPlot:
+    case SerialStudio::DashboardAccelerometer:
+      return true;
+    default:
+      return false;
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // Constructor & singleton access
 //--------------------------------------------------------------------------------------------------
@@ -115,6 +150,9 @@ UI::Dashboard::Dashboard()
       m_updateRequired = false;
       Q_EMIT updated();
     }
+
+    if (!m_dirtyWidgets.empty())
+      dispatchWidgetUpdates();
   });
 
   // Update action items when frame format changes
@@ -704,6 +742,143 @@ bool UI::Dashboard::multiplotRunning(const int index)
   return false;
 }
 
+//--------------------------------------------------------------------------------------------------
+// Widget update scheduling
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Registers the update callback of a dashboard widget.
+ *
+ * The callback runs on the UI timer, but only after a frame changed one of the
+ * widget's datasets (or, for plots and filtered widgets, after any frame of
+ * the widget's source), and only while the widget is visible. The widget is
+ * also refreshed once on the next tick, so that it shows the current values.
+ *
+ * Subscriptions are keyed by widget type and relative index, the same way
+ * widgets address their data, and are dropped when @p receiver is destroyed.
+ *
+ * @param widget   Type of the widget.
+ * @param index    Relative index of the widget within its type.
+ * @param receiver Object that owns the callback.
+ * @param callback Function that refreshes the widget.
+ */
+void UI::Dashboard::subscribeWidget(const SerialStudio::DashboardWidget widget,
+                                    const int index,
+                                    QObject* receiver,
+                                    std::function<void()> callback)
+{
+  Q_ASSERT(receiver);
+  Q_ASSERT(callback);
+
+  // Register the callback, dropping it when the receiver goes away
+  auto& subscribers = m_widgetSubscribers[widgetKey(widget, index)];
+  subscribers.push_back({receiver, std::move(callback)});
+  connect(receiver, &QObject::destroyed, this, &UI::Dashboard::unsubscribeWidget);
+
+  // Schedule an initial refresh of the widget
+  for (auto it = m_widgetMap.cbegin(); it != m_widgetMap.cend(); ++it) {
+    if (it.value().first == widget && it.value().second == index) {
+      if (it.key() < static_cast<int>(m_dirtyMask.size()))
+        markWidgetsDirty({it.key()});
+
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Shows or hides a single widget window for update scheduling.
+ *
+ * Hidden widgets are not refreshed. Changes received while a widget is hidden
+ * are kept, and the widget is refreshed on the first tick after it is shown.
+ *
+ * @param widgetIndex Global index of the widget (its window ID).
+ * @param visible     Whether the widget window is visible.
+ */
+void UI::Dashboard::setWidgetVisible(const int widgetIndex, const bool visible)
+{
+  if (widgetIndex >= 0 && widgetIndex < static_cast<int>(m_hiddenMask.size()))
+    m_hiddenMask[widgetIndex] = visible ? 0 : 1;
+}
+
+/**
+ * @brief Replaces the set of visible widgets.
+ *
+ * Every widget not listed in @p widgetIndices is hidden, e.g. the widgets of
+ * other workspaces or every widget while the main window is minimized.
+ *
+ * @param widgetIndices Global indices of the visible widgets.
+ */
+void UI::Dashboard::setVisibleWidgets(const QVector<int>& widgetIndices)
+{
+  std::fill(m_hiddenMask.begin(), m_hiddenMask.end(), 1);
+  for (const int index : widgetIndices)
+    setWidgetVisible(index, true);
+}
+
+/**
+ * @brief Runs the update callbacks of the dirty, visible widgets.
+ *
+ * Dirty widgets that are hidden keep their flag and stay in the dirty list.
+ */
+void UI::Dashboard::dispatchWidgetUpdates()
+{
+  Q_ASSERT(m_dirtyMask.size() == m_hiddenMask.size());
+
+  size_t pending = 0;
+  for (const int index : m_dirtyWidgets) {
+    if (m_hiddenMask[index]) {
+      m_dirtyWidgets[pending++] = index;
+      continue;
+    }
+
+    m_dirtyMask[index] = 0;
+
+    const auto widget = m_widgetMap.constFind(index);
+    if (widget == m_widgetMap.cend()) [[unlikely]]
+      continue;
+
+    const auto it = m_widgetSubscribers.constFind(widgetKey(widget->first, widget->second));
+    if (it == m_widgetSubscribers.cend())
+      continue;
+
+    for (const auto& subscriber : it.value())
+      subscriber.callback();
+  }
+
+  m_dirtyWidgets.resize(pending);
+}
+
+/**
+ * @brief Drops every update callback owned by @p receiver.
+ */
+void UI::Dashboard::unsubscribeWidget(QObject* receiver)
+{
+  for (auto it = m_widgetSubscribers.begin(); it != m_widgetSubscribers.end();) {
+    std::erase_if(it.value(),
+                  [receiver](const WidgetSubscriber& s) { return s.receiver == receiver; });
+
+    if (it.value().empty())
+      it = m_widgetSubscribers.erase(it);
+    else
+      ++it;
+  }
+}
+
+/**
+ * @brief Flags the given widgets for a refresh on the next UI tick.
+ */
+void UI::Dashboard::markWidgetsDirty(const std::vector<int>& widgets)
+{
+  for (const int index : widgets) {
+    auto& dirty = m_dirtyMask[index];
+    if (!dirty) {
+      dirty = 1;
+      m_dirtyWidgets.push_back(index);
+    }
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // UI configuration setters
 //--------------------------------------------------------------------------------------------------
@@ -783,6 +958,14 @@ void UI::Dashboard::resetData(const bool notify)
   m_widgetGroups.clear();
   m_widgetDatasets.clear();
   m_datasetReferences.clear();
+  m_datasetSlots.clear();
+
+  // Clear widget update scheduling state (subscriptions outlive the reset)
+  m_datasetWidgets.clear();
+  m_sourceWidgets.clear();
+  m_dirtyMask.clear();
+  m_hiddenMask.clear();
+  m_dirtyWidgets.clear();
 
   // Clear activity status flags for plot widgets
   m_activePlots.clear();
@@ -919,6 +1102,9 @@ void UI::Dashboard::removeTerminalWidget()
     for (int j = 0; j < count; ++j)
       m_widgetMap.insert(m_widgetCount++, qMakePair(i.key(), j));
   }
+
+  // Widget indices moved, rebuild the update dependencies
+  buildWidgetDependencies();
 }
 
 /**
@@ -953,6 +1139,7 @@ void UI::Dashboard::setTerminalEnabled(const bool enabled)
       m_terminalWidgetId = registry.createWidget(
         SerialStudio::DashboardTerminal, terminal.title, terminal.groupId, -1, true);
       m_widgetMap.insert(m_widgetCount++, qMakePair(SerialStudio::DashboardTerminal, 0));
+      buildWidgetDependencies();
     } else {
       removeTerminalWidget();
     }
@@ -1144,9 +1331,16 @@ void UI::Dashboard::setMultiplotRunning(const int index, const bool enabled)
  * frame structure with the current configuration. If the structure has changed,
  * the dashboard is reconfigured. Finally, updates dataset values and plots.
  *
+ * Sparse updates (non-empty @p dirty) from a source whose structure is
+ * already known skip the structure check and only propagate the refreshed
+ * datasets; the remaining datasets keep their last known values.
+ *
  * @param frame The new DataModel data frame to process.
+ * @param dirty Ordinals of the datasets refreshed by this update, or an empty
+ *              list if every dataset was refreshed.
  */
-void UI::Dashboard::hotpathRxFrame(const DataModel::Frame& frame)
+void UI::Dashboard::hotpathRxFrame(const DataModel::Frame& frame,
+                                   const DataModel::DirtyDatasets& dirty)
 {
   Q_ASSERT(!frame.groups.empty());
   Q_ASSERT(frame.sourceId >= 0);
@@ -1155,6 +1349,12 @@ void UI::Dashboard::hotpathRxFrame(const DataModel::Frame& frame)
   if (frame.groups.size() <= 0 || !streamAvailable()) [[unlikely]]
     return;
 
+  // Sparse update of a known structure, touch only the refreshed datasets
+  if (!dirty.empty() && updateDirtyDatasets(frame, dirty)) [[likely]] {
+    m_updateRequired = true;
+    return;
+  }
+
   const int sid             = frame.sourceId;
   const bool hadProFeatures = containsCommercialFeatures();
 
@@ -1236,7 +1436,10 @@ void UI::Dashboard::handleMissingDataset(const DataModel::Frame& frame)
  * @brief Updates dataset values and plot data based on the given frame.
  *
  * Iterates through groups and datasets in the frame, updating internal
- * data structures with the latest values.
+ * data structures with the latest values, and marks the widgets that show
+ * them as dirty. The first full update of each source also records its
+ * dataset slots, which updateDirtyDatasets() uses to apply later sparse
+ * updates without any lookups.
  *
  * @param frame The JSON frame containing new dataset values.
  */
@@ -1245,11 +1448,21 @@ void UI::Dashboard::updateDashboardData(const DataModel::Frame& frame)
   Q_ASSERT(!frame.groups.empty());
   Q_ASSERT(!m_datasetReferences.isEmpty());
 
+  const bool recordSlots = !m_datasetSlots.contains(frame.sourceId);
+  std::vector<DatasetSlot> slotList;
+
+  // Plots & filtered widgets of this source change with every frame
+  const auto sourceWidgets = m_sourceWidgets.constFind(frame.sourceId);
+  if (sourceWidgets != m_sourceWidgets.cend())
+    markWidgetsDirty(sourceWidgets.value());
+
   // Propagate new values to all dataset references
-  for (const auto& group : frame.groups) {
-    for (const auto& dataset : group.datasets) {
-      const auto uid = dataset.uniqueId;
-      const auto it  = m_datasetReferences.find(uid);
+  for (int g = 0; g < static_cast<int>(frame.groups.size()); ++g) {
+    const auto& group = frame.groups[g];
+    for (int d = 0; d < static_cast<int>(group.datasets.size()); ++d) {
+      const auto& dataset = group.datasets[d];
+      const auto uid      = dataset.uniqueId;
+      const auto it       = m_datasetReferences.find(uid);
 
       // Cannot find dataset UID; regenerate model and retry (once)
       if (it == m_datasetReferences.end()) [[unlikely]] {
@@ -1264,13 +1477,98 @@ void UI::Dashboard::updateDashboardData(const DataModel::Frame& frame)
         ptr->isNumeric    = dataset.isNumeric;
         ptr->numericValue = dataset.numericValue;
       }
+
+      // Flag the widgets that display this dataset
+      const auto widgets     = m_datasetWidgets.constFind(uid);
+      const auto* widgetList = widgets != m_datasetWidgets.cend() ? &widgets.value() : nullptr;
+      if (widgetList)
+        markWidgetsDirty(*widgetList);
+
+      if (recordSlots) [[unlikely]] {
+        const auto series     = m_datasetSeries.constFind(uid);
+        const auto* seriesList = series != m_datasetSeries.cend() ? &series.value() : nullptr;
+        slotList.push_back({g, d, uid, &datasets, widgetList, seriesList});
+      }
     }
   }
 
+  if (recordSlots) [[unlikely]]
+    m_datasetSlots.insert(frame.sourceId, std::move(slotList));
+
   // Update plots & time-series widgets (only for this source)
   updateDataSeries(frame.sourceId);
 }
 
+/**
+ * @brief Propagates only the refreshed datasets of a sparse update.
+ *
+ * Uses the dataset slots recorded by the last full update of the frame's
+ * source. Returns @c false, so the caller falls back to a full update, if no
+ * slots are known for the source or if an ordinal no longer matches them.
+ *
+ * Only the plots, FFTs, GPS maps and other per-frame widgets that depend on
+ * a refreshed dataset receive a new sample, so the work done per update is
+ * proportional to the refreshed datasets rather than to the whole source.
+ *
+ * @param frame The frame containing the refreshed dataset values.
+ * @param dirty Ordinals of the refreshed datasets.
+ * @return @c true if the sparse update was applied.
+ */
+bool UI::Dashboard::updateDirtyDatasets(const DataModel::Frame& frame,
+                                        const DataModel::DirtyDatasets& dirty)
+{
+  Q_ASSERT(!dirty.empty());
+
+  const auto it = m_datasetSlots.constFind(frame.sourceId);
+  if (it == m_datasetSlots.cend()) [[unlikely]]
+    return false;
+
+  const auto& slotList  = it.value();
+  const auto groupCount = static_cast<int>(frame.groups.size());
+  m_seriesScratch.clear();
+  for (const auto ordinal : dirty) {
+    if (ordinal >= slotList.size()) [[unlikely]]
+      return false;
+
+    const auto& slot = slotList[ordinal];
+    if (slot.group >= groupCount) [[unlikely]]
+      return false;
+
+    const auto& datasets = frame.groups[slot.group].datasets;
+    if (slot.dataset >= static_cast<int>(datasets.size())) [[unlikely]]
+      return false;
+
+    const auto& dataset = datasets[slot.dataset];
+    if (dataset.uniqueId != slot.uniqueId) [[unlikely]]
+      return false;
+
+    for (auto* ptr : *slot.refs) {
+      ptr->value        = dataset.value;
+      ptr->isNumeric    = dataset.isNumeric;
+      ptr->numericValue = dataset.numericValue;
+    }
+
+    if (slot.widgets)
+      markWidgetsDirty(*slot.widgets);
+
+    if (slot.series)
+      m_seriesScratch.insert(m_seriesScratch.end(), slot.series->begin(), slot.series->end());
+  }
+
+  // Advance each affected series once, even if several of its datasets changed
+  std::sort(m_seriesScratch.begin(), m_seriesScratch.end());
+  m_seriesScratch.erase(std::unique(m_seriesScratch.begin(), m_seriesScratch.end()),
+                        m_seriesScratch.end());
+
+  QSet<int> xAxesMoved;
+  QSet<int> yAxesMoved;
+  for (const int index : m_seriesScratch)
+    updateSeriesWidget(index, xAxesMoved, yAxesMoved);
+
+  markWidgetsDirty(m_seriesScratch);
+  return true;
+}
+
 /**
  * @brief Registers a dataset's index and per-widget-key mappings.
  *
@@ -1367,6 +1665,9 @@ void UI::Dashboard::reconfigureDashboard(const DataModel::Frame& frame)
   // Register all widgets with the dashboard registry
   registerWidgets();
 
+  // Map datasets & sources to the widgets that must be refreshed
+  buildWidgetDependencies();
+
   // Build dataset reference maps for value propagation
   buildDatasetReferences();
 
@@ -1504,6 +1805,9 @@ void UI::Dashboard::buildDatasetReferences()
   Q_ASSERT(!m_lastFrame.groups.empty());
   Q_ASSERT(!m_widgetGroups.isEmpty() || !m_widgetDatasets.isEmpty());
 
+  // Cached slots point into the previous reference lists
+  m_datasetSlots.clear();
+
   // Traverse all group-level datasets
   for (auto& groupList : m_widgetGroups) {
     for (auto& group : groupList)
@@ -1530,6 +1834,91 @@ void UI::Dashboard::buildDatasetReferences()
   }
 }
 
+/**
+ * @brief Maps every dataset and source to the widgets that display it.
+ *
+ * Value widgets (bars, gauges, compasses, data grids and LED panels) are
+ * refreshed only when one of their datasets changes, so a sparse update
+ * touches only the widgets that show the refreshed datasets. Plots and
+ * widgets with a display filter are refreshed on every full frame of their
+ * source, since their history or filter state advances even if the value
+ * repeats. Sparse updates advance them only when one of their datasets was
+ * refreshed; plots sharing a custom X axis advance together so that their
+ * samples stay aligned.
+ *
+ * Also resets the dirty and hidden flags, since widget indices may have moved.
+ */
+void UI::Dashboard::buildWidgetDependencies()
+{
+  Q_ASSERT(m_widgetMap.size() == m_widgetCount);
+
+  // Cached slots point into the previous dependency lists
+  m_datasetSlots.clear();
+  m_datasetWidgets.clear();
+  m_sourceWidgets.clear();
+  m_datasetSeries.clear();
+  m_dirtyWidgets.clear();
+  m_dirtyMask.assign(m_widgetCount, 0);
+  m_hiddenMask.assign(m_widgetCount, 0);
+
+  // Plots by custom X axis, and the Y datasets of each of those axes
+  QMap<int, std::vector<int>> xAxisPlots;
+  QMap<int, std::vector<int>> xAxisDatasets;
+
+  for (auto it = m_widgetMap.cbegin(); it != m_widgetMap.cend(); ++it) {
+    const int index     = it.key();
+    const auto widget   = it.value().first;
+    const int relIndex  = it.value().second;
+    const bool perFrame = refreshesEveryFrame(widget);
+
+    // Group widgets depend on all datasets of the group
+    if (SerialStudio::isGroupWidget(widget)) {
+      const auto& group = getGroupWidget(widget, relIndex);
+      if (group.datasets.empty())
+        continue;
+
+      if (perFrame)
+        m_sourceWidgets[group.sourceId].push_back(index);
+
+      auto& dependencies = perFrame ? m_datasetSeries : m_datasetWidgets;
+      for (const auto& dataset : group.datasets)
+        dependencies[dataset.uniqueId].push_back(index);
+    }
+
+    // Dataset widgets depend on a single dataset
+    else if (SerialStudio::isDatasetWidget(widget)) {
+      const auto& dataset = getDatasetWidget(widget, relIndex);
+      if (!perFrame) {
+        m_datasetWidgets[dataset.uniqueId].push_back(index);
+        continue;
+      }
+
+      m_sourceWidgets[dataset.sourceId].push_back(index);
+      m_datasetSeries[dataset.uniqueId].push_back(index);
+
+      const int xAxisId = widget == SerialStudio::DashboardPlot ? plotXAxisId(dataset) : -1;
+      if (xAxisId >= 0) {
+        xAxisPlots[xAxisId].push_back(index);
+        xAxisDatasets[xAxisId].push_back(dataset.uniqueId);
+      }
+    }
+  }
+
+  // Any refreshed Y dataset advances every plot that shares its X axis
+  for (auto it = xAxisPlots.cbegin(); it != xAxisPlots.cend(); ++it) {
+    const auto& plots = it.value();
+    if (plots.size() < 2)
+      continue;
+
+    for (const int uid : xAxisDatasets[it.key()]) {
+      auto& series = m_datasetSeries[uid];
+      for (const int plot : plots)
+        if (std::find(series.begin(), series.end(), plot) == series.end())
+          series.push_back(plot);
+    }
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // Data series configuration
 //--------------------------------------------------------------------------------------------------
@@ -1579,17 +1968,9 @@ void UI::Dashboard::updateDataSeries(int sourceId)
 
   // Update multi-plots
   for (int i = 0; i < multiCount; ++i) {
-    if (!m_activeMultiplots[i])
-      continue;
-
     const auto& group = getGroupWidget(SerialStudio::DashboardMultiPlot, i);
-    if (sourceId >= 0 && group.sourceId != sourceId)
-      continue;
-
-    auto& multiSeries = m_multipltValues[i];
-    const size_t yCount = multiSeries.y.size();
-    for (size_t j = 0; j < group.datasets.size() && j < yCount; ++j)
-      multiSeries.y[j].push(group.datasets[j].numericValue);
+    if (sourceId < 0 || group.sourceId == sourceId)
+      pushMultiplotSample(i);
   }
 
   // Update 3D plots
@@ -1613,14 +1994,9 @@ void UI::Dashboard::updateFftSeries(int sourceId)
   Q_ASSERT(m_activeFFTPlots.size() == fftCount);
 
   for (int i = 0; i < fftCount; ++i) {
-    if (!m_activeFFTPlots[i])
-      continue;
-
     const auto& dataset = getDatasetWidget(SerialStudio::DashboardFFT, i);
-    if (sourceId >= 0 && dataset.sourceId != sourceId)
-      continue;
-
-    m_fftValues[i].push(dataset.numericValue);
+    if (sourceId < 0 || dataset.sourceId == sourceId)
+      pushFftSample(i);
   }
 }
 
@@ -1640,31 +2016,38 @@ void UI::Dashboard::updateGpsSeries(int sourceId)
 
   for (int i = 0; i < gpsCount; ++i) {
     const auto& group = getGroupWidget(SerialStudio::DashboardGPS, i);
-    if (sourceId >= 0 && group.sourceId != sourceId)
-      continue;
-
-    auto& series = m_gpsValues[i];
+    if (sourceId < 0 || group.sourceId == sourceId)
+      pushGpsSample(i);
+  }
+}
 
-    // Extract lat/lon/alt from the group's datasets
-    double lat = std::nan(""), lon = std::nan(""), alt = std::nan("");
-    for (const auto& dataset : group.datasets) {
-      if (!dataset.isNumeric)
-        continue;
+/**
+ * @brief Appends the current position of GPS widget @p index to its trajectory.
+ */
+void UI::Dashboard::pushGpsSample(int index)
+{
+  const auto& group = getGroupWidget(SerialStudio::DashboardGPS, index);
+  auto& series      = m_gpsValues[index];
 
-      const QString& id = dataset.widget;
-      if (id == "lat")
-        lat = dataset.numericValue;
-      else if (id == "lon")
-        lon = dataset.numericValue;
-      else if (id == "alt")
-        alt = dataset.numericValue;
-    }
+  // Extract lat/lon/alt from the group's datasets
+  double lat = std::nan(""), lon = std::nan(""), alt = std::nan("");
+  for (const auto& dataset : group.datasets) {
+    if (!dataset.isNumeric)
+      continue;
 
-    // Append coordinates to the trajectory ring buffers
-    series.latitudes.push(lat);
-    series.longitudes.push(lon);
-    series.altitudes.push(alt);
+    const QString& id = dataset.widget;
+    if (id == "lat")
+      lat = dataset.numericValue;
+    else if (id == "lon")
+      lon = dataset.numericValue;
+    else if (id == "alt")
+      alt = dataset.numericValue;
   }
+
+  // Append coordinates to the trajectory ring buffers
+  series.latitudes.push(lat);
+  series.longitudes.push(lon);
+  series.altitudes.push(alt);
 }
 
 /**
@@ -1685,34 +2068,45 @@ void UI::Dashboard::updatePlot3DSeries(int sourceId)
 
   for (int i = 0; i < plot3DCount; ++i) {
     const auto& group = getGroupWidget(SerialStudio::DashboardPlot3D, i);
-    if (sourceId >= 0 && group.sourceId != sourceId)
-      continue;
-
-    auto& plotData = m_plotData3D[i];
-
-    // Extract X/Y/Z components from the group's datasets
-    QVector3D point;
-    for (const auto& dataset : group.datasets) {
-      const QString& id = dataset.widget;
-      if (id == "x" || id == "X")
-        point.setX(dataset.numericValue);
-      else if (id == "y" || id == "Y")
-        point.setY(dataset.numericValue);
-      else if (id == "z" || id == "Z")
-        point.setZ(dataset.numericValue);
-    }
-
-    // Append point and trim to configured maximum
-    plotData.push_back(point);
-    const size_t maxPoints = static_cast<size_t>(points());
-    if (plotData.size() > maxPoints)
-      plotData.erase(plotData.begin(), plotData.end() - maxPoints);
+    if (sourceId < 0 || group.sourceId == sourceId)
+      pushPlot3DSample(i);
   }
 #else
   (void)sourceId;
 #endif
 }
 
+/**
+ * @brief Appends the current point of 3D plot widget @p index to its trajectory.
+ */
+void UI::Dashboard::pushPlot3DSample(int index)
+{
+#ifdef BUILD_COMMERCIAL
+  const auto& group = getGroupWidget(SerialStudio::DashboardPlot3D, index);
+  auto& plotData    = m_plotData3D[index];
+
+  // Extract X/Y/Z components from the group's datasets
+  QVector3D point;
+  for (const auto& dataset : group.datasets) {
+    const QString& id = dataset.widget;
+    if (id == "x" || id == "X")
+      point.setX(dataset.numericValue);
+    else if (id == "y" || id == "Y")
+      point.setY(dataset.numericValue);
+    else if (id == "z" || id == "Z")
+      point.setZ(dataset.numericValue);
+  }
+
+  // Append point and trim to configured maximum
+  plotData.push_back(point);
+  const size_t maxPoints = static_cast<size_t>(points());
+  if (plotData.size() > maxPoints)
+    plotData.erase(plotData.begin(), plotData.end() - maxPoints);
+#else
+  (void)index;
+#endif
+}
+
 /**
  * @brief Updates linear plot data series for all active plot widgets.
  *
@@ -1733,34 +2127,121 @@ void UI::Dashboard::updateLineSeries(int sourceId)
   QSet<int> xAxesMoved;
   QSet<int> yAxesMoved;
   for (int i = 0; i < plotCount; ++i) {
-    if (!m_activePlots[i])
-      continue;
-
     const auto& yDataset = getDatasetWidget(SerialStudio::DashboardPlot, i);
-    if (sourceId >= 0 && yDataset.sourceId != sourceId)
-      continue;
+    if (sourceId < 0 || yDataset.sourceId == sourceId)
+      pushLineSample(i, xAxesMoved, yAxesMoved);
+  }
+}
 
-    // Shift Y-axis points
-    if (!yAxesMoved.contains(yDataset.index)) {
-      yAxesMoved.insert(yDataset.index);
-      m_yAxisData[yDataset.index].push(yDataset.numericValue);
-    }
+/**
+ * @brief Appends the current X/Y values of plot widget @p index.
+ *
+ * Axes listed in @p xAxesMoved or @p yAxesMoved were already advanced in this
+ * update cycle and are skipped; the ones advanced here are added to the sets.
+ */
+void UI::Dashboard::pushLineSample(int index, QSet<int>& xAxesMoved, QSet<int>& yAxesMoved)
+{
+  if (!m_activePlots[index])
+    return;
 
-    // Shift X-axis points
+  // Shift Y-axis points
+  const auto& yDataset = getDatasetWidget(SerialStudio::DashboardPlot, index);
+  if (!yAxesMoved.contains(yDataset.index)) {
+    yAxesMoved.insert(yDataset.index);
+    m_yAxisData[yDataset.index].push(yDataset.numericValue);
+  }
+
+  // Shift X-axis points
+  const int xAxisId = plotXAxisId(yDataset);
+  if (xAxisId >= 0 && !xAxesMoved.contains(xAxisId)) {
+    xAxesMoved.insert(xAxisId);
+    const auto& xDataset = m_datasets[xAxisId];
+    m_xAxisData[xAxisId].push(xDataset.numericValue);
+  }
+}
+
+/**
+ * @brief Returns the dataset index that plot dataset @p yDataset uses as its
+ *        X axis, or -1 if it has none.
+ *
+ * Custom X axes are a Pro feature; without a license every plot uses the
+ * dataset with index 0 as its X axis, if there is one.
+ */
+int UI::Dashboard::plotXAxisId(const DataModel::Dataset& yDataset) const
+{
 #ifdef BUILD_COMMERCIAL
-    const auto& tk = Licensing::CommercialToken::current();
-    auto xAxisId =
-      (tk.isValid() && SS_LICENSE_GUARD() && tk.featureTier() >= Licensing::FeatureTier::Trial)
-        ? yDataset.xAxisId
-        : 0;
+  const auto& tk = Licensing::CommercialToken::current();
+  const int xAxisId =
+    (tk.isValid() && SS_LICENSE_GUARD() && tk.featureTier() >= Licensing::FeatureTier::Trial)
+      ? yDataset.xAxisId
+      : 0;
 #else
-    auto xAxisId = 0;
+  (void)yDataset;
+  const int xAxisId = 0;
 #endif
-    if (m_datasets.contains(xAxisId) && !xAxesMoved.contains(xAxisId)) {
-      xAxesMoved.insert(xAxisId);
-      const auto& xDataset = m_datasets[xAxisId];
-      m_xAxisData[xAxisId].push(xDataset.numericValue);
-    }
+
+  return m_datasets.contains(xAxisId) ? xAxisId : -1;
+}
+
+/**
+ * @brief Appends the current value of FFT widget @p index to its sample window.
+ */
+void UI::Dashboard::pushFftSample(int index)
+{
+  if (!m_activeFFTPlots[index])
+    return;
+
+  const auto& dataset = getDatasetWidget(SerialStudio::DashboardFFT, index);
+  m_fftValues[index].push(dataset.numericValue);
+}
+
+/**
+ * @brief Appends the current values of multiplot widget @p index to its curves.
+ */
+void UI::Dashboard::pushMultiplotSample(int index)
+{
+  if (!m_activeMultiplots[index])
+    return;
+
+  const auto& group   = getGroupWidget(SerialStudio::DashboardMultiPlot, index);
+  auto& multiSeries   = m_multipltValues[index];
+  const size_t yCount = multiSeries.y.size();
+  for (size_t j = 0; j < group.datasets.size() && j < yCount; ++j)
+    multiSeries.y[j].push(group.datasets[j].numericValue);
+}
+
+/**
+ * @brief Advances the history of the per-frame widget with global @p index.
+ *
+ * Used by sparse updates, which only advance the widgets that depend on a
+ * refreshed dataset. Widgets without a history (e.g. gyroscopes) are left
+ * alone; marking them dirty is enough.
+ */
+void UI::Dashboard::updateSeriesWidget(int index, QSet<int>& xAxesMoved, QSet<int>& yAxesMoved)
+{
+  const auto it = m_widgetMap.constFind(index);
+  if (it == m_widgetMap.cend()) [[unlikely]]
+    return;
+
+  const int relIndex = it.value().second;
+  switch (it.value().first) {
+    case SerialStudio::DashboardFFT:
+      pushFftSample(relIndex);
+      break;
+    case SerialStudio::DashboardGPS:
+      pushGpsSample(relIndex);
+      break;
+    case SerialStudio::DashboardPlot:
+      pushLineSample(relIndex, xAxesMoved, yAxesMoved);
+      break;
+    case SerialStudio::DashboardPlot3D:
+      pushPlot3DSample(relIndex);
+      break;
+    case SerialStudio::DashboardMultiPlot:
+      pushMultiplotSample(relIndex);
+      break;
+    default:
+      break;
   }
 }
 
@@ -21,8 +21,11 @@
 
 #pragma once
 
+#include <functional>
 #include <QFont>
+#include <QHash>
 #include <QObject>
+#include <QSet>
 #include <QSettings>
 
 #include "DSP.h"
@@ -42,6 +45,12 @@ namespace UI {
  * real-time data for different plot types (linear, FFT, multiplot) and supports
  * actions that can be triggered from the UI.
  *
+ * Widgets do not poll the dashboard. Each widget subscribes to its own updates
+ * with subscribeWidget(), incoming frames mark the widgets whose datasets
+ * changed as dirty, and every UI tick only the dirty widgets that the taskbar
+ * reports as visible are refreshed. Hidden widgets stay dirty until they are
+ * shown again.
+ *
  * Properties notify changes to dynamically adjust UI elements like widget
  * visibility and count.
  *
@@ -160,6 +169,11 @@ public:
   [[nodiscard]] bool fftPlotRunning(const int index);
   [[nodiscard]] bool multiplotRunning(const int index);
 
+  void subscribeWidget(const SerialStudio::DashboardWidget widget,
+                       const int index,
+                       QObject* receiver,
+                       std::function<void()> callback);
+
 public slots:
   void setPoints(const int points);
   void resetData(const bool notify = true);
@@ -168,16 +182,34 @@ public slots:
   void setTerminalEnabled(const bool enabled);
   void setAutoHideToolbar(const bool enabled);
   void setShowTaskbarButtons(const bool enabled);
+  void setWidgetVisible(const int widgetIndex, const bool visible);
+  void setVisibleWidgets(const QVector<int>& widgetIndices);
   void activateAction(const int index, const bool guiTrigger = false);
 
   void setPlotRunning(const int index, const bool enabled);
   void setFFTPlotRunning(const int index, const bool enabled);
   void setMultiplotRunning(const int index, const bool enabled);
 
-  void hotpathRxFrame(const DataModel::Frame& frame);
+  void hotpathRxFrame(const DataModel::Frame& frame, const DataModel::DirtyDatasets& dirty = {});
 
 private:
+  struct DatasetSlot {
+    int group;
+    int dataset;
+    int uniqueId;
+    const QVector<DataModel::Dataset*>* refs;
+    const std::vector<int>* widgets;
+    const std::vector<int>* series;
+  };
+
+  struct WidgetSubscriber {
+    QObject* receiver;
+    std::function<void()> callback;
+  };
+
   void updateDashboardData(const DataModel::Frame& frame);
+  [[nodiscard]] bool updateDirtyDatasets(const DataModel::Frame& frame,
+                                         const DataModel::DirtyDatasets& dirty);
   void reconfigureDashboard(const DataModel::Frame& frame);
   void processDatasetIntoWidgetMaps(const DataModel::Dataset& dataset, DataModel::Group& ledPanel);
   void removeTerminalWidget();
@@ -189,6 +221,14 @@ private:
   void updateGpsSeries(int sourceId);
   void updatePlot3DSeries(int sourceId);
   void updateLineSeries(int sourceId);
+  void updateSeriesWidget(int index, QSet<int>& xAxesMoved, QSet<int>& yAxesMoved);
+
+  void pushFftSample(int index);
+  void pushGpsSample(int index);
+  void pushPlot3DSample(int index);
+  void pushMultiplotSample(int index);
+  void pushLineSample(int index, QSet<int>& xAxesMoved, QSet<int>& yAxesMoved);
+  [[nodiscard]] int plotXAxisId(const DataModel::Dataset& yDataset) const;
 
   void configureGpsSeries();
   void configureFftSeries();
@@ -200,6 +240,11 @@ private:
   void buildWidgetGroups(const DataModel::Frame& frame, bool pro);
   void registerWidgets();
   void buildDatasetReferences();
+  void buildWidgetDependencies();
+
+  void dispatchWidgetUpdates();
+  void unsubscribeWidget(QObject* receiver);
+  void markWidgetsDirty(const std::vector<int>& widgets);
 
 private:
   QSettings m_settings;
@@ -241,6 +286,27 @@ private:
   // Maps unique dataset ID to all dataset refs for value updates
   QMap<int, QVector<DataModel::Dataset*>> m_datasetReferences;
 
+  // Per-source dataset refs by schema-order ordinal, for sparse updates
+  QMap<int, std::vector<DatasetSlot>> m_datasetSlots;
+
+  // Widget indices to refresh when a dataset (by unique ID) changes
+  QMap<int, std::vector<int>> m_datasetWidgets;
+
+  // Widget indices to refresh on every frame of a source (by source ID)
+  QMap<int, std::vector<int>> m_sourceWidgets;
+
+  // Per-frame widgets to advance when a dataset (by unique ID) changes
+  QMap<int, std::vector<int>> m_datasetSeries;
+  std::vector<int> m_seriesScratch;
+
+  // Per-widget dirty & hidden flags, and the dirty widgets in marking order
+  std::vector<quint8> m_dirtyMask;
+  std::vector<quint8> m_hiddenMask;
+  std::vector<int> m_dirtyWidgets;
+
+  // Update callbacks by widget type & relative index
+  QHash<quint64, std::vector<WidgetSubscriber>> m_widgetSubscribers;
+
   // Groups by widgets type
   QMap<SerialStudio::DashboardWidget, QVector<DataModel::Group>> m_widgetGroups;
 
@@ -22,6 +22,7 @@
 #include "Taskbar.h"
 
 #include <algorithm>
+#include <QQuickWindow>
 #include <QSignalBlocker>
 #include <QTimer>
 
@@ -33,6 +34,22 @@
 #include "UI/WidgetRegistry.h"
 #include "UI/WindowManager.h"
 
+//--------------------------------------------------------------------------------------------------
+// Helper functions
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns @c true unless the main window is minimized or hidden.
+ */
+static bool mainWindowShown(const QQuickWindow* window)
+{
+  if (!window)
+    return true;
+
+  const auto visibility = window->visibility();
+  return visibility != QWindow::Minimized && visibility != QWindow::Hidden;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Taskbar model implementation
 //--------------------------------------------------------------------------------------------------
@@ -128,6 +145,19 @@ UI::Taskbar::Taskbar(QQuickItem* parent)
           this,
           &UI::Taskbar::onTerminalToggled);
 
+  // Only refresh the widgets shown in the taskbar's workspace
+  connect(this, &UI::Taskbar::taskbarButtonsChanged, this, &UI::Taskbar::syncWidgetVisibility);
+
+  // Pause every widget while the main window is minimized
+  connect(this, &QQuickItem::windowChanged, this, [this](QQuickWindow* window) {
+    disconnect(m_windowVisibilityConnection);
+    if (window)
+      m_windowVisibilityConnection = connect(
+        window, &QWindow::visibilityChanged, this, &UI::Taskbar::syncWidgetVisibility);
+
+    syncWidgetVisibility();
+  });
+
   // Sync active group selection with the project model
   auto* pm = &DataModel::ProjectModel::instance();
   connect(pm, &DataModel::ProjectModel::activeGroupIdChanged, this, [this, pm] {
@@ -789,6 +819,10 @@ void UI::Taskbar::setWindowState(const int id, const UI::TaskbarModel::WindowSta
   item->setData(state, UI::TaskbarModel::WindowStateRole);
   Q_EMIT windowStatesChanged();
 
+  // Stop refreshing minimized or closed widgets
+  const bool visible = state == TaskbarModel::WindowNormal && mainWindowShown(window());
+  UI::Dashboard::instance().setWidgetVisible(id, visible);
+
   // Trigger a layout refresh when all windows are registered
   if (m_windowIDs.count() >= m_taskbarButtons->rowCount() && m_windowManager)
     m_windowManager->triggerLayoutUpdate();
@@ -1292,6 +1326,34 @@ void UI::Taskbar::onTerminalToggled()
   Q_EMIT searchResultsChanged();
 }
 
+/**
+ * @brief Reports the visible dashboard windows to UI::Dashboard.
+ *
+ * A window is visible if it has a button in the active workspace and is
+ * neither minimized nor closed. While the main window is minimized or hidden,
+ * no dashboard window is visible. Widgets that are not reported are not
+ * refreshed until they are shown again.
+ */
+void UI::Taskbar::syncWidgetVisibility()
+{
+  QVector<int> visible;
+  if (mainWindowShown(window())) {
+    visible.reserve(m_taskbarButtons->rowCount());
+    for (int i = 0; i < m_taskbarButtons->rowCount(); ++i) {
+      const auto* button = m_taskbarButtons->item(i);
+      if (!button)
+        continue;
+
+      const int windowId = button->data(TaskbarModel::WindowIdRole).toInt();
+      const auto* item   = findItemByWindowId(windowId);
+      if (item && item->data(TaskbarModel::WindowStateRole).toInt() == TaskbarModel::WindowNormal)
+        visible.append(windowId);
+    }
+  }
+
+  UI::Dashboard::instance().setVisibleWidgets(visible);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Search functionality
 //--------------------------------------------------------------------------------------------------
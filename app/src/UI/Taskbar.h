@@ -98,6 +98,9 @@ public:
  * - React to dashboard updates (`rebuildModel()`)
  * - Maintain per-window state using `WindowStateRole`
  * - Provide a clear interface to manipulate visibility from QML
+ * - Report the visible windows to UI::Dashboard, so that minimized, closed
+ *   and off-workspace widgets, or all widgets while the main window is
+ *   minimized, are not refreshed
  *
  * Usage:
  * - Exposed as a singleton via context property
@@ -211,6 +214,7 @@ public slots:
 
 private slots:
   void onTerminalToggled();
+  void syncWidgetVisibility();
   void onRegistryCleared();
   void onBatchUpdateCompleted();
   void onWidgetCreated(UI::WidgetID id, const UI::WidgetInfo& info);
@@ -236,6 +240,7 @@ private:
   UI::WindowManager* m_windowManager;
   QMap<QQuickItem*, int> m_windowIDs;
   QMap<QQuickItem*, QMetaObject::Connection> m_windowConnections;
+  QMetaObject::Connection m_windowVisibilityConnection;
 
   QMap<UI::WidgetID, int> m_widgetIdToWindowId;
   QMap<int, UI::WidgetID> m_windowIdToWidgetId;
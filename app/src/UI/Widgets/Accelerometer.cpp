@@ -50,7 +50,8 @@ Widgets::Accelerometer::Accelerometer(const int index, QQuickItem* parent)
   , m_filterInitialized(false)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardAccelerometer, m_index))
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Accelerometer::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardAccelerometer, m_index, this, [this] { updateData(); });
 }
 
 //--------------------------------------------------------------------------------------------------
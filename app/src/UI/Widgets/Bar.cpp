@@ -70,7 +70,8 @@ Widgets::Bar::Bar(const int index, QQuickItem* parent, bool autoInitFromBarDatas
                      || (m_alarmHigh < m_maxValue && m_alarmHigh > m_minValue);
     }
 
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Bar::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardBar, m_index, this, [this] { updateData(); });
   }
 }
 
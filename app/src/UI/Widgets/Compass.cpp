@@ -37,7 +37,8 @@ Widgets::Compass::Compass(const int index, QQuickItem* parent)
   : QQuickItem(parent), m_index(index), m_value(0)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardCompass, m_index))
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Compass::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardCompass, m_index, this, [this] { updateData(); });
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -53,8 +53,8 @@ Widgets::DataGrid::DataGrid(const int index, QQuickItem* parent)
 
   setData(rows);
   onFontsChanged();
-  connect(
-    &UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Widgets::DataGrid::updateData);
+  UI::Dashboard::instance().subscribeWidget(
+    SerialStudio::DashboardDataGrid, m_index, this, [this] { updateData(); });
   connect(&Misc::CommonFonts::instance(),
           &Misc::CommonFonts::fontsChanged,
           this,
@@ -146,15 +146,13 @@ void Widgets::DataGrid::updateData()
 
   // Update values for every dataset in the group
   for (size_t i = 0; i < group.datasets.size(); ++i) {
-    // Obtain a reference to the dataset object & read its value
+    // Obtain a reference to the dataset object & format its value
     const auto& dataset = group.datasets[i];
-    QString value       = dataset.value;
-
-    // Convert the dataset to a number if needed
-    bool isNumber;
-    const double n = value.toDouble(&isNumber);
-    if (isNumber)
-      value = FMT_VAL(n, dataset);
+    QString value;
+    if (dataset.isNumeric)
+      value = FMT_VAL(dataset.numericValue, dataset);
+    else
+      value = dataset.value;
 
     // Append dataset units (if available)
     if (!dataset.units.isEmpty())
@@ -206,7 +204,7 @@ QStringList Widgets::DataGrid::getRow(const DataModel::Dataset& dataset)
   const QString title = dataset.title;
   const QString units = dataset.units;
 
-  QString value = dataset.value;
+  QString value = DataModel::dataset_text(dataset);
   if (!units.isEmpty())
     value += " " + units;
 
@@ -130,6 +130,10 @@ Widgets::FFTPlot::FFTPlot(const int index, QQuickItem* parent)
         m_halfRange    = qMax(1e-12, (maxVal - minVal) * 0.5);
       }
     }
+
+    // Redraw the spectrum when new samples arrive
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardFFT, m_index, this, [this] { Q_EMIT updated(); });
   }
 }
 
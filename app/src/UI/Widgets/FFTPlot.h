@@ -90,6 +90,7 @@ class FFTPlot : public QQuickItem {
   // clang-format on
 
 signals:
+  void updated();
   void runningChanged();
   void dataSizeChanged();
 
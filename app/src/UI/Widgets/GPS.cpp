@@ -148,7 +148,8 @@ Widgets::GPS::GPS(const int index, QQuickItem* parent)
   // Configure signals/slots with the dashboard
   if (VALIDATE_WIDGET(SerialStudio::DashboardGPS, m_index)) {
     updateData();
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Widgets::GPS::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardGPS, m_index, this, [this] { updateData(); });
     center();
   }
 }
@@ -61,7 +61,8 @@ Widgets::Gauge::Gauge(const int index, QQuickItem* parent) : Bar(index, parent,
                      || (m_alarmHigh < m_maxValue && m_alarmHigh > m_minValue);
     }
 
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Gauge::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardGauge, m_index, this, [this] { updateData(); });
   }
 }
 
@@ -48,7 +48,8 @@ Widgets::Gyroscope::Gyroscope(const int index, QQuickItem* parent)
   , m_displayFilterInitialized(false)
 {
   if (VALIDATE_WIDGET(SerialStudio::DashboardGyroscope, m_index))
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Gyroscope::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardGyroscope, m_index, this, [this] { updateData(); });
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -514,6 +514,15 @@ void Widgets::ImageView::reconfigureReader()
 
   connect(driver, &IO::HAL_Driver::dataReceived, m_reader, &ImageFrameReader::processData);
 
+  auto* reader = m_reader;
+  connect(driver,
+          &IO::HAL_Driver::datagramsReceived,
+          reader,
+          [reader](const IO::DatagramBatchPtr& batch) {
+            if (batch)
+              reader->processData(IO::makeByteArray(batch->payload()));
+          });
+
   connect(
     m_reader, &ImageFrameReader::frameReady, this, &ImageView::onFrameReady, Qt::QueuedConnection);
 }
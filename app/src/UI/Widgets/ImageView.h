@@ -34,7 +34,8 @@ namespace Widgets {
  * @brief Per-widget secondary frame reader that extracts binary image frames
  *        from the raw HAL driver byte stream.
  *
- * Connects directly to @c IO::HAL_Driver::dataReceived via a
+ * Connects directly to @c IO::HAL_Driver::dataReceived (and to
+ * @c IO::HAL_Driver::datagramsReceived for UDP sockets) via a
  * @c Qt::QueuedConnection, completely independently of the main telemetry
  * @c IO::FrameReader. This means image data and CSV/JSON telemetry can
  * co-exist in the same byte stream without interfering with each other.
@@ -47,7 +47,8 @@ Widgets::LEDPanel::LEDPanel(const int index, QQuickItem* parent)
       m_titles[i] = group.datasets[i].title;
     }
 
-    connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &LEDPanel::updateData);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardLED, m_index, this, [this] { updateData(); });
 
     onThemeChanged();
     connect(&Misc::ThemeManager::instance(),
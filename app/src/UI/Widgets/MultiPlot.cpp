@@ -86,6 +86,8 @@ Widgets::MultiPlot::MultiPlot(const int index, QQuickItem* parent)
 
   // Connect to the dashboard signals
   connect(&UI::Dashboard::instance(), &UI::Dashboard::pointsChanged, this, &MultiPlot::updateRange);
+  UI::Dashboard::instance().subscribeWidget(
+    SerialStudio::DashboardMultiPlot, m_index, this, [this] { Q_EMIT updated(); });
 
   // Connect to the theme manager to update the curve colors
   onThemeChanged();
@@ -294,9 +296,6 @@ void Widgets::MultiPlot::setRunning(const bool enabled)
  */
 void Widgets::MultiPlot::updateData()
 {
-  // Share workspace data
-  static thread_local DSP::DownsampleWorkspace ws;
-
   // Stop if widget is disabled
   if (!isEnabled())
     return;
@@ -319,6 +318,10 @@ void Widgets::MultiPlot::updateData()
       m_data.resize(plotCount);
     }
 
+    // Keep one set of block summaries per curve
+    if (m_caches.size() != static_cast<std::size_t>(plotCount))
+      m_caches.resize(plotCount);
+
     // Populate data for each plot
     for (qsizetype i = 0; i < plotCount; ++i) {
       // Skip if curve is not visible or out of bounds
@@ -326,7 +329,7 @@ void Widgets::MultiPlot::updateData()
         continue;
 
       // Update data
-      DSP::downsampleMonotonic(X, data.y[i], m_dataW, m_dataH, m_data[i], &ws);
+      DSP::downsampleMonotonic(X, data.y[i], m_dataW, m_dataH, m_data[i], m_caches[i]);
     }
 
     // Calculate auto scale range
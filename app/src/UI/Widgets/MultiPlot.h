@@ -24,6 +24,9 @@
 #include <QQuickItem>
 #include <QVector>
 #include <QXYSeries>
+#include <vector>
+
+#include "DSP.h"
 
 namespace Widgets {
 /**
@@ -100,6 +103,7 @@ class MultiPlot : public QQuickItem {
   // clang-format on
 
 signals:
+  void updated();
   void rangeChanged();
   void themeChanged();
   void curvesChanged();
@@ -162,5 +166,6 @@ private:
   QList<int> m_drawOrders;
   QList<bool> m_visibleCurves;
   QList<QList<QPointF>> m_data;
+  std::vector<DSP::DownsampleCache> m_caches;
 };
 }  // namespace Widgets
@@ -81,6 +81,8 @@ Widgets::Plot::Plot(const int index, QQuickItem* parent)
       m_yLabel += " (" + yDataset.units + ")";
 
     connect(&UI::Dashboard::instance(), &UI::Dashboard::pointsChanged, this, &Plot::updateRange);
+    UI::Dashboard::instance().subscribeWidget(
+      SerialStudio::DashboardPlot, m_index, this, [this] { Q_EMIT updated(); });
 
     calculateAutoScaleRange();
     updateRange();
@@ -254,9 +256,6 @@ void Widgets::Plot::setRunning(const bool enabled)
  */
 void Widgets::Plot::updateData()
 {
-  // Share workspace data
-  static thread_local DSP::DownsampleWorkspace ws;
-
   // Stop if widget is disabled
   if (!isEnabled())
     return;
@@ -267,8 +266,11 @@ void Widgets::Plot::updateData()
     const auto& plotData = UI::Dashboard::instance().plotData(m_index);
 
     // Downsample data that only has one Y point per X point
-    if (m_monotonicData)
-      (void)DSP::downsampleMonotonic(plotData, m_dataW, m_dataH, m_data, &ws);
+    if (m_monotonicData) {
+      const auto& X = *plotData.x;
+      const auto& Y = *plotData.y;
+      (void)DSP::downsampleMonotonic(X, Y, m_dataW, m_dataH, m_data, m_cache);
+    }
 
     // Draw directly on complex plots (such as Lorenz Attractor)
     else {
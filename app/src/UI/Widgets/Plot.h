@@ -26,6 +26,7 @@
 #include <QXYSeries>
 
 #include "DataModel/Frame.h"
+#include "DSP.h"
 
 namespace Widgets {
 /**
@@ -89,6 +90,7 @@ class Plot : public QQuickItem {
   // clang-format on
 
 signals:
+  void updated();
   void rangeChanged();
   void runningChanged();
   void dataSizeChanged();
@@ -144,5 +146,6 @@ private:
 
   bool m_monotonicData;
   QList<QPointF> m_data;
+  DSP::DownsampleCache m_cache;
 };
 }  // namespace Widgets
@@ -91,7 +91,8 @@ Widgets::Plot3D::Plot3D(const int index, QQuickItem* parent)
   setAntialiasing(false);
 
   // Update the plot data
-  connect(&UI::Dashboard::instance(), &UI::Dashboard::updated, this, &Widgets::Plot3D::updateData);
+  UI::Dashboard::instance().subscribeWidget(
+    SerialStudio::DashboardPlot3D, m_index, this, [this] { updateData(); });
 
   // Mark everything as dirty when widget size changes
   connect(this, &Widgets::Plot3D::widthChanged, this, &Widgets::Plot3D::updateSize);
@@ -21,8 +21,11 @@
 
 #include "UI/Widgets/Terminal.h"
 
+#include <algorithm>
+#include <limits>
 #include <QApplication>
 #include <QClipboard>
+#include <QElapsedTimer>
 #include <QFontMetrics>
 #include <QKeyEvent>
 #include <QPainter>
@@ -38,9 +41,14 @@
 #endif
 
 /**
- * @brief Define the number of max lines supported
+ * @brief Time spent scanning the scrollback on each search slice, in ms
  */
-constexpr int MAX_LINES = 1000;
+constexpr int SEARCH_SLICE_MS = 8;
+
+/**
+ * @brief Define the number of max search matches kept
+ */
+constexpr size_t MAX_SEARCH_MATCHES = 1000000;
 
 //--------------------------------------------------------------------------------------------------
 // Constructor & initialization
@@ -94,6 +102,10 @@ Widgets::Terminal::Terminal(QQuickItem* parent)
   , m_privateMode(false)
   , m_stateChanged(false)
   , m_cursorHidden(false)
+  , m_searchNext(0)
+  , m_searchDirty(std::numeric_limits<qint64>::max())
+  , m_currentMatch(-1)
+  , m_searchPending(false)
 {
   initBuffer();
 
@@ -129,18 +141,22 @@ Widgets::Terminal::Terminal(QQuickItem* parent)
     &IO::ConnectionManager::instance(), &IO::ConnectionManager::connectedChanged, this, [=, this] {
       if (IO::ConnectionManager::instance().isConnected())
         clear();
-      else if (m_data.isEmpty())
+      else if (m_buffer.isEmpty())
         loadWelcomeGuide();
     });
 
+  // Console data is only formatted while a terminal is visible
+  Console::Handler::instance().setViewVisible(this, isVisible());
+
   // Scroll to cursor when becoming visible
   connect(this, &Widgets::Terminal::visibleChanged, this, [=, this] {
+    Console::Handler::instance().setViewVisible(this, isVisible());
     if (isVisible()) {
       if (autoscroll() && linesPerPage() > 0) {
         int cursorLine   = m_cursorPosition.y();
         int wrappedLines = 1;
-        if (cursorLine < m_data.size()) {
-          int lineLength = m_data[cursorLine].length();
+        if (cursorLine < lineCount()) {
+          int lineLength = m_buffer.line(cursorLine).text.length();
           wrappedLines   = (lineLength + maxCharsPerLine() - 1) / maxCharsPerLine();
         }
 
@@ -170,9 +186,12 @@ Widgets::Terminal::Terminal(QQuickItem* parent)
   m_cursorTimer.setTimerType(Qt::PreciseTimer);
   connect(&m_cursorTimer, &QTimer::timeout, this, &Widgets::Terminal::toggleCursor);
 
-  // Redraw at UI refresh rate when state changes
+  // Redraw at UI refresh rate when state changes, and advance the search
   m_stateChanged = true;
   connect(&Misc::TimerEvents::instance(), &Misc::TimerEvents::uiTimeout, this, [=, this] {
+    if (isVisible() && !m_searchRegex.pattern().isEmpty())
+      searchSlice();
+
     if (isVisible() && m_stateChanged) {
       m_stateChanged = false;
       update();
@@ -264,17 +283,18 @@ void Widgets::Terminal::renderFastSegment(
 }
 
 /**
- * @brief Renders one word-wrapped segment using per-character ANSI colors.
+ * @brief Renders one word-wrapped segment using the ANSI color runs of its
+ *        line.
  *
- * Builds a vector of character info (position, width, fg/bg color) from
- * @p colorLine, then draws all background fills in a first pass and all
- * text glyphs in a second pass.
+ * The segment is split at the run boundaries, and every span is drawn with a
+ * single fillRect + drawText. Characters that are not covered by a run use
+ * the default colors.
  *
  * @param painter        Active QPainter.
  * @param segment        The substring to render.
  * @param segStart       Start index of @p segment within the logical line
  *                       (used to look up ANSI colors).
- * @param colorLine      Per-character color data for the line, or nullptr.
+ * @param runs           Color runs of the line, sorted by start column.
  * @param defaultFg      Default foreground color when no ANSI override.
  * @param x              Left pixel X to start drawing at.
  * @param y              Top pixel Y of the row.
@@ -282,59 +302,49 @@ void Widgets::Terminal::renderFastSegment(
 void Widgets::Terminal::renderAnsiSegment(QPainter* painter,
                                           const QString& segment,
                                           int segStart,
-                                          const QList<CharColor>* colorLine,
+                                          const QList<ColorRun>& runs,
                                           const QColor& defaultFg,
                                           int x,
                                           int y)
 {
-  // Coalesce consecutive characters with the same fg/bg color into runs,
-  // drawing each run with a single fillRect + drawText instead of per-char.
-  const auto& fm = painter->fontMetrics();
-  int xPos       = x;
-  int j          = 0;
-
-  while (j < segment.length()) {
-    // Determine color for current character
-    const int charIndex = segStart + j;
-    QColor runFg        = defaultFg;
+  // Skip the runs that end before the segment
+  qsizetype r = 0;
+  while (r < runs.size() && runs[r].start + runs[r].length <= segStart)
+    ++r;
+
+  const auto& fm   = painter->fontMetrics();
+  const int segEnd = segStart + segment.length();
+  int xPos         = x;
+  int pos          = segStart;
+
+  while (pos < segEnd) {
+    // Determine the colors and the end of the current span
+    QColor runFg = defaultFg;
     QColor runBg;
-
-    if (colorLine && charIndex < colorLine->size()) {
-      const CharColor& cc = (*colorLine)[charIndex];
-      runFg               = cc.foreground.isValid() ? cc.foreground : defaultFg;
-      runBg               = cc.background;
+    int spanEnd  = segEnd;
+
+    if (r < runs.size() && runs[r].start <= pos) {
+      const auto& run = runs[r];
+      runFg           = run.foreground ? QColor::fromRgb(run.foreground) : defaultFg;
+      runBg           = run.background ? QColor::fromRgb(run.background) : QColor();
+      spanEnd         = qMin(segEnd, run.start + run.length);
+      ++r;
     }
 
-    // Accumulate a run of characters with the same colors
-    const int runStart = j;
-    ++j;
-    while (j < segment.length()) {
-      const int ci = segStart + j;
-      QColor fg    = defaultFg;
-      QColor bg;
-
-      if (colorLine && ci < colorLine->size()) {
-        const CharColor& cc = (*colorLine)[ci];
-        fg                  = cc.foreground.isValid() ? cc.foreground : defaultFg;
-        bg                  = cc.background;
-      }
+    else if (r < runs.size())
+      spanEnd = qMin(segEnd, runs[r].start);
 
-      if (fg != runFg || bg != runBg)
-        break;
-
-      ++j;
-    }
-
-    // Draw the coalesced run
-    const auto runText = QStringView(segment).mid(runStart, j - runStart);
-    const int runWidth = fm.horizontalAdvance(runText.toString());
+    // Draw the span
+    const auto runText = segment.mid(pos - segStart, spanEnd - pos);
+    const int runWidth = fm.horizontalAdvance(runText);
 
     if (runBg.isValid())
       painter->fillRect(xPos, y, runWidth, m_cHeight, runBg);
 
     painter->setPen(runFg);
-    painter->drawText(xPos, y, runWidth, m_cHeight, Qt::AlignVCenter, runText.toString());
+    painter->drawText(xPos, y, runWidth, m_cHeight, Qt::AlignVCenter, runText);
     xPos += runWidth;
+    pos   = spanEnd;
   }
 }
 
@@ -359,8 +369,8 @@ void Widgets::Terminal::drawCursor(QPainter* painter, int firstLine, int lastVLi
   int visualLineY  = m_borderY;
   bool cursorDrawn = false;
 
-  for (int i = firstLine; i <= lastVLine && i < m_data.size(); ++i) {
-    const QString& line = m_data[i];
+  for (int i = firstLine; i <= lastVLine && i < lineCount(); ++i) {
+    const QString& line = m_buffer.line(i).text;
 
     if (line.isEmpty()) {
       if (i == cursorLine) {
@@ -393,7 +403,7 @@ void Widgets::Terminal::drawCursor(QPainter* painter, int firstLine, int lastVLi
       break;
   }
 
-  if (!cursorDrawn && cursorLine >= m_data.size()) {
+  if (!cursorDrawn && cursorLine >= lineCount()) {
     painter->setPen(m_palette.color(QPalette::Text));
     painter->drawText(m_borderX, visualLineY + m_cHeight, QStringLiteral("█"));
   }
@@ -435,7 +445,7 @@ void Widgets::Terminal::paint(QPainter* painter)
   // Draw selection highlights
   int y = m_borderY;
   for (int i = firstLine; i <= lastVLine && y < height() - m_borderY; ++i) {
-    const QString& line = m_data[i];
+    const QString& line = m_buffer.line(i).text;
     bool lineFullySelected =
       !m_selectionEnd.isNull() && i >= m_selectionStart.y() && i < m_selectionEnd.y();
 
@@ -473,16 +483,15 @@ void Widgets::Terminal::paint(QPainter* painter)
   y                             = m_borderY;
   const QColor defaultTextColor = m_palette.color(QPalette::Text);
   for (int i = firstLine; i <= lastVLine && y < height() - m_borderY; ++i) {
-    const QString& line = m_data[i];
+    const auto& data    = m_buffer.line(i);
+    const QString& line = data.text;
 
     if (line.isEmpty()) {
       y += lineHeight;
       continue;
     }
 
-    const QList<CharColor>* colorLine = nullptr;
-    if (ansiColors() && i < m_colorData.size())
-      colorLine = &m_colorData[i];
+    const bool colored = ansiColors() && !data.runs.isEmpty();
 
     int start = 0;
     while (start < line.length()) {
@@ -490,10 +499,10 @@ void Widgets::Terminal::paint(QPainter* painter)
       const QString segment = line.mid(start, end - start);
       int x                 = m_borderX;
 
-      if (!colorLine)
+      if (!colored)
         renderFastSegment(painter, segment, defaultTextColor, x, y);
       else
-        renderAnsiSegment(painter, segment, start, colorLine, defaultTextColor, x, y);
+        renderAnsiSegment(painter, segment, start, data.runs, defaultTextColor, x, y);
 
       y += lineHeight;
       start = end;
@@ -525,6 +534,9 @@ void Widgets::Terminal::paint(QPainter* painter)
     painter->setPen(Qt::NoPen);
     painter->drawRoundedRect(scrollbarRect, scrollbarWidth / 2, scrollbarWidth / 2);
   }
+
+  // Pack the history pages that are no longer on screen
+  m_buffer.packColdPages(firstLine, lastVLine, screenTop());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -599,7 +611,7 @@ bool Widgets::Terminal::autoscroll() const
  */
 bool Widgets::Terminal::copyAvailable() const
 {
-  return (!m_selectionEnd.isNull() || !m_selectionStart.isNull()) && !m_data.isEmpty();
+  return (!m_selectionEnd.isNull() || !m_selectionStart.isNull()) && !m_buffer.isEmpty();
 }
 
 /**
@@ -633,7 +645,7 @@ bool Widgets::Terminal::ansiColors() const
  */
 int Widgets::Terminal::lineCount() const
 {
-  return m_data.size();
+  return m_buffer.lineCount();
 }
 
 /**
@@ -712,6 +724,44 @@ int Widgets::Terminal::terminalRows() const
   return linesPerPage();
 }
 
+/**
+ * @brief Returns @c true if scrollback pages that are off screen are
+ *        compressed.
+ */
+bool Widgets::Terminal::scrollbackCompression() const
+{
+  return m_buffer.compression();
+}
+
+/**
+ * @brief Returns the number of search matches found so far.
+ */
+int Widgets::Terminal::searchMatches() const
+{
+  return static_cast<int>(m_searchMatches.size());
+}
+
+/**
+ * @brief Returns the index of the selected search match, or -1 if no match is
+ *        selected.
+ */
+int Widgets::Terminal::currentMatch() const
+{
+  return m_currentMatch;
+}
+
+/**
+ * @brief Returns @c true while a search still has lines left to scan.
+ */
+bool Widgets::Terminal::searching() const
+{
+  if (m_searchRegex.pattern().isEmpty())
+    return false;
+
+  const qint64 end = m_buffer.firstLineNumber() + lineCount();
+  return m_searchNext < end && m_searchMatches.size() < MAX_SEARCH_MATCHES;
+}
+
 /**
  * @brief Handles key press events and forwards them to the active driver as
  *        VT-100 byte sequences.
@@ -976,13 +1026,15 @@ QPoint Widgets::Terminal::positionToCursor(const QPoint& pos) const
   int remainingY = localY;
 
   if (localY < 0) {
-    if (m_scrollOffsetY < m_data.size())
+    if (m_scrollOffsetY < lineCount())
       return QPoint(0, m_scrollOffsetY);
     return QPoint(0, 0);
   }
 
-  for (int i = m_scrollOffsetY; i < m_data.size(); ++i) {
-    const QString& line = m_data[i];
+  // Every line takes at least one row, so only localY + 1 lines are checked
+  const int lastLine = qMin(lineCount(), m_scrollOffsetY + localY + 1);
+  for (int i = m_scrollOffsetY; i < lastLine; ++i) {
+    const QString& line = m_buffer.line(i).text;
 
     if (line.isEmpty()) {
       if (remainingY == 0)
@@ -1003,9 +1055,9 @@ QPoint Widgets::Terminal::positionToCursor(const QPoint& pos) const
     }
   }
 
-  if (!m_data.isEmpty()) {
-    int lastLine = m_data.size() - 1;
-    int lastChar = m_data.last().length();
+  if (!m_buffer.isEmpty()) {
+    int lastLine = lineCount() - 1;
+    int lastChar = m_buffer.line(lastLine).text.length();
     return QPoint(lastChar, lastLine);
   }
 
@@ -1045,7 +1097,7 @@ void Widgets::Terminal::copy()
     std::swap(start, end);
 
   for (int lineIndex = start.y(); lineIndex <= end.y(); ++lineIndex) {
-    const QString& line = m_data[lineIndex];
+    const QString& line = m_buffer.line(lineIndex).text;
 
     int startX = (lineIndex == start.y()) ? start.x() : 0;
     int endX   = (lineIndex == end.y()) ? end.x() : line.size();
@@ -1092,13 +1144,13 @@ void Widgets::Terminal::clear()
  */
 void Widgets::Terminal::selectAll()
 {
-  if (m_data.isEmpty())
+  if (m_buffer.isEmpty())
     return;
 
   // Select entire buffer
   m_selectionStart       = QPoint(0, 0);
-  int lastLineIndex      = m_data.size() - 1;
-  int lastCharIndex      = m_data[lastLineIndex].size();
+  int lastLineIndex      = lineCount() - 1;
+  int lastCharIndex      = m_buffer.line(lastLineIndex).text.size();
   m_selectionEnd         = QPoint(lastCharIndex, lastLineIndex);
   m_selectionStartCursor = m_selectionStart;
 
@@ -1213,17 +1265,30 @@ void Widgets::Terminal::setVt100Emulation(const bool enabled)
  */
 void Widgets::Terminal::setAnsiColors(const bool enabled)
 {
-  // Toggle ANSI color mode and allocate color data when enabling
+  // Toggle ANSI color mode and reset the current color when enabling
   m_ansiColors = enabled;
 
-  if (enabled) {
+  if (enabled)
     m_currentColor = QColor();
-    m_colorData.reserve(MAX_LINES);
-  }
 
   Q_EMIT ansiColorsChanged();
 }
 
+/**
+ * @brief Enables or disables compression of scrollback pages that are off
+ *        screen.
+ *
+ * Uncompressed pages are still packed into a single allocation each, which
+ * trades memory for a faster scroll through old history.
+ */
+void Widgets::Terminal::setScrollbackCompression(const bool enabled)
+{
+  if (m_buffer.compression() != enabled) {
+    m_buffer.setCompression(enabled);
+    Q_EMIT scrollbackCompressionChanged();
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // Cursor management
 //--------------------------------------------------------------------------------------------------
@@ -1303,8 +1368,8 @@ void Widgets::Terminal::loadWelcomeGuide()
   if (lines > 0 && height() > 0) {
     int cursorLine   = m_cursorPosition.y();
     int wrappedLines = 1;
-    if (cursorLine < m_data.size()) {
-      int lineLength = m_data[cursorLine].length();
+    if (cursorLine < lineCount()) {
+      int lineLength = m_buffer.line(cursorLine).text.length();
       wrappedLines   = (lineLength + maxCharsPerLine() - 1) / maxCharsPerLine();
     }
 
@@ -1425,31 +1490,17 @@ void Widgets::Terminal::append(const QString& data)
  *   position.
  * - Moving the cursor to the right after each character is placed.
  *
- * If autoscroll is enabled, the vertical scroll offset (`scrollOffsetY`) is
- * adjusted to ensure that the cursor remains visible, and
+ * Once the scrollback holds more than its maximum number of lines, the oldest
+ * pages are dropped. If autoscroll is enabled, the vertical scroll offset
+ * (`scrollOffsetY`) is adjusted to ensure that the cursor remains visible, and
  * `scrollOffsetYChanged()` is emitted to notify of any changes.
  *
  * @see replaceData(), setCursorPosition(), autoscroll()
  */
 void Widgets::Terminal::appendString(QStringView string)
 {
-  // Ensure buffer memory does not exceed MAX_LINES
-  const int linesToDrop = m_data.size() - MAX_LINES + 1;
-  if (m_data.size() >= MAX_LINES && linesToDrop > 0) {
-    m_data.erase(m_data.begin(), m_data.begin() + linesToDrop);
-    if (ansiColors() && m_colorData.size() >= linesToDrop)
-      m_colorData.erase(m_colorData.begin(), m_colorData.begin() + linesToDrop);
-
-    if (m_cursorPosition.y() >= linesToDrop)
-      m_cursorPosition.setY(m_cursorPosition.y() - linesToDrop);
-    else
-      m_cursorPosition.setY(0);
-
-    if (m_scrollOffsetY >= linesToDrop)
-      m_scrollOffsetY -= linesToDrop;
-    else
-      m_scrollOffsetY = 0;
-  }
+  // The cursor only moves forward here, so no earlier line is changed
+  markSearchDirty(m_cursorPosition.y());
 
   // Register each character in the provided string
   for (const auto& character : string) {
@@ -1462,13 +1513,18 @@ void Widgets::Terminal::appendString(QStringView string)
       setCursorPosition(0, m_cursorPosition.y() + 1);
   }
 
+  // Drop the oldest history pages once the scrollback is full
+  const int dropped = m_buffer.trim();
+  if (dropped > 0)
+    dropHistory(dropped);
+
   // Adjust the scroll offset if autoscroll is enabled
   if (autoscroll()) {
     // Calculate the total number of wrapped lines for the current line
     int cursorLine   = m_cursorPosition.y();
     int wrappedLines = 1;
-    if (cursorLine < m_data.size()) {
-      int lineLength = m_data[cursorLine].length();
+    if (cursorLine < lineCount()) {
+      int lineLength = m_buffer.line(cursorLine).text.length();
       wrappedLines   = (lineLength + maxCharsPerLine() - 1) / maxCharsPerLine();
     }
 
@@ -1518,7 +1574,7 @@ void Widgets::Terminal::removeStringFromCursor(const Direction direction, int le
   // Cap bytes to remove (right)
   int removeSize = 0;
   if (direction == RightDirection) {
-    qsizetype l1 = m_data[positionY].size() - positionX;
+    qsizetype l1 = m_buffer.line(positionY).text.size() - positionX;
     qsizetype l2 = static_cast<qsizetype>(len);
     removeSize   = qMin(l1, l2);
   }
@@ -1529,6 +1585,7 @@ void Widgets::Terminal::removeStringFromCursor(const Direction direction, int le
 
   // Removal operation
   int offset = 0;
+  markSearchDirty(positionY);
   const QChar clearChar('\x7F');
   for (int i = 0; i < removeSize; ++i) {
     // Get offset depending on removal direction
@@ -1545,25 +1602,307 @@ void Widgets::Terminal::removeStringFromCursor(const Direction direction, int le
 /**
  * @brief Initializes the terminal's data buffer.
  *
- * Clears the existing data buffer and reservers memory for the scrollback.
+ * Clears the scrollback and releases its pages. An active search keeps its
+ * pattern and starts over on the empty buffer.
  *
  * This function is typically used to reset the terminal state, ensuring
  * efficient memory management for upcoming operations.
  */
 void Widgets::Terminal::initBuffer()
 {
-  m_data.clear();
-  m_data.squeeze();
+  m_buffer.clear();
   m_scrollOffsetY = 0;
-  m_data.reserve(MAX_LINES);
-  m_colorData.clear();
-  m_colorData.squeeze();
 
-  // Pre-allocate color memory only when ANSI mode is active
-  if (ansiColors()) {
-    m_colorData.reserve(MAX_LINES);
+  // Reset the current color only when ANSI mode is active
+  if (ansiColors())
     m_currentColor = QColor();
+
+  // Restart the search on the empty buffer
+  m_searchMatches.clear();
+  m_searchNext   = 0;
+  m_searchDirty  = std::numeric_limits<qint64>::max();
+  m_currentMatch = -1;
+  Q_EMIT searchChanged();
+}
+
+/**
+ * @brief Moves the line-based state up after @p lines lines were dropped from
+ *        the front of the scrollback.
+ *
+ * The cursor, the saved cursor and the scroll offset move up with the text. A
+ * selection that started in the dropped lines is cleared, and search matches
+ * in them are forgotten.
+ */
+void Widgets::Terminal::dropHistory(int lines)
+{
+  // Move the cursor and the view up with the text
+  m_cursorPosition.setY(qMax(0, m_cursorPosition.y() - lines));
+  m_savedCursorPosition.setY(qMax(0, m_savedCursorPosition.y() - lines));
+  m_scrollOffsetY = qMax(0, m_scrollOffsetY - lines);
+
+  // Move the selection, or clear it if it was dropped
+  if (!m_selectionStart.isNull() || !m_selectionEnd.isNull()) {
+    if (m_selectionStart.y() < lines) {
+      m_selectionStart = QPoint();
+      m_selectionEnd   = QPoint();
+    }
+
+    else {
+      m_selectionStart.ry() -= lines;
+      m_selectionEnd.ry()   -= lines;
+    }
+
+    m_selectionStartCursor = QPoint();
+    Q_EMIT selectionChanged();
+  }
+
+  // Forget the search matches on dropped lines
+  const qint64 first = m_buffer.firstLineNumber();
+  int forgotten      = 0;
+  while (!m_searchMatches.empty() && m_searchMatches.front().line < first) {
+    m_searchMatches.pop_front();
+    ++forgotten;
+  }
+
+  m_searchNext = qMax(m_searchNext, first);
+  if (forgotten > 0) {
+    m_currentMatch = m_currentMatch >= forgotten ? m_currentMatch - forgotten : -1;
+    Q_EMIT searchChanged();
+  }
+}
+
+/**
+ * @brief Records that line @p line and the lines below it changed, so that the
+ *        search scans them again.
+ */
+void Widgets::Terminal::markSearchDirty(int line)
+{
+  m_searchDirty = qMin(m_searchDirty, m_buffer.firstLineNumber() + qMax(0, line));
+}
+
+/**
+ * @brief Returns the buffer line shown at the top row of the VT-100 screen.
+ *
+ * The screen is the last terminalRows() lines of the buffer, including the
+ * cursor line. Cursor addressing (CUP, VPA) and erase commands are relative to
+ * it, so they keep working once output has scrolled into the history.
+ */
+int Widgets::Terminal::screenTop() const
+{
+  const int bottom = qMax(lineCount(), m_cursorPosition.y() + 1);
+  return qMax(0, bottom - qMax(1, linesPerPage()));
+}
+
+//--------------------------------------------------------------------------------------------------
+// Scrollback search
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Starts a search for @p pattern across the whole scrollback.
+ *
+ * @param pattern       Text or regular expression to look for. An empty
+ *                      pattern ends the search.
+ * @param regex         If @c true, @p pattern is a regular expression;
+ *                      otherwise it is matched literally.
+ * @param caseSensitive If @c true, letter case must match.
+ *
+ * The first slice runs immediately; the rest of the history is scanned on the
+ * following UI timer ticks. The first match at or below the top of the view is
+ * selected as soon as it is found. Lines written after the search started are
+ * scanned as well.
+ */
+void Widgets::Terminal::search(const QString& pattern, const bool regex, const bool caseSensitive)
+{
+  clearSearch();
+  if (pattern.isEmpty())
+    return;
+
+  // Compile the expression, an invalid one simply has no matches
+  QRegularExpression::PatternOptions options = QRegularExpression::UseUnicodePropertiesOption;
+  if (!caseSensitive)
+    options |= QRegularExpression::CaseInsensitiveOption;
+
+  const auto expression = regex ? pattern : QRegularExpression::escape(pattern);
+  m_searchRegex         = QRegularExpression(expression, options);
+  if (!m_searchRegex.isValid()) {
+    m_searchRegex = QRegularExpression();
+    return;
+  }
+
+  // Scan the first slice right away
+  m_searchRegex.optimize();
+  m_searchNext    = m_buffer.firstLineNumber();
+  m_searchPending = true;
+  searchSlice();
+  Q_EMIT searchChanged();
+}
+
+/**
+ * @brief Selects the search match after the current one, and scrolls to it.
+ *
+ * Without a current match, the first match at or below the top of the view is
+ * selected. The search wraps around to the first match once the whole
+ * scrollback has been scanned; while it is still running, the next match is
+ * selected as soon as it is found.
+ */
+void Widgets::Terminal::findNext()
+{
+  const int index = nextMatch();
+  if (index < searchMatches())
+    selectMatch(index);
+  else if (searching())
+    m_searchPending = true;
+  else if (!m_searchMatches.empty())
+    selectMatch(0);
+}
+
+/**
+ * @brief Selects the search match before the current one, and scrolls to it.
+ *
+ * Without a current match, the last match above the bottom of the view is
+ * selected. The search wraps around to the last match found.
+ */
+void Widgets::Terminal::findPrevious()
+{
+  if (m_searchMatches.empty())
+    return;
+
+  // Find the last match above the bottom of the view
+  int index = m_currentMatch - 1;
+  if (m_currentMatch < 0) {
+    const auto before   = [](const SearchMatch& m, qint64 line) { return m.line < line; };
+    const qint64 bottom = m_buffer.firstLineNumber() + m_scrollOffsetY + linesPerPage();
+    const auto begin    = m_searchMatches.begin();
+    const auto it       = std::lower_bound(begin, m_searchMatches.end(), bottom, before);
+    index               = static_cast<int>(it - begin) - 1;
+  }
+
+  m_searchPending = false;
+  selectMatch(index >= 0 ? index : searchMatches() - 1);
+}
+
+/**
+ * @brief Ends the current search and forgets its matches.
+ */
+void Widgets::Terminal::clearSearch()
+{
+  const bool active = !m_searchRegex.pattern().isEmpty();
+
+  m_searchRegex   = QRegularExpression();
+  m_searchNext    = 0;
+  m_searchDirty   = std::numeric_limits<qint64>::max();
+  m_currentMatch  = -1;
+  m_searchPending = false;
+  m_searchMatches.clear();
+  m_searchMatches.shrink_to_fit();
+
+  if (active)
+    Q_EMIT searchChanged();
+}
+
+/**
+ * @brief Scans the next part of the scrollback for search matches.
+ *
+ * Lines that changed after they were scanned are scanned again first. Each
+ * slice stops after SEARCH_SLICE_MS milliseconds, and the pages it unpacked
+ * are packed again before returning. Matches never span lines.
+ */
+void Widgets::Terminal::searchSlice()
+{
+  const auto matches    = m_searchMatches.size();
+  const bool wasRunning = searching();
+  const qint64 first    = m_buffer.firstLineNumber();
+
+  // Forget matches on lines that changed since they were scanned
+  if (m_searchDirty < m_searchNext) {
+    while (!m_searchMatches.empty() && m_searchMatches.back().line >= m_searchDirty)
+      m_searchMatches.pop_back();
+
+    m_searchNext = m_searchDirty;
+    if (m_currentMatch >= searchMatches())
+      m_currentMatch = -1;
   }
+
+  m_searchDirty = std::numeric_limits<qint64>::max();
+
+  // Scan lines until the time slice runs out
+  QElapsedTimer timer;
+  timer.start();
+
+  int y           = static_cast<int>(m_searchNext - first);
+  const int count = lineCount();
+  while (y < count && m_searchMatches.size() < MAX_SEARCH_MATCHES) {
+    auto it = m_searchRegex.globalMatch(m_buffer.line(y).text);
+    while (it.hasNext()) {
+      const auto match  = it.next();
+      const auto start  = static_cast<int>(match.capturedStart());
+      const auto length = static_cast<int>(match.capturedLength());
+      if (length > 0)
+        m_searchMatches.push_back({first + y, start, length});
+    }
+
+    ++y;
+    if ((y & 255) == 0 && timer.elapsed() >= SEARCH_SLICE_MS)
+      break;
+  }
+
+  m_searchNext = first + y;
+  m_buffer.packColdPages(m_scrollOffsetY, m_scrollOffsetY + linesPerPage(), screenTop());
+
+  // Select the first match once it is found
+  if (m_searchPending) {
+    m_searchPending = false;
+    findNext();
+  }
+
+  if (matches != m_searchMatches.size() || wasRunning != searching())
+    Q_EMIT searchChanged();
+}
+
+/**
+ * @brief Returns the index of the match that findNext() selects, or
+ *        searchMatches() if there is none yet.
+ */
+int Widgets::Terminal::nextMatch() const
+{
+  if (m_currentMatch >= 0)
+    return m_currentMatch + 1;
+
+  const auto before = [](const SearchMatch& m, qint64 line) { return m.line < line; };
+  const qint64 top  = m_buffer.firstLineNumber() + m_scrollOffsetY;
+  const auto it     = std::lower_bound(m_searchMatches.begin(), m_searchMatches.end(), top, before);
+  return static_cast<int>(it - m_searchMatches.begin());
+}
+
+/**
+ * @brief Selects search match @p index and scrolls it into view.
+ *
+ * Autoscroll is disabled if the match is outside of the view, so that new
+ * output does not scroll it away.
+ */
+void Widgets::Terminal::selectMatch(int index)
+{
+  if (index < 0 || index >= searchMatches())
+    return;
+
+  // Select the matched text
+  const auto& match      = m_searchMatches[static_cast<size_t>(index)];
+  const int line         = static_cast<int>(match.line - m_buffer.firstLineNumber());
+  m_currentMatch         = index;
+  m_selectionStart       = QPoint(match.start, line);
+  m_selectionEnd         = QPoint(match.start + match.length, line);
+  m_selectionStartCursor = QPoint();
+
+  // Center the match in the view if it is not visible
+  const int rows = linesPerPage();
+  if (line < m_scrollOffsetY || line >= m_scrollOffsetY + rows) {
+    setAutoscroll(false);
+    setScrollOffsetY(qMax(0, line - rows / 2));
+  }
+
+  m_stateChanged = true;
+  Q_EMIT selectionChanged();
+  Q_EMIT searchChanged();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1714,6 +2053,9 @@ void Widgets::Terminal::processEscape(const QChar& byte, QString& text)
  * - `h`/`l` — DEC private mode set/reset (`?25h` show cursor, `?25l` hide)
  * - All other final letters → silently consumed, return to Text state
  *
+ * Rows are counted from screenTop(), so cursor addressing and `J` never reach
+ * into the scrollback above the screen.
+ *
  * @see setCursorPosition(), removeStringFromCursor(), applyAnsiColor()
  */
 void Widgets::Terminal::processFormat(const QChar& byte, QString& text)
@@ -1803,7 +2145,7 @@ void Widgets::Terminal::processFormat(const QChar& byte, QString& text)
         const int row = qMax(0, m_formatValues.value(0, 1) - 1);
         const int col = qMax(
           0, m_currentFormatValue > 0 ? m_currentFormatValue - 1 : m_formatValues.value(1, 1) - 1);
-        setCursorPosition(col, row);
+        setCursorPosition(col, screenTop() + row);
       }
 
       m_state = Text;
@@ -1823,7 +2165,7 @@ void Widgets::Terminal::processFormat(const QChar& byte, QString& text)
     else if (byte == 'd') {
       if (!m_privateMode) {
         const int row = qMax(0, m_currentFormatValue > 0 ? m_currentFormatValue - 1 : 0);
-        setCursorPosition(m_cursorPosition.x(), row);
+        setCursorPosition(m_cursorPosition.x(), screenTop() + row);
       }
 
       m_state = Text;
@@ -1837,24 +2179,19 @@ void Widgets::Terminal::processFormat(const QChar& byte, QString& text)
           case 0:
             // Erase from cursor to end of screen
             removeStringFromCursor(RightDirection);
-            if (cy + 1 < m_data.size()) {
-              m_data.erase(m_data.begin() + cy + 1, m_data.end());
-              if (ansiColors() && cy + 1 < m_colorData.size())
-                m_colorData.erase(m_colorData.begin() + cy + 1, m_colorData.end());
-            }
-
+            markSearchDirty(cy + 1);
+            m_buffer.truncate(cy + 1);
             break;
-          case 1:
-            // Erase from start of screen to cursor
+          case 1: {
+            // Erase from start of screen to cursor, keeping the scrollback
             removeStringFromCursor(LeftDirection);
-            if (cy > 0) {
-              m_data.erase(m_data.begin(), m_data.begin() + cy);
-              if (ansiColors() && cy < m_colorData.size())
-                m_colorData.erase(m_colorData.begin(), m_colorData.begin() + cy);
-            }
+            const int top = screenTop();
+            markSearchDirty(top);
+            for (int line = top; line < qMin(cy, lineCount()); ++line)
+              m_buffer.editLine(line) = TerminalLine();
 
-            setCursorPosition(m_cursorPosition.x(), 0);
             break;
+          }
           case 2:
           case 3:
             clear();
@@ -2236,7 +2573,7 @@ QString Widgets::Terminal::formatDebugMessage(QtMsgType type,
  */
 void Widgets::Terminal::setCursorPosition(const QPoint& position)
 {
-  const QPoint clamped(position.x(), qBound(0, position.y(), MAX_LINES));
+  const QPoint clamped(position.x(), qBound(0, position.y(), m_buffer.maxLines()));
   if (m_cursorPosition != clamped) {
     m_cursorPosition = clamped;
     Q_EMIT cursorMoved();
@@ -2274,53 +2611,39 @@ void Widgets::Terminal::setCursorPosition(const int x, const int y)
  *   not already exist.
  * - The line at `y` is long enough to hold the character at position `x`,
  *   padding with spaces if necessary.
- * - The character (`byte`) is printable; otherwise, it is replaced with a dot.
+ * - The character (`byte`) is printable; otherwise, it is replaced with a space.
  *
  * If the position `x` is within the length of the current line, the character
  * is replaced. If `x` exceeds the current length, the character is appended to
  * the line.
  *
- * @note Non-printable characters are replaced with a dot (`'.'`).
+ * @note Non-printable characters are replaced with a space.
  *
- * @see lineCount(), m_data
+ * @see lineCount(), TerminalLine::setColor()
  */
 void Widgets::Terminal::replaceData(int x, int y, const QChar& byte)
 {
-  if (y >= m_data.size())
-    m_data.resize(y + 1);
-
-  QString& line = m_data[y];
-
-  // Maintain per-character color data when ANSI mode is active
-  if (ansiColors()) {
-    if (y >= m_colorData.size())
-      m_colorData.resize(y + 1);
-
-    QList<CharColor>& colorLine = m_colorData[y];
+  if (x < 0)
+    return;
 
-    if (x > line.size()) {
-      const int padCount = x - line.size();
-      for (int i = 0; i < padCount; ++i)
-        colorLine.append(CharColor());
-    }
+  // Pad the line with spaces up to the column
+  auto& line = m_buffer.editLine(y);
+  if (x > line.text.size())
+    line.text.resize(x, ' ');
 
-    while (colorLine.size() < line.size())
-      colorLine.append(CharColor());
+  // Write the character
+  const QChar character = byte.isPrint() ? byte : QChar(' ');
+  if (x < line.text.size())
+    line.text[x] = character;
+  else
+    line.text.append(character);
 
-    const CharColor charColor(m_currentColor, m_currentBgColor);
-    if (x >= 0 && x < colorLine.size())
-      colorLine[x] = charColor;
-    else if (x >= 0)
-      colorLine.append(charColor);
+  // Maintain color runs when ANSI mode is active
+  if (ansiColors()) {
+    const QRgb fg = m_currentColor.isValid() ? m_currentColor.rgb() : 0;
+    const QRgb bg = m_currentBgColor.isValid() ? m_currentBgColor.rgb() : 0;
+    line.setColor(x, fg, bg);
   }
-
-  if (x > line.size())
-    line = line.leftJustified(x, ' ');
-
-  if (x >= 0 && x < line.size())
-    line[x] = byte.isPrint() ? byte : ' ';
-  else if (x >= 0)
-    line.append(byte.isPrint() ? byte : ' ');
 }
 
 /**
@@ -2541,8 +2864,8 @@ void Widgets::Terminal::mouseReleaseEvent(QMouseEvent* event)
 void Widgets::Terminal::mouseDoubleClickEvent(QMouseEvent* event)
 {
   auto cursorPos = positionToCursor(event->pos());
-  if (cursorPos.y() >= 0 && cursorPos.y() < m_data.size()) {
-    const QString& line = m_data[cursorPos.y()];
+  if (cursorPos.y() >= 0 && cursorPos.y() < lineCount()) {
+    const QString& line = m_buffer.line(cursorPos.y()).text;
 
     // Expand selection to word boundaries
     int wordStartX = cursorPos.x();
@@ -21,27 +21,17 @@
 
 #pragma once
 
+#include <deque>
 #include <QColor>
 #include <QKeyEvent>
 #include <QPalette>
+#include <QRegularExpression>
 #include <QTimer>
 
 #include "UI/QuickPaintedItemCompat.h"
+#include "UI/Widgets/TerminalBuffer.h"
 
 namespace Widgets {
-/**
- * @struct CharColor
- * @brief Stores foreground and background colors for a character.
- */
-struct CharColor {
-  QColor foreground;
-  QColor background;
-
-  CharColor() : foreground(), background() {}
-
-  CharColor(const QColor& fg, const QColor& bg = QColor()) : foreground(fg), background(bg) {}
-};
-
 /**
  * @class Terminal
  * @brief A QML terminal widget with optional VT-100 emulation.
@@ -54,6 +44,11 @@ struct CharColor {
  *
  * This class is suitable for embedding a terminal interface in QML-based GUI
  * applications, with multiple customizable features exposed as properties.
+ *
+ * Output is kept in a paged TerminalBuffer holding up to a million lines, and
+ * can be searched with a regular expression. The search runs in short slices
+ * on the UI timer, so the whole history can be scanned without blocking the
+ * interface.
  */
 class Terminal : public QuickPaintedItemCompat {
   // clang-format off
@@ -97,6 +92,19 @@ class Terminal : public QuickPaintedItemCompat {
   Q_PROPERTY(int terminalRows
              READ terminalRows
              NOTIFY terminalSizeChanged)
+  Q_PROPERTY(bool scrollbackCompression
+             READ scrollbackCompression
+             WRITE setScrollbackCompression
+             NOTIFY scrollbackCompressionChanged)
+  Q_PROPERTY(int searchMatches
+             READ searchMatches
+             NOTIFY searchChanged)
+  Q_PROPERTY(int currentMatch
+             READ currentMatch
+             NOTIFY searchChanged)
+  Q_PROPERTY(bool searching
+             READ searching
+             NOTIFY searchChanged)
   // clang-format on
 
 signals:
@@ -110,6 +118,8 @@ signals:
   void vt100EmulationChanged();
   void ansiColorsChanged();
   void terminalSizeChanged();
+  void scrollbackCompressionChanged();
+  void searchChanged();
 
 public:
   Terminal(QQuickItem* parent = 0);
@@ -151,6 +161,11 @@ public:
   [[nodiscard]] int terminalColumns() const;
   [[nodiscard]] int terminalRows() const;
 
+  [[nodiscard]] bool scrollbackCompression() const;
+  [[nodiscard]] int searchMatches() const;
+  [[nodiscard]] int currentMatch() const;
+  [[nodiscard]] bool searching() const;
+
   [[nodiscard]] const QPoint& cursorPosition() const;
   [[nodiscard]] QPoint positionToCursor(const QPoint& pos) const;
 
@@ -166,6 +181,12 @@ public slots:
   void setColorPalette(const QPalette& palette);
   void setAnsiColors(const bool enabled);
   void setVt100Emulation(const bool enabled);
+  void setScrollbackCompression(const bool enabled);
+
+  void findNext();
+  void findPrevious();
+  void clearSearch();
+  void search(const QString& pattern, const bool regex = false, const bool caseSensitive = false);
 
 private slots:
   void toggleCursor();
@@ -178,6 +199,12 @@ private slots:
 
 private:
   void initBuffer();
+  void searchSlice();
+  void dropHistory(int lines);
+  void selectMatch(int index);
+  void markSearchDirty(int line);
+  [[nodiscard]] int screenTop() const;
+  [[nodiscard]] int nextMatch() const;
   void processText(const QChar& byte, QString& text);
   void processEscape(const QChar& byte, QString& text);
   void processFormat(const QChar& byte, QString& text);
@@ -202,7 +229,7 @@ private:
   void renderAnsiSegment(QPainter* painter,
                          const QString& segment,
                          int segStart,
-                         const QList<CharColor>* colorLine,
+                         const QList<ColorRun>& runs,
                          const QColor& defaultFg,
                          int x,
                          int y);
@@ -218,9 +245,14 @@ protected:
   void geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) override;
 
 private:
+  struct SearchMatch {
+    qint64 line;
+    int start;
+    int length;
+  };
+
   QPalette m_palette;
-  QStringList m_data;
-  QList<QList<CharColor>> m_colorData;
+  TerminalBuffer m_buffer;
 
   QFont m_font;
   int m_cWidth;
@@ -256,5 +288,12 @@ private:
 
   QColor m_ansiStandardColors[8];
   QColor m_ansiBrightColors[8];
+
+  QRegularExpression m_searchRegex;
+  std::deque<SearchMatch> m_searchMatches;
+  qint64 m_searchNext;
+  qint64 m_searchDirty;
+  int m_currentMatch;
+  bool m_searchPending;
 };
 }  // namespace Widgets
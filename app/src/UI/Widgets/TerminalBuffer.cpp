@@ -0,0 +1,485 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#include "UI/Widgets/TerminalBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief zlib level used for cold pages; terminal text compresses well even
+ *        at the fastest setting.
+ */
+static constexpr int kCompressionLevel = 1;
+
+//--------------------------------------------------------------------------------------------------
+// Helper functions
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Merges the run at @p index with its neighbours if they touch it and
+ *        share its colors.
+ */
+static void mergeRun(QList<Widgets::ColorRun>& runs, qsizetype index)
+{
+  const auto sameColors = [](const Widgets::ColorRun& a, const Widgets::ColorRun& b) {
+    return a.foreground == b.foreground && a.background == b.background;
+  };
+
+  if (index + 1 < runs.size()) {
+    const auto& next = runs[index + 1];
+    auto& run        = runs[index];
+    if (run.start + run.length == next.start && sameColors(run, next)) {
+      run.length += next.length;
+      runs.remove(index + 1);
+    }
+  }
+
+  if (index > 0) {
+    auto& prev      = runs[index - 1];
+    const auto& run = runs[index];
+    if (prev.start + prev.length == run.start && sameColors(prev, run)) {
+      prev.length += run.length;
+      runs.remove(index);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Line colors
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Sets the colors of the character at column @p x.
+ *
+ * Writing past the last run, which is what streaming text does, either grows
+ * that run or appends a new one. Overwriting a colored column splits the run
+ * that covers it.
+ */
+void Widgets::TerminalLine::setColor(int x, QRgb foreground, QRgb background)
+{
+  const bool plain = foreground == 0 && background == 0;
+
+  // Fast path: the column is past every run
+  if (runs.isEmpty() || runs.last().start + runs.last().length <= x) {
+    if (plain)
+      return;
+
+    if (!runs.isEmpty()) {
+      auto& last = runs.last();
+      if (last.start + last.length == x && last.foreground == foreground
+          && last.background == background) {
+        ++last.length;
+        return;
+      }
+    }
+
+    runs.append({x, 1, foreground, background});
+    return;
+  }
+
+  // Find the first run that ends after the column
+  qsizetype i = 0;
+  while (runs[i].start + runs[i].length <= x)
+    ++i;
+
+  // The column is in a gap between runs
+  if (runs[i].start > x) {
+    if (plain)
+      return;
+
+    runs.insert(i, {x, 1, foreground, background});
+    mergeRun(runs, i);
+    return;
+  }
+
+  // The column is inside a run, split it around the column
+  auto& run = runs[i];
+  if (run.foreground == foreground && run.background == background)
+    return;
+
+  const int end = run.start + run.length;
+  const ColorRun tail{x + 1, end - x - 1, run.foreground, run.background};
+  run.length = x - run.start;
+
+  qsizetype pos = i;
+  if (run.length == 0)
+    runs.remove(i);
+  else
+    ++pos;
+
+  if (tail.length > 0)
+    runs.insert(pos, tail);
+
+  if (!plain) {
+    runs.insert(pos, {x, 1, foreground, background});
+    mergeRun(runs, pos);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Constructor & state access
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Constructs an empty buffer with the default history size and
+ *        compression enabled.
+ */
+Widgets::TerminalBuffer::TerminalBuffer()
+  : m_lineCount(0)
+  , m_maxLines(kDefaultMaxLines)
+  , m_compression(true)
+  , m_firstLine(0)
+  , m_firstPage(0)
+{}
+
+/**
+ * @brief Returns the number of lines stored in the buffer.
+ */
+int Widgets::TerminalBuffer::lineCount() const noexcept
+{
+  return m_lineCount;
+}
+
+/**
+ * @brief Returns the number of lines kept before old history is dropped.
+ */
+int Widgets::TerminalBuffer::maxLines() const noexcept
+{
+  return m_maxLines;
+}
+
+/**
+ * @brief Returns @c true if the buffer holds no lines.
+ */
+bool Widgets::TerminalBuffer::isEmpty() const noexcept
+{
+  return m_lineCount == 0;
+}
+
+/**
+ * @brief Returns @c true if cold pages are compressed.
+ */
+bool Widgets::TerminalBuffer::compression() const noexcept
+{
+  return m_compression;
+}
+
+/**
+ * @brief Returns the absolute number of line 0, i.e. the number of lines that
+ *        were dropped from the front since the buffer was last cleared.
+ *
+ * Absolute line numbers stay valid while old history is trimmed, which lets
+ * long-lived references such as search matches skip re-indexing.
+ */
+qint64 Widgets::TerminalBuffer::firstLineNumber() const noexcept
+{
+  return m_firstLine;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Line access
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Returns line @p y, unpacking its page if needed.
+ *
+ * Lines past the end of the buffer read as an empty line.
+ */
+const Widgets::TerminalLine& Widgets::TerminalBuffer::line(int y) const
+{
+  static const TerminalLine kEmptyLine;
+  if (y < 0 || y >= m_lineCount)
+    return kEmptyLine;
+
+  const auto index = static_cast<size_t>(y / kPageLines);
+  auto& page       = m_pages[index];
+  if (page.isPacked)
+    unpack(page, m_firstPage + static_cast<qint64>(index));
+
+  return page.lines[static_cast<size_t>(y % kPageLines)];
+}
+
+/**
+ * @brief Returns line @p y for writing, appending empty lines until the buffer
+ *        holds it.
+ */
+Widgets::TerminalLine& Widgets::TerminalBuffer::editLine(int y)
+{
+  y = std::max(0, y);
+  while (m_lineCount <= y) {
+    if (m_pages.empty() || m_pages.back().count == kPageLines) {
+      m_pages.emplace_back();
+      m_pages.back().lines.reserve(kPageLines);
+      m_unpacked.push_back(m_firstPage + static_cast<qint64>(m_pages.size()) - 1);
+    }
+
+    auto& page = m_pages.back();
+    if (page.isPacked)
+      unpack(page, m_firstPage + static_cast<qint64>(m_pages.size()) - 1);
+
+    page.lines.emplace_back();
+    ++page.count;
+    ++m_lineCount;
+  }
+
+  const auto index = static_cast<size_t>(y / kPageLines);
+  auto& page       = m_pages[index];
+  if (page.isPacked)
+    unpack(page, m_firstPage + static_cast<qint64>(index));
+
+  return page.lines[static_cast<size_t>(y % kPageLines)];
+}
+
+//--------------------------------------------------------------------------------------------------
+// Buffer management
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Removes every line and releases the page memory.
+ */
+void Widgets::TerminalBuffer::clear()
+{
+  m_pages.clear();
+  m_pages.shrink_to_fit();
+  m_unpacked.clear();
+  m_lineCount = 0;
+  m_firstLine = 0;
+  m_firstPage = 0;
+}
+
+/**
+ * @brief Keeps the first @p count lines and removes the rest.
+ */
+void Widgets::TerminalBuffer::truncate(int count)
+{
+  count = std::max(0, count);
+  if (count >= m_lineCount)
+    return;
+
+  const auto pages = static_cast<size_t>((count + kPageLines - 1) / kPageLines);
+  while (m_pages.size() > pages) {
+    forgetPage(m_firstPage + static_cast<qint64>(m_pages.size()) - 1);
+    m_pages.pop_back();
+  }
+
+  if (!m_pages.empty()) {
+    auto& page = m_pages.back();
+    if (page.isPacked)
+      unpack(page, m_firstPage + static_cast<qint64>(m_pages.size()) - 1);
+
+    page.count = count - static_cast<int>(pages - 1) * kPageLines;
+    page.lines.resize(static_cast<size_t>(page.count));
+  }
+
+  m_lineCount = count;
+}
+
+/**
+ * @brief Drops the oldest pages while the buffer holds more than maxLines()
+ *        lines.
+ *
+ * History is dropped a page at a time, so the buffer can exceed its limit by
+ * less than one page.
+ *
+ * @return The number of lines removed from the front.
+ */
+int Widgets::TerminalBuffer::trim()
+{
+  int dropped = 0;
+  while (m_pages.size() > 1 && m_lineCount - kPageLines >= m_maxLines) {
+    forgetPage(m_firstPage);
+    m_pages.pop_front();
+    ++m_firstPage;
+    m_lineCount -= kPageLines;
+    dropped     += kPageLines;
+  }
+
+  m_firstLine += dropped;
+  return dropped;
+}
+
+/**
+ * @brief Sets the number of lines kept before old history is dropped.
+ *
+ * The new limit takes effect on the next call to trim().
+ */
+void Widgets::TerminalBuffer::setMaxLines(int lines)
+{
+  m_maxLines = std::max(kPageLines, lines);
+}
+
+/**
+ * @brief Enables or disables zlib compression of cold pages.
+ *
+ * Pages that are already packed keep their format until they are unpacked.
+ */
+void Widgets::TerminalBuffer::setCompression(bool enabled)
+{
+  m_compression = enabled;
+}
+
+/**
+ * @brief Packs every unpacked page outside the given line ranges.
+ *
+ * Pages that overlap [@p viewFirst, @p viewLast] (what is on screen) or that
+ * hold @p editFirst or any later line (where the cursor can write) stay
+ * unpacked. The last page is never packed.
+ */
+void Widgets::TerminalBuffer::packColdPages(int viewFirst, int viewLast, int editFirst)
+{
+  if (m_pages.empty())
+    return;
+
+  const qint64 lastPage  = m_firstPage + static_cast<qint64>(m_pages.size()) - 1;
+  const qint64 viewStart = m_firstPage + std::max(0, viewFirst) / kPageLines;
+  const qint64 viewEnd   = m_firstPage + std::max(0, viewLast) / kPageLines;
+  const qint64 editStart = std::min(lastPage, m_firstPage + std::max(0, editFirst) / kPageLines);
+
+  auto it = m_unpacked.begin();
+  while (it != m_unpacked.end()) {
+    const qint64 serial = *it;
+    if (serial >= editStart || (serial >= viewStart && serial <= viewEnd)) {
+      ++it;
+      continue;
+    }
+
+    pack(m_pages[static_cast<size_t>(serial - m_firstPage)]);
+    it = m_unpacked.erase(it);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Page packing
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Serializes the lines of @p page into a single byte array.
+ *
+ * The layout is a (text length, run count) pair per line, followed by the
+ * UTF-16 text of every line and then by every color run.
+ */
+void Widgets::TerminalBuffer::pack(Page& page) const
+{
+  // Compute the size of the serialized page
+  qsizetype chars = 0;
+  qsizetype runs  = 0;
+  for (const auto& line : page.lines) {
+    chars += line.text.size();
+    runs  += line.runs.size();
+  }
+
+  // Write the header, the text and the color runs
+  const qsizetype header = page.count * 2 * static_cast<qsizetype>(sizeof(quint32));
+  QByteArray data(header + chars * static_cast<qsizetype>(sizeof(QChar))
+                    + runs * static_cast<qsizetype>(sizeof(ColorRun)),
+                  Qt::Uninitialized);
+
+  auto* sizes = reinterpret_cast<quint32*>(data.data());
+  char* out   = data.data() + header;
+  for (const auto& line : page.lines) {
+    *sizes++ = static_cast<quint32>(line.text.size());
+    *sizes++ = static_cast<quint32>(line.runs.size());
+
+    const auto bytes = line.text.size() * static_cast<qsizetype>(sizeof(QChar));
+    if (bytes > 0)
+      std::memcpy(out, line.text.constData(), static_cast<size_t>(bytes));
+
+    out += bytes;
+  }
+
+  for (const auto& line : page.lines) {
+    const auto bytes = line.runs.size() * static_cast<qsizetype>(sizeof(ColorRun));
+    if (bytes > 0)
+      std::memcpy(out, line.runs.constData(), static_cast<size_t>(bytes));
+
+    out += bytes;
+  }
+
+  // Replace the line objects with the packed data
+  page.compressed = m_compression;
+  page.packed     = m_compression ? qCompress(data, kCompressionLevel) : data;
+  page.isPacked   = true;
+  page.lines.clear();
+  page.lines.shrink_to_fit();
+}
+
+/**
+ * @brief Restores the lines of a packed @p page and marks it as unpacked.
+ *
+ * A page that fails to decompress comes back as empty lines, so the line
+ * numbering of the buffer is preserved.
+ */
+void Widgets::TerminalBuffer::unpack(Page& page, qint64 serial) const
+{
+  const QByteArray data = page.compressed ? qUncompress(page.packed) : page.packed;
+
+  page.lines.reserve(kPageLines);
+  page.lines.resize(static_cast<size_t>(page.count));
+
+  const qsizetype header = page.count * 2 * static_cast<qsizetype>(sizeof(quint32));
+  if (data.size() >= header) {
+    const auto* sizes = reinterpret_cast<const quint32*>(data.constData());
+    const char* in    = data.constData() + header;
+    const char* end   = data.constData() + data.size();
+
+    for (auto& line : page.lines) {
+      const auto chars = static_cast<qsizetype>(*sizes);
+      const auto bytes = chars * static_cast<qsizetype>(sizeof(QChar));
+      sizes           += 2;
+      if (end - in < bytes)
+        break;
+
+      line.text = QString(reinterpret_cast<const QChar*>(in), chars);
+      in       += bytes;
+    }
+
+    sizes = reinterpret_cast<const quint32*>(data.constData()) + 1;
+    for (auto& line : page.lines) {
+      const auto count = static_cast<qsizetype>(*sizes);
+      const auto bytes = count * static_cast<qsizetype>(sizeof(ColorRun));
+      sizes           += 2;
+      if (end - in < bytes)
+        break;
+
+      line.runs.resize(count);
+      if (bytes > 0)
+        std::memcpy(line.runs.data(), in, static_cast<size_t>(bytes));
+
+      in += bytes;
+    }
+  }
+
+  page.packed.clear();
+  page.packed.squeeze();
+  page.isPacked   = false;
+  page.compressed = false;
+  m_unpacked.push_back(serial);
+}
+
+/**
+ * @brief Removes the page with the given @p serial number from the list of
+ *        unpacked pages.
+ */
+void Widgets::TerminalBuffer::forgetPage(qint64 serial) const
+{
+  m_unpacked.erase(std::remove(m_unpacked.begin(), m_unpacked.end(), serial), m_unpacked.end());
+}
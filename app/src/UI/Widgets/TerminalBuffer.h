@@ -0,0 +1,123 @@
+/*
+ * Serial Studio
+ * https://serial-studio.com/
+ *
+ * Copyright (C) 2020–2025 Alex Spataru
+ *
+ * This file is dual-licensed:
+ *
+ * - Under the GNU GPLv3 (or later) for builds that exclude Pro modules.
+ * - Under the Serial Studio Commercial License for builds that include
+ *   any Pro functionality.
+ *
+ * You must comply with the terms of one of these licenses, depending
+ * on your use case.
+ *
+ * For GPL terms, see <https://www.gnu.org/licenses/gpl-3.0.html>
+ * For commercial terms, see LICENSE_COMMERCIAL.md in the project root.
+ *
+ * SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+ */
+
+#pragma once
+
+#include <deque>
+#include <QByteArray>
+#include <QColor>
+#include <QList>
+#include <QString>
+#include <vector>
+
+namespace Widgets {
+/**
+ * @struct ColorRun
+ * @brief A span of characters that share the same ANSI colors.
+ *
+ * A color value of 0 stands for the theme default, since ANSI colors are
+ * always opaque.
+ */
+struct ColorRun {
+  qint32 start;
+  qint32 length;
+  QRgb foreground;
+  QRgb background;
+};
+
+/**
+ * @struct TerminalLine
+ * @brief One logical line of terminal output.
+ *
+ * Only characters with a non-default color are covered by a run, so plain
+ * text needs no color data at all.
+ */
+struct TerminalLine {
+  QString text;
+  QList<ColorRun> runs;
+
+  void setColor(int x, QRgb foreground, QRgb background);
+};
+
+/**
+ * @class TerminalBuffer
+ * @brief Paged scrollback storage for the terminal widget.
+ *
+ * Lines are kept in pages of kPageLines lines. Every page except the last one
+ * is full, so finding a line is a division, and dropping the oldest history
+ * removes whole pages from the front without moving the rest.
+ *
+ * Pages that are neither on screen nor near the cursor are packed into a
+ * single byte array, which drops the per-line allocations and, if compression
+ * is enabled, shrinks the text with zlib. A packed page is unpacked again when
+ * one of its lines is read or written, and packed back on the next call to
+ * packColdPages().
+ *
+ * References returned by line() and editLine() stay valid until the buffer is
+ * cleared, truncated, trimmed or packed.
+ */
+class TerminalBuffer {
+public:
+  static constexpr int kPageLines       = 256;
+  static constexpr int kDefaultMaxLines = 1000000;
+
+  TerminalBuffer();
+
+  [[nodiscard]] int lineCount() const noexcept;
+  [[nodiscard]] int maxLines() const noexcept;
+  [[nodiscard]] bool isEmpty() const noexcept;
+  [[nodiscard]] bool compression() const noexcept;
+  [[nodiscard]] qint64 firstLineNumber() const noexcept;
+
+  [[nodiscard]] const TerminalLine& line(int y) const;
+  [[nodiscard]] TerminalLine& editLine(int y);
+
+  void clear();
+  void truncate(int count);
+  [[nodiscard]] int trim();
+  void setMaxLines(int lines);
+  void setCompression(bool enabled);
+  void packColdPages(int viewFirst, int viewLast, int editFirst);
+
+private:
+  struct Page {
+    std::vector<TerminalLine> lines;
+    QByteArray packed;
+    int count       = 0;
+    bool isPacked   = false;
+    bool compressed = false;
+  };
+
+  void pack(Page& page) const;
+  void unpack(Page& page, qint64 serial) const;
+  void forgetPage(qint64 serial) const;
+
+private:
+  int m_lineCount;
+  int m_maxLines;
+  bool m_compression;
+  qint64 m_firstLine;
+  qint64 m_firstPage;
+
+  mutable std::deque<Page> m_pages;
+  mutable std::vector<qint64> m_unpacked;
+};
+}  // namespace Widgets
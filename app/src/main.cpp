@@ -36,6 +36,7 @@
 #include <QSettings>
 #include <QStyleFactory>
 #include <QSysInfo>
+#include <QTimer>
 
 #ifdef Q_OS_LINUX
 #  include <QDir>
@@ -50,14 +51,13 @@
 #include "AppInfo.h"
 #include "AppState.h"
 #include "DataModel/ProjectModel.h"
+#include "DataModel/Reprocessor.h"
 #include "IO/ConnectionManager.h"
 #include "Misc/ModuleManager.h"
 #include "Misc/TimerEvents.h"
 #include "UI/Dashboard.h"
 
 #ifdef BUILD_COMMERCIAL
-#  include <QTimer>
-
 #  include "Licensing/LemonSqueezy.h"
 #endif
 
@@ -67,6 +67,7 @@
 
 static void cliShowVersion();
 static void cliResetSettings();
+static int cliReprocess(QApplication& app, const QString& filePath, const QString& outputs);
 static bool argvHasFlag(int argc, char** argv, const char* flag);
 static char** injectPlatformArg(int& argc, char** argv, const char* platform);
 
@@ -150,8 +151,9 @@ int main(int argc, char** argv)
   QApplication::setAttribute(Qt::AA_DontUseNativeMenuBar);
   QApplication::setAttribute(Qt::AA_DontUseNativeMenuWindows);
 
-  // Handle headless mode and platform-specific initialization
-  const bool headless = argvHasFlag(argc, argv, "--headless");
+  // Handle headless mode and platform-specific initialization (reprocessing has no UI)
+  const bool headless =
+    argvHasFlag(argc, argv, "--headless") || argvHasFlag(argc, argv, "--reprocess");
   if (headless)
     argv = injectPlatformArg(argc, argv, "offscreen");
 
@@ -198,6 +200,8 @@ int main(int argc, char** argv)
   QCLO headlessOpt("headless", "Run without GUI (headless/server mode)");
   QCLO apiServerOpt("api-server", "Enable API server on startup (port 7777)");
   QCLO pOpt({"p", "project"}, "Loads the specified project file", "file");
+  QCLO reprocessOpt("reprocess", "Reprocesses a recorded file at full speed and exits (implies --headless)", "file");
+  QCLO reprocessOutOpt("reprocess-output", "Sets reprocessing outputs: csv, mdf4 or csv,mdf4 (default: csv)", "formats");
   QCLO qOpt({"q", "quick-plot"}, "Enables quick plot mode (auto-detect CSV data)");
   QCLO jOpt({"j", "device-sends-json"}, "Expects pre-formatted JSON from device");
   QCLO fpsOpt({"t", "fps"}, "Sets visualization refresh rate", "Hz");
@@ -236,6 +240,8 @@ int main(int argc, char** argv)
   parser.addOption(headlessOpt);
   parser.addOption(apiServerOpt);
   parser.addOption(pOpt);
+  parser.addOption(reprocessOpt);
+  parser.addOption(reprocessOutOpt);
   parser.addOption(qOpt);
   parser.addOption(jOpt);
   parser.addOption(fpsOpt);
@@ -320,6 +326,10 @@ int main(int argc, char** argv)
   else if (parser.isSet(jOpt))
     AppState::instance().setOperationMode(SerialStudio::DeviceSendsJSON);
 
+  // Reprocess a recorded file with the selected project/mode, then exit
+  if (parser.isSet(reprocessOpt))
+    return cliReprocess(app, parser.value(reprocessOpt), parser.value(reprocessOutOpt));
+
   // Start full screen
   const auto ctx = moduleManager.engine().rootContext();
   ctx->setContextProperty("CLI_START_FULLSCREEN", parser.isSet(fOpt));
@@ -733,6 +743,76 @@ static void cliResetSettings()
   qDebug() << APP_NAME << "settings cleared!";
 }
 
+/**
+ * @brief Reprocesses a recorded file through the frame pipeline and exits.
+ *
+ * Intended for regenerating CSV/MDF4 outputs after changing a frame parser or
+ * dataset transform. The file is streamed as fast as the pipeline allows; the
+ * throughput is printed once per second and a summary when the run ends.
+ *
+ * @param app      The QApplication instance.
+ * @param filePath Raw capture to reprocess.
+ * @param outputs  Comma-separated list of exporters to enable ("csv", "mdf4").
+ * @return EXIT_SUCCESS if the whole file was processed, EXIT_FAILURE otherwise.
+ */
+static int cliReprocess(QApplication& app, const QString& filePath, const QString& outputs)
+{
+  auto formats = outputs.toLower().split(',', Qt::SkipEmptyParts);
+  if (formats.isEmpty())
+    formats.append(QStringLiteral("csv"));
+
+  // Reject typos instead of silently producing no output
+  for (auto& format : formats) {
+    format = format.trimmed();
+    if (format != QLatin1String("csv") && format != QLatin1String("mdf4")) {
+      qCritical().noquote() << "Unknown reprocessing output:" << format
+                            << "(expected csv, mdf4 or csv,mdf4)";
+      return EXIT_FAILURE;
+    }
+  }
+
+  const bool csv  = formats.contains(QStringLiteral("csv"));
+  const bool mdf4 = formats.contains(QStringLiteral("mdf4"));
+  auto& rp        = DataModel::Reprocessor::instance();
+
+  int result = EXIT_FAILURE;
+
+  QObject::connect(&rp, &DataModel::Reprocessor::progressChanged, &app, [&] {
+    if (rp.isRunning())
+      qInfo().noquote() << QStringLiteral("%1% — %2 frames, %3 frames/s")
+                             .arg(rp.progress() * 100, 0, 'f', 1)
+                             .arg(rp.stats().frames)
+                             .arg(rp.framesPerSecond(), 0, 'f', 0);
+  });
+
+  QObject::connect(&rp, &DataModel::Reprocessor::finished, &app, [&] {
+    const auto& stats = rp.stats();
+    qInfo().noquote() << QStringLiteral("Reprocessed %1: %2 frames, %3 bytes in %4 s (%5 frames/s)")
+                           .arg(stats.filePath)
+                           .arg(stats.frames)
+                           .arg(stats.bytes)
+                           .arg(stats.elapsedSeconds, 0, 'f', 2)
+                           .arg(stats.framesPerSecond(), 0, 'f', 0);
+
+    if (!rp.errorString().isEmpty())
+      qCritical().noquote() << "Cannot reprocess file:" << rp.errorString();
+
+    const bool failed = stats.cancelled || !rp.errorString().isEmpty();
+    result            = failed ? EXIT_FAILURE : EXIT_SUCCESS;
+    app.quit();
+  });
+
+  QTimer::singleShot(0, &app, [&] {
+    if (!rp.start(filePath, csv, mdf4)) {
+      qCritical().noquote() << "Cannot reprocess file:" << rp.errorString();
+      app.quit();
+    }
+  });
+
+  app.exec();
+  return result;
+}
+
 #ifdef BUILD_COMMERCIAL
 /**
  * @brief Activates a license key against the Lemon Squeezy API and exits.
@@ -1432,7 +1432,7 @@ def test_mdf4_export_handler(api: SerialStudioAPI, suite: TestSuite):
         if not passed:
             return False, msg
         result = response.get("result", {})
-        expected_fields = ["enabled", "isOpen"]
+        expected_fields = ["enabled", "isOpen", "compression", "writeStats"]
         for field in expected_fields:
             if field not in result:
                 return False, f"Missing field: {field}"
@@ -1456,6 +1456,19 @@ def test_mdf4_export_handler(api: SerialStudioAPI, suite: TestSuite):
         return assert_error(response, ErrorCode.MISSING_PARAM, "setEnabled_missing")
     run_test(suite, "mdf4.export.setEnabled requires enabled param", test_set_enabled_missing)
 
+    # Test: setCompression
+    def test_set_compression():
+        response = api.send_command("mdf4.export.setCompression", {"enabled": False})
+        passed, msg = assert_success(response, "setCompression")
+        if not passed:
+            return False, msg
+        status = api.send_command("mdf4.export.getStatus").get("result", {})
+        api.send_command("mdf4.export.setCompression", {"enabled": True})
+        if status.get("compression") is not False:
+            return False, "Compression was not disabled"
+        return True, ""
+    run_test(suite, "mdf4.export.setCompression sets compression", test_set_compression)
+
     # Test: close
     def test_close():
         response = api.send_command("mdf4.export.close")
@@ -0,0 +1,225 @@
+"""
+Native CAN Decoder Integration Tests
+
+Projects imported from a DBC file carry both a Lua frame parser and a native
+`canMessages` layout. These tests check that the native decoder produces the
+same values as the generated Lua `extractSignal()` helper, and that editing
+the parser hands decoding back to the script.
+
+The Lua helper is read from DBCImporter.cpp, so the tests always compare
+against the code the importer actually generates.
+
+Copyright (C) 2020-2025 Alex Spataru
+SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+"""
+
+import hashlib
+import re
+import time
+from pathlib import Path
+
+import pytest
+
+
+# ---------------------------------------------------------------------------
+# Helpers
+# ---------------------------------------------------------------------------
+
+_DBC_IMPORTER = (
+    Path(__file__).resolve().parents[2] / "app" / "src" / "DataModel" / "DBCImporter.cpp"
+)
+
+_CAN_ID = 0x123
+
+# (title, startBit, bitLength, bigEndian, signed, factor, offset)
+_SIGNALS = [
+    ("IntelUnsigned", 4, 12, False, False, 0.5, 0),
+    ("IntelSigned", 16, 16, False, True, 1, 0),
+    ("MotorolaAligned", 32, 16, True, False, 1, 0),
+    ("MotorolaSigned", 50, 10, True, True, 0.25, -10),
+]
+
+
+def _extract_signal_helper() -> str:
+    """Return the Lua extractSignal() helper emitted by DBCImporter."""
+    source = _DBC_IMPORTER.read_text(encoding="utf-8")
+    start = source.index('code += "local function extractSignal(')
+    end = source.index('code += "end\\n\\n";', start) + len('code += "end\\n\\n";')
+
+    lines = re.findall(r'code \+= "(.*)";', source[start:end])
+    return "".join(line.replace('\\n', "\n").replace('\\"', '"') for line in lines)
+
+
+def _generated_parser() -> str:
+    """Build a Lua parser shaped like DBCImporter::generateFrameParser()."""
+    code = f"local values = {{}}\nfor i = 1, {len(_SIGNALS)} do values[i] = 0 end\n\n"
+    code += _extract_signal_helper()
+
+    code += f"local function decode_{_CAN_ID:x}(data)\n"
+    for i, (name, start, length, big, signed, factor, offset) in enumerate(_SIGNALS, 1):
+        code += (
+            f"  local raw_{name} = extractSignal(data, {start}, {length}, "
+            f"{'true' if big else 'false'}, {'true' if signed else 'false'})\n"
+            f"  local value_{name} = (raw_{name} * {factor}) + {offset}\n"
+            f"  values[{i}] = value_{name}\n"
+        )
+    code += "end\n\n"
+
+    code += (
+        "function parse(frame)\n"
+        "  if #frame < 3 then return values end\n\n"
+        "  local canId = (frame[1] << 8) | frame[2]\n"
+        "  local dlc = frame[3]\n\n"
+        "  local data = {}\n"
+        "  for i = 1, dlc do\n"
+        "    if 3 + i <= #frame then data[i] = frame[3 + i] end\n"
+        "  end\n\n"
+        f"  if canId == 0x{_CAN_ID:X} then\n"
+        f"    decode_{_CAN_ID:x}(data)\n"
+        "  end\n\n"
+        "  return values\n"
+        "end\n"
+    )
+
+    return code
+
+
+def _load_can_project(api_client, parser: str, native: bool) -> None:
+    """Load a one-message CAN project, with or without the native layout."""
+    source = {
+        "title": "CAN Bus",
+        "sourceId": 0,
+        "busType": 0,
+        "frameStart": "",
+        "frameEnd": "",
+        "checksumAlgorithm": "",
+        "frameDetection": 2,  # SerialStudio::NoDelimiters
+        "decoder": 3,  # SerialStudio::Binary
+        "hexadecimalDelimiters": False,
+        "frameParserLanguage": 1,  # SerialStudio::Lua
+        "frameParserCode": parser,
+        "connectionSettings": {},
+    }
+
+    if native:
+        source["canMessages"] = [{
+            "id": _CAN_ID,
+            "signals": [
+                {
+                    "index": i, "startBit": start, "bitLength": length,
+                    "bigEndian": big, "signed": signed,
+                    "factor": factor, "offset": offset,
+                }
+                for i, (_, start, length, big, signed, factor, offset)
+                in enumerate(_SIGNALS, 1)
+            ],
+        }]
+        source["canParserDigest"] = hashlib.sha256(parser.encode("utf-8")).hexdigest()
+
+    config = {
+        "title": "CAN Decoder Test",
+        "decoder": 3,
+        "frameEnd": "",
+        "frameStart": "",
+        "frameParser": parser,
+        "frameDetection": 2,
+        "hexadecimalDelimiters": False,
+        "checksumAlgorithm": "",
+        "mapTilerApiKey": "",
+        "thunderforestApiKey": "",
+        "groups": [{"title": "Message", "widget": "", "datasets": [
+            {
+                "title": name, "units": "", "widget": "", "index": i,
+                "graph": False, "log": False, "fft": False, "led": False,
+                "min": 0, "max": 0, "alarm": 0, "ledHigh": 1,
+                "fftSamples": 1024, "fftSamplingRate": 100, "value": "",
+            }
+            for i, (name, *_rest) in enumerate(_SIGNALS, 1)
+        ]}],
+        "actions": [],
+        "sources": [source],
+    }
+
+    result = api_client.load_project_from_json(config)
+    assert result["loaded"] is True
+
+    api_client.set_operation_mode("project")
+    time.sleep(0.1)
+
+    load_result = api_client.command("project.loadIntoFrameBuilder")
+    assert load_result.get("loaded"), "project.loadIntoFrameBuilder must succeed"
+    time.sleep(0.2)
+
+
+def _can_frame(payload: bytes, dlc: int | None = None) -> bytes:
+    """Frame in the CAN bus driver layout: 16-bit ID, DLC, payload."""
+    dlc = len(payload) if dlc is None else dlc
+    return bytes([_CAN_ID >> 8, _CAN_ID & 0xFF, dlc]) + payload[:dlc]
+
+
+def _decode(api_client, device_simulator, frames: list[bytes]) -> list[list[float]]:
+    """Send @p frames one at a time and return the dataset values after each."""
+    api_client.configure_network(host="127.0.0.1", port=9000, socket_type="tcp")
+    api_client.connect_device()
+    assert device_simulator.wait_for_connection(timeout=5.0), "Device did not connect"
+
+    decoded = []
+    for frame in frames:
+        device_simulator.send_frame(frame)
+        time.sleep(0.3)
+
+        data = api_client.get_dashboard_data()["frame"]
+        decoded.append([float(d["value"]) for d in data["groups"][0]["datasets"]])
+
+    api_client.disconnect_device()
+    time.sleep(0.3)
+    return decoded
+
+
+# Every signal set, all signals negative, and DLCs that cut signals short
+_FRAMES = [
+    _can_frame(bytes([0x5A, 0xC3, 0x34, 0x12, 0xAB, 0xCD, 0x9F, 0xE0])),
+    _can_frame(bytes([0xF0, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF])),
+    _can_frame(bytes([0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88]), dlc=5),
+    _can_frame(bytes([0x11, 0x22, 0xF3, 0x44, 0x55, 0x66, 0x77, 0x88]), dlc=3),
+    _can_frame(bytes([0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0xC7, 0x88]), dlc=7),
+]
+
+
+# ---------------------------------------------------------------------------
+# Native decoder parity
+# ---------------------------------------------------------------------------
+
+@pytest.mark.project
+def test_native_can_decoder_matches_generated_lua(api_client, device_simulator, clean_state):
+    """Intel, Motorola, signed and short-DLC signals decode like the Lua parser."""
+    parser = _generated_parser()
+
+    _load_can_project(api_client, parser, native=False)
+    expected = _decode(api_client, device_simulator, _FRAMES)
+
+    _load_can_project(api_client, parser, native=True)
+    actual = _decode(api_client, device_simulator, _FRAMES)
+
+    for frame, lua_values, native_values in zip(_FRAMES, expected, actual):
+        assert native_values == pytest.approx(lua_values), (
+            f"Native CAN decoder disagrees with Lua for frame {frame.hex()}"
+        )
+
+
+@pytest.mark.project
+def test_edited_can_parser_replaces_native_decoder(api_client, device_simulator, clean_state):
+    """Once the generated parser is edited, the edited script decodes frames."""
+    parser = _generated_parser()
+    _load_can_project(api_client, parser, native=True)
+
+    edited = parser.replace(
+        "  values[1] = value_IntelUnsigned\n",
+        "  values[1] = value_IntelUnsigned + 1000\n",
+    )
+    assert edited != parser
+    api_client.set_frame_parser_code(edited, language=1)
+    time.sleep(0.2)
+
+    values = _decode(api_client, device_simulator, _FRAMES[:1])[0]
+    assert values[0] >= 1000, "Edited frame parser was ignored"
@@ -0,0 +1,124 @@
+"""
+Dataset Transform Integration Tests
+
+Exercises per-dataset transform() functions and the native dsp filters
+through the public API.
+
+Filter state is keyed by the dataset and the order of the dsp calls inside
+the transform, so these tests check that the keys do not depend on the
+values that flow through the filters.
+
+Copyright (C) 2020-2025 Alex Spataru
+SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-SerialStudio-Commercial
+"""
+
+import time
+
+import pytest
+
+
+# ---------------------------------------------------------------------------
+# Helpers
+# ---------------------------------------------------------------------------
+
+_CSV_PARSER = (
+    "function parse(frame)\n"
+    "  local result = {}\n"
+    "  for field in frame:gmatch('([^,]+)') do\n"
+    "    result[#result + 1] = field\n"
+    "  end\n"
+    "  return result\n"
+    "end\n"
+)
+
+
+def _load_transform_project(api_client, transform_code: str) -> None:
+    """Load a one-dataset Lua project whose dataset uses @p transform_code."""
+    config = {
+        "title": "Transform Filters Test",
+        "decoder": 0,
+        "frameEnd": "*/",
+        "frameStart": "/*",
+        "frameParser": _CSV_PARSER,
+        "frameDetection": 1,
+        "hexadecimalDelimiters": False,
+        "checksumAlgorithm": "",
+        "mapTilerApiKey": "",
+        "thunderforestApiKey": "",
+        "groups": [{"title": "G", "widget": "", "datasets": [
+            {
+                "title": "x", "units": "", "widget": "", "index": 1,
+                "graph": True, "log": False, "fft": False, "led": False,
+                "min": 0, "max": 100, "alarm": 0, "ledHigh": 1,
+                "fftSamples": 1024, "fftSamplingRate": 100, "value": "",
+                "transformCode": transform_code,
+            }
+        ]}],
+        "actions": [],
+        "sources": [{
+            "title": "Device A",
+            "sourceId": 0,
+            "busType": 0,
+            "frameStart": "/*",
+            "frameEnd": "*/",
+            "checksumAlgorithm": "",
+            "frameDetection": 1,
+            "decoderMethod": 0,
+            "hexadecimalDelimiters": False,
+            "frameParserLanguage": 1,  # SerialStudio::Lua
+            "frameParserCode": _CSV_PARSER,
+            "connectionSettings": {},
+        }],
+    }
+
+    result = api_client.load_project_from_json(config)
+    assert result["loaded"] is True
+
+    api_client.set_operation_mode("project")
+    time.sleep(0.1)
+
+    load_result = api_client.command("project.loadIntoFrameBuilder")
+    assert load_result.get("loaded"), "project.loadIntoFrameBuilder must succeed"
+    time.sleep(0.2)
+
+
+def _dataset_value(api_client) -> float:
+    frame = api_client.get_dashboard_data()["frame"]
+    return float(frame["groups"][0]["datasets"][0]["value"])
+
+
+# ---------------------------------------------------------------------------
+# dsp filter state
+# ---------------------------------------------------------------------------
+
+@pytest.mark.project
+def test_dsp_state_survives_nan_input(api_client, device_simulator, clean_state):
+    """A NaN fed to one filter must not move the next filter to another slot.
+
+    The first filter receives NaN on one frame, the second one always counts
+    frames. If the NaN skipped the first slot, the counter would be reset and
+    end below the number of frames sent.
+    """
+    transform = (
+        "function transform(value)\n"
+        "  local probe = value\n"
+        "  if value < 0 then probe = 0 / 0 end\n"
+        "  dsp.derivative(probe)\n"
+        "  return dsp.integrate(1)\n"
+        "end\n"
+    )
+
+    _load_transform_project(api_client, transform)
+
+    api_client.configure_network(host="127.0.0.1", port=9000, socket_type="tcp")
+    api_client.connect_device()
+    assert device_simulator.wait_for_connection(timeout=5.0), "Device did not connect"
+
+    values = [1, 2, -1, 3, 4, 5]
+    frames = [b"/*" + str(v).encode() + b"*/" for v in values]
+    device_simulator.send_frames(frames, interval_seconds=0.1)
+    time.sleep(1.0)
+
+    assert _dataset_value(api_client) == pytest.approx(len(values)), (
+        "dsp.integrate lost its state after a NaN reached dsp.derivative"
+    )
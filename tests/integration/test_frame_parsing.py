@@ -65,7 +65,11 @@ def _wait_for_dashboard_widgets(api_client, minimum: int, timeout: float = 2.0)
     ChecksumType.SUM,
     ChecksumType.CRC8,
     ChecksumType.CRC16,
+    ChecksumType.CRC16_MODBUS,
+    ChecksumType.CRC16_CCITT,
+    ChecksumType.CRC16_CCITT_FALSE,
     ChecksumType.CRC32,
+    ChecksumType.CRC32C,
     ChecksumType.FLETCHER16,
     ChecksumType.ADLER32,
 ])
@@ -96,7 +100,11 @@ def test_checksum_validation(
         ChecksumType.SUM: "MOD-256",
         ChecksumType.CRC8: "CRC-8",
         ChecksumType.CRC16: "CRC-16",
+        ChecksumType.CRC16_MODBUS: "CRC-16-MODBUS",
+        ChecksumType.CRC16_CCITT: "CRC-16-CCITT",
+        ChecksumType.CRC16_CCITT_FALSE: "CRC-16-CCITT-FALSE",
         ChecksumType.CRC32: "CRC-32",
+        ChecksumType.CRC32C: "CRC-32C",
         ChecksumType.FLETCHER16: "Fletcher-16",
         ChecksumType.ADLER32: "Adler-32",
     }
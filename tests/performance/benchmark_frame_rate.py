@@ -170,6 +170,79 @@ def test_checksum_overhead(
     api_client.disconnect_device()
 
 
+@pytest.mark.performance
+@pytest.mark.parametrize("checksum_name, checksum_type", [
+    ("", ChecksumType.NONE),
+    ("XOR-8", ChecksumType.XOR),
+    ("MOD-256", ChecksumType.SUM),
+    ("CRC-8", ChecksumType.CRC8),
+    ("CRC-16", ChecksumType.CRC16),
+    ("CRC-16-MODBUS", ChecksumType.CRC16_MODBUS),
+    ("CRC-16-CCITT", ChecksumType.CRC16_CCITT),
+    ("CRC-16-CCITT-FALSE", ChecksumType.CRC16_CCITT_FALSE),
+    ("CRC-32", ChecksumType.CRC32),
+    ("CRC-32C", ChecksumType.CRC32C),
+    ("Fletcher-16", ChecksumType.FLETCHER16),
+    ("Adler-32", ChecksumType.ADLER32),
+])
+def test_checksum_throughput(
+    benchmark, api_client, device_simulator, checksum_name, checksum_type
+):
+    """
+    Benchmark: Measure frame validation throughput for every checksum.
+
+    Streams large ProjectFile frames back to back, so the time spent per byte
+    in the checksum kernel dominates over the per-frame overhead. Compare each
+    algorithm against the "none" run to get the validation cost.
+    """
+    api_client.create_new_project()
+    api_client.command("project.group.add", {"title": "Checksum", "widgetType": 0})
+    api_client.command("project.dataset.add", {"options": 0})
+    api_client.set_frame_parser_code(DataGenerator.CSV_PARSER_TEMPLATE, language=0)
+    api_client.set_operation_mode("project")
+    api_client.configure_frame_parser(
+        start_sequence="/*",
+        end_sequence="*/",
+        checksum_algorithm=checksum_name,
+        operation_mode=0,
+        frame_detection=1,
+    )
+    assert api_client.command("project.loadIntoFrameBuilder")["loaded"]
+
+    api_client.configure_network(host="127.0.0.1", port=9000, socket_type="tcp")
+    api_client.connect_device()
+    assert device_simulator.wait_for_connection(timeout=5.0)
+
+    values = [i * 0.25 for i in range(1024)]
+    payload = DataGenerator.generate_csv_frame(values=values)
+    frame = DataGenerator.wrap_frame(
+        payload,
+        checksum_type=checksum_type,
+        mode="project",
+    )
+    stream = frame * 1024
+
+    def send_stream():
+        start_time = time.time()
+        device_simulator.send_frame(stream)
+        elapsed = time.time() - start_time
+
+        time.sleep(0.5)
+
+        return elapsed, len(stream)
+
+    result = benchmark.pedantic(send_stream, iterations=1, rounds=3)
+    elapsed, byte_count = result
+
+    print(
+        f"\nChecksum {checksum_name or 'none'}: "
+        f"{byte_count / elapsed / 1024 / 1024:.1f} MiB/s "
+        f"({byte_count} bytes in {elapsed:.3f}s)"
+    )
+
+    api_client.disconnect_device()
+
+
 @pytest.mark.performance
 @pytest.mark.parametrize("frame_size", ["small", "medium", "large"])
 def test_frame_size_impact(benchmark, api_client, device_simulator, frame_size):
@@ -223,3 +296,48 @@ def test_frame_size_impact(benchmark, api_client, device_simulator, frame_size):
     )
 
     api_client.disconnect_device()
+
+
+@pytest.mark.performance
+@pytest.mark.parametrize("chunk_size", [1, 64, 65536])
+def test_chunked_line_throughput(
+    benchmark, api_client, device_simulator, chunk_size
+):
+    """
+    Benchmark: End-to-end throughput of long QuickPlot lines sent in chunks.
+
+    Large QuickPlot lines are split into fixed-size TCP writes, so the frame
+    reader sees the same line grow over many reads. Only the time spent sending
+    is measured, which includes socket and app-side backpressure but also
+    network overhead; it does not isolate the cost of delimiter scanning.
+    """
+    api_client.set_operation_mode("quickplot")
+    api_client.configure_network(host="127.0.0.1", port=9000, socket_type="tcp")
+    api_client.connect_device()
+    assert device_simulator.wait_for_connection(timeout=5.0)
+
+    values = [i * 0.5 for i in range(2000)]
+    line = (DataGenerator.generate_csv_frame(values=values) + "\n").encode()
+    stream = line * 16
+
+    def send_chunked():
+        start_time = time.time()
+        for offset in range(0, len(stream), chunk_size):
+            device_simulator.send_frame(stream[offset:offset + chunk_size])
+
+        elapsed = time.time() - start_time
+
+        time.sleep(0.5)
+
+        return elapsed, len(stream)
+
+    result = benchmark.pedantic(send_chunked, iterations=1, rounds=3)
+    elapsed, byte_count = result
+
+    print(
+        f"\nChunked QuickPlot lines ({chunk_size} B writes, end-to-end): "
+        f"{byte_count / elapsed / 1024:.1f} KiB/s "
+        f"({byte_count} bytes in {elapsed:.3f}s)"
+    )
+
+    api_client.disconnect_device()
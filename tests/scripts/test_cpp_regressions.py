@@ -51,7 +51,7 @@ def test_csv_player_catchup_uses_next_frame_timestamps():
     text = _read("app/src/CSV/Player.cpp")
 
     assert re.search(
-        r"while \(m_framePos < frameCount\(\) - 1.*?m_timestampCache\[m_framePos \+ 1\]",
+        r"while \(m_framePos < frameCount\(\) - 1.*?getTimestampSeconds\(m_framePos \+ 1\)",
         text,
         re.DOTALL,
     )
@@ -62,11 +62,22 @@ def test_csv_player_catchup_uses_next_frame_timestamps():
     )
 
 
+def test_csv_export_keeps_raw_text_of_numeric_cells():
+    text = _read("app/src/CSV/Export.cpp")
+
+    assert re.search(
+        r"if \(cell->value\.isEmpty\(\) && cell->isNumeric\).*?appendNumber\(.*?"
+        r"else\s+m_writeBuffer\.append\(cell->value\.simplified\(\)\.toUtf8\(\)\);",
+        text,
+        re.DOTALL,
+    )
+
+
 def test_mdf4_player_catchup_uses_next_frame_timestamp():
     text = _read("app/src/MDF4/Player.cpp")
 
     assert re.search(
-        r"while \(m_framePos < frameCount\(\) - 1.*?nextFrameTime = m_frameIndex\[m_framePos \+ 1\]\.timestamp",
+        r"while \(m_framePos < frameCount\(\) - 1.*?nextFrameTime = m_frameTimes\[m_framePos \+ 1\]",
         text,
         re.DOTALL,
     )
@@ -104,6 +115,17 @@ def test_mcp_schema_matches_registered_command_names():
     assert 'QStringLiteral("csv.export.start")' not in csv
 
 
+def test_udp_datagrams_are_delivered_in_batches():
+    network = _read("app/src/IO/Drivers/Network.cpp")
+    manager = _read("app/src/IO/DeviceManager.cpp")
+
+    assert "Q_EMIT datagramsReceived(batch);" in network
+    assert "recvmmsg(" in network
+    assert "m_udpBuffer" not in network
+    assert "&IO::FrameReader::processDatagrams" in manager
+    assert "&IO::HAL_Driver::datagramsReceived, m_frameReader, nullptr" in manager
+
+
 def test_declarative_widget_avoids_unsafe_table_cast():
     text = _read("app/src/UI/DeclarativeWidgets/DeclarativeWidget.cpp")
 
@@ -132,7 +154,7 @@ def test_hotpath_byte_array_ptrs_are_null_guarded():
 
     assert "if (!data || data->isEmpty())" in frame_reader
     assert "if (!data || data->isEmpty() || m_sockets.isEmpty())" in server
-    assert "if (!data)" in console
+    assert console.count("if (!data || data->isEmpty())") >= 2
 
 
 def test_window_manager_taskbar_access_is_guarded():
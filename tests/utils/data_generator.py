@@ -23,7 +23,11 @@ class ChecksumType(Enum):
     SUM = "sum"
     CRC8 = "crc8"
     CRC16 = "crc16"
+    CRC16_MODBUS = "crc16_modbus"
+    CRC16_CCITT = "crc16_ccitt"
+    CRC16_CCITT_FALSE = "crc16_ccitt_false"
     CRC32 = "crc32"
+    CRC32C = "crc32c"
     FLETCHER16 = "fletcher16"
     ADLER32 = "adler32"
 
@@ -121,7 +125,7 @@ end
                     crc &= 0xFF
             return crc
 
-        elif checksum_type == ChecksumType.CRC16:
+        elif checksum_type in (ChecksumType.CRC16, ChecksumType.CRC16_CCITT_FALSE):
             crc = 0xFFFF
             for byte in data:
                 x = (crc >> 8) ^ byte
@@ -129,9 +133,43 @@ end
                 crc = ((crc << 8) ^ (x << 12) ^ (x << 5) ^ x) & 0xFFFF
             return crc
 
+        elif checksum_type == ChecksumType.CRC16_CCITT:
+            crc = 0x0000
+            for byte in data:
+                crc ^= byte << 8
+                for _ in range(8):
+                    if crc & 0x8000:
+                        crc = (crc << 1) ^ 0x1021
+                    else:
+                        crc <<= 1
+                    crc &= 0xFFFF
+            return crc
+
+        elif checksum_type == ChecksumType.CRC16_MODBUS:
+            crc = 0xFFFF
+            for byte in data:
+                crc ^= byte
+                for _ in range(8):
+                    if crc & 1:
+                        crc = (crc >> 1) ^ 0xA001
+                    else:
+                        crc >>= 1
+            return crc
+
         elif checksum_type == ChecksumType.CRC32:
             return zlib.crc32(data) & 0xFFFFFFFF
 
+        elif checksum_type == ChecksumType.CRC32C:
+            crc = 0xFFFFFFFF
+            for byte in data:
+                crc ^= byte
+                for _ in range(8):
+                    if crc & 1:
+                        crc = (crc >> 1) ^ 0x82F63B78
+                    else:
+                        crc >>= 1
+            return crc ^ 0xFFFFFFFF
+
         elif checksum_type == ChecksumType.FLETCHER16:
             sum1 = 0
             sum2 = 0
@@ -290,9 +328,19 @@ end
         if mode.lower() != "json" and checksum_type != ChecksumType.NONE:
             checksum = DataGenerator.calculate_checksum(payload_bytes, checksum_type)
 
-            if checksum_type in (ChecksumType.CRC32, ChecksumType.ADLER32):
+            if checksum_type in (
+                ChecksumType.CRC32,
+                ChecksumType.CRC32C,
+                ChecksumType.ADLER32,
+            ):
                 checksum_bytes = struct.pack(">I", checksum)
-            elif checksum_type == ChecksumType.CRC16:
+            elif checksum_type == ChecksumType.CRC16_MODBUS:
+                checksum_bytes = struct.pack("<H", checksum)
+            elif checksum_type in (
+                ChecksumType.CRC16,
+                ChecksumType.CRC16_CCITT,
+                ChecksumType.CRC16_CCITT_FALSE,
+            ):
                 checksum_bytes = struct.pack(">H", checksum)
             elif checksum_type == ChecksumType.FLETCHER16:
                 checksum_bytes = struct.pack(">H", checksum)